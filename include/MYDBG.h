@@ -16,9 +16,20 @@
   Verhalten:
   - Nur MYDBG(1…9) → Logeintrag, Webausgabe + Pause
   - MYDBG(0,…)     → nur Konsole, keine Netzlast
+  - MYDBG_ISR(…)   → aus Interrupt-Routinen: Eintrag nur in den Puffer, Ausgabe später im Task
+
+  Speicherung:
+  - MYDBG(1…9) hängt einen Datensatz fester Größe an das jüngste Log-Segment unter MYDBG_SEG_VERZEICHNIS (/mydbg) an
+    (O(1) pro Eintrag); volle Segmente werden als Ganzes gelöscht, /mydbg/manifest.bin merkt sich Bereich und Budget
+  - /mydbg_data.json wird bei Abruf aus dem Ringpuffer erzeugt (keine JSON-Datei mehr im Flash)
+  - Ein Eintrag speichert nur ID der Aufrufstelle + Rohwert (40 Byte), Texte stehen einmalig in /mydbg_sites.bin
+  - Abgeschlossene Log-Segmente werden im Hintergrund gepackt (MYDBG_lz.h), Leser entpacken beim Streamen
+  - GET /mydbg_log.bin liefert alle Segmente als einen binären Abzug (ältester Eintrag zuerst, ungepackt),
+    tools/mydbg_decode.py macht ihn oder einen MYDBG_SERIAL_BINAER-Mitschnitt am PC lesbar
+  - Die Web-Debug-Seite liegt gzip-gepackt im Flash (MYDBG_seite.h, erzeugt aus tools/MYDBG_status.html)
 
   Zusatzfunktionen:
-  - MYDBG_displayJsonLogs()  → zeigt gespeicherte Logs aus JSON-Dateien
+  - MYDBG_displayJsonLogs()  → zeigt gespeicherte Logs aus Ringpuffer und Watchdog-Datei
   - MYDBG_deleteJsonLogs()   → löscht /mydbg_*.json Dateien
   - MYDBG_resetJsonFiles()   → kombiniert Löschen + Wiederherstellung
   - MYDBG_MENUE()            → Konsolenmenü mit Steuerung der Debug-Parameter
@@ -32,11 +43,21 @@
 #include <WiFi.h>
 #include <ESPAsyncWebServer.h>
 #include <time.h>
+#include <sys/time.h>
+#include <esp_timer.h>
+#include <esp_sntp.h>
 #include <esp_task_wdt.h>
+#include <esp_rom_crc.h>
 #include <ArduinoJson.h>
+#include <atomic>
+#include <memory>
+#include <new>
+#include "MYDBG_lz.h"
+#include "MYDBG_seite.h"
+#include <type_traits>
 
 // === Systemeinstellungen ===
-#define MYDBG_MAX_LOGFILES 10
+#define MYDBG_MAX_LOGFILES 200 // Logeinträge in /mydbg_data.json und in der Konsolenliste (neueste zuerst)
 #define MYDBG_MAX_WATCHDOGS 10
 #define MYDBG_WDT_DEFAULT 10
 #define MYDBG_WDT_EXTENDED 300
@@ -45,6 +66,170 @@
 // #define MYDBG_NO_AUTOINIT             // unterdrückt automatische Initialisierung
 // #define MYDBG_WEBDEBUG_NUR_MANUELL    // Web-Debug nur manuell starten
 #define MYDBG_EIGENER_SERVER // Aktiviert eigenen Server für MYDBG
+// #define MYDBG_ASYNC                   // MYDBG(...) legt Einträge nur in den Eintragspuffer, ein eigener Task gibt sie aus
+// #define MYDBG_SERIAL_BINAER           // Konsole sendet Binär-Frames statt Text (Dekodieren mit tools/mydbg_decode.py)
+// #define MYDBG_OHNE_FLUGSCHREIBER      // keine Kopie der letzten Aufrufe im RTC-RAM
+// #define MYDBG_FLUG_EIGENE_REGION      // Speicher des Flugschreibers liefert das Projekt über MYDBG_flugRegion()
+// #define MYDBG_OHNE_KOMPRESSION        // abgeschlossene Log-Segmente nicht packen
+// #define MYDBG_OHNE_PROFILER           // MYDBG_SCOPE/MYDBG_TIC/MYDBG_TOC beim Übersetzen entfernen
+// #define MYDBG_PROFIL_ESP_TIMER        // Profiler misst mit esp_timer (µs) statt mit dem Taktzähler der CPU
+// #define MYDBG_OHNE_METRIKEN           // MYDBG_COUNTER/MYDBG_GAUGE/MYDBG_HISTOGRAM beim Übersetzen entfernen
+// #define MYDBG_OHNE_TRACE              // MYDBG_TRACE_BEGIN/END/SCOPE beim Übersetzen entfernen
+// #define MYDBG_OHNE_WATCH              // MYDBG_WATCH beim Übersetzen entfernen
+// #define MYDBG_OHNE_GESUNDHEIT         // kein Heap-/Stack-Trend, Einträge ohne Heap- und Stack-Werte
+#ifndef MYDBG_MAX_SITES
+#define MYDBG_MAX_SITES 128 // Aufrufstellen im Index von /mydbg_sites.bin (8 Byte RAM je Stelle)
+#endif
+
+// === Compile-Zeit-Schwelle ===
+// MYDBG-Aufrufe mit wait < MYDBG_COMPILE_LEVEL werden beim Übersetzen entfernt:
+// kein Code, keine Texte im Flash, kein MYDBG_autoInit(), Argumente werden nicht ausgewertet.
+//   0  → alles bleibt erhalten (Standard)
+//   1  → MYDBG(0, ...) entfällt, MYDBG(1…9, ...) bleibt
+//   10 → alle MYDBG-Aufrufe entfallen (Produktiv-Firmware)
+// Für MYDBG(wait, ...) muss wait dazu eine Konstante sein (geprüft mit if constexpr, gilt also auch ohne Optimierung);
+// MYDBG_L0 … MYDBG_L9 entfernen immer per Präprozessor. test/test_native_compile_level prüft das am fertigen Programm.
+#ifndef MYDBG_COMPILE_LEVEL
+#define MYDBG_COMPILE_LEVEL 0
+#endif
+
+// === Eintragspuffer (MYDBG_ASYNC und MYDBG_ISR) und Ausgabe-Task (nur mit MYDBG_ASYNC) ===
+#ifndef MYDBG_QUEUE_LAENGE
+#define MYDBG_QUEUE_LAENGE 32 // Plätze je CPU-Kern, Zweierpotenz (je 56 Byte RAM)
+#endif
+#ifndef MYDBG_TASK_STACK
+#define MYDBG_TASK_STACK 8192
+#endif
+#ifndef MYDBG_TASK_PRIO
+#define MYDBG_TASK_PRIO 1
+#endif
+
+// === Log-Segmente ===
+#ifndef MYDBG_SEGMENT_EINTRAEGE
+#ifdef MYDBG_OHNE_KOMPRESSION
+#define MYDBG_SEGMENT_EINTRAEGE 100 // Einträge je Segmentdatei (100 × 40 Byte + Kopf passen in einen 4-kB-Block)
+#else
+#define MYDBG_SEGMENT_EINTRAEGE 800 // 32 kB roh; gepackt belegt ein abgeschlossenes Segment nur noch wenige Blöcke
+#endif
+#endif
+#define MYDBG_Z_BLOCK_EINTRAEGE 100 // Einträge je unabhängig gepacktem Block (4 kB RAM beim Lesen)
+#ifndef MYDBG_LOG_BUDGET_PROZENT
+#define MYDBG_LOG_BUDGET_PROZENT 25 // Anteil der LittleFS-Partition für Logsegmente, zur Laufzeit mit MYDBG_setzeLogBudget() änderbar
+#endif
+#define MYDBG_FS_BLOCK 4096 // Blockgröße von LittleFS auf dem ESP32
+
+// === Statusdatei ===
+#ifndef MYDBG_STATUS_INTERVALL_MS
+#define MYDBG_STATUS_INTERVALL_MS 60000 // /mydbg_status.json höchstens so oft schreiben, 0 = nur beim Herunterfahren
+#endif
+
+// === Drosselung je Aufrufstelle ===
+#ifndef MYDBG_RATE_PRO_S
+#define MYDBG_RATE_PRO_S 20 // Einträge je Sekunde und Aufrufstelle im Mittel, 0 = keine Drosselung
+#endif
+#ifndef MYDBG_RATE_BURST
+#define MYDBG_RATE_BURST 10 // so viele Einträge einer Stelle dürfen direkt aufeinander folgen
+#endif
+#ifndef MYDBG_WIEDERHOLUNG_MS
+#define MYDBG_WIEDERHOLUNG_MS 5000 // gleicher Wert an gleicher Stelle höchstens so oft, 0 = nicht zusammenfassen
+#endif
+
+// === Profiler ===
+#ifndef MYDBG_PROFIL_KLASSEN
+#define MYDBG_PROFIL_KLASSEN 24 // Histogrammklassen je Messstelle (Zweierpotenzen, je 4 Byte RAM)
+#endif
+
+// === Metriken ===
+#ifndef MYDBG_METRIK_KLASSEN
+#define MYDBG_METRIK_KLASSEN 16 // Klassen je MYDBG_HISTOGRAM: ≤ 1, ≤ 2, ≤ 4 … ≤ 16384 und darüber (je 4 Byte RAM)
+#endif
+
+// === Trace ===
+#ifndef MYDBG_TRACE_EINTRAEGE
+#define MYDBG_TRACE_EINTRAEGE 512 // Ereignisse im RAM-Ring, Zweierpotenz (je 16 Byte)
+#endif
+
+// === Variablen beobachten ===
+#ifndef MYDBG_WATCH_INTERVALL_MS
+#define MYDBG_WATCH_INTERVALL_MS 100 // Abtastung der MYDBG_WATCH-Variablen, zur Laufzeit mit MYDBG_setzeWatchIntervall() änderbar
+#endif
+#ifndef MYDBG_WATCH_BYTES
+#define MYDBG_WATCH_BYTES 1024 // Verlauf je Variable, delta-kodiert (meist 1–2 Byte je Wert)
+#endif
+#ifndef MYDBG_WATCH_FRAME_MS
+#define MYDBG_WATCH_FRAME_MS 250 // neue Werte höchstens so oft über /dbgws senden
+#endif
+
+// === Heap und Stack ===
+#ifndef MYDBG_GESUNDHEIT_INTERVALL_MS
+#define MYDBG_GESUNDHEIT_INTERVALL_MS 1000 // Abtastung von Heap und Stack für den Trend
+#endif
+#ifndef MYDBG_GESUNDHEIT_PUNKTE
+#define MYDBG_GESUNDHEIT_PUNKTE 128 // Punkte im Trend (je 20 Byte); ist er voll, werden je zwei zusammengefasst
+#endif
+#ifndef MYDBG_GESUNDHEIT_ANLAUF_S
+#define MYDBG_GESUNDHEIT_ANLAUF_S 300 // die ersten Sekunden nach dem Start (WLAN, Server) zählen nicht zum Leck-Trend
+#endif
+#ifndef MYDBG_LECK_BYTES_PRO_H
+#define MYDBG_LECK_BYTES_PRO_H 2048 // so viel weniger freier Heap je Stunde gilt als Leck
+#endif
+#ifndef MYDBG_LECK_MIN_MINUTEN
+#define MYDBG_LECK_MIN_MINUTEN 30 // Trend muss nach dem Anlauf mindestens so lange reichen
+#endif
+#ifndef MYDBG_STACK_WARNUNG
+#define MYDBG_STACK_WARNUNG 512 // Byte Stack-Reserve, darunter wird gewarnt
+#endif
+
+// === Log-Abfrage ===
+#ifndef MYDBG_QUERY_LIMIT
+#define MYDBG_QUERY_LIMIT 100 // Einträge je Antwort von /mydbg_query, wenn limit fehlt
+#endif
+
+// === WebSocket-Bündelung ===
+// Einträge werden gesammelt und als ein JSON-Array-Frame (oder MessagePack, siehe MYDBG_wsFormat) gesendet,
+// sobald das Zeitfenster abgelaufen ist oder genug Einträge beisammen sind
+#ifndef MYDBG_WS_FENSTER_MS
+#define MYDBG_WS_FENSTER_MS 50
+#endif
+#ifndef MYDBG_WS_BUENDEL
+#define MYDBG_WS_BUENDEL 16
+#endif
+#ifndef MYDBG_WS_BUENDEL_BYTES
+#define MYDBG_WS_BUENDEL_BYTES 4096 // Obergrenze eines Frames
+#endif
+#ifndef MYDBG_WS_MP_BYTES
+#define MYDBG_WS_MP_BYTES 1024 // Obergrenze eines MessagePack-Frames (ein Eintrag etwa 40 Byte)
+#endif
+#ifndef MYDBG_WS_STELLEN
+#define MYDBG_WS_STELLEN 32 // je MessagePack-Client gemerkte Aufrufstellen, deren Texte er schon hat (4 Byte je Platz)
+#endif
+#ifndef MYDBG_WS_ABO_TEXT
+#define MYDBG_WS_ABO_TEXT 64 // Zeichen je Funktionsliste eines Abos (func, exclude)
+#endif
+#define MYDBG_WS_MAX_CLIENTS 8 // höchstens 8: jeder Eintrag im Bündel trägt ein Bit je Client
+
+// === Flugschreiber ===
+#ifndef MYDBG_FLUG_ANZAHL
+#define MYDBG_FLUG_ANZAHL 32 // letzte Aufrufe im RTC-RAM (48 Byte je Eintrag)
+#endif
+#ifdef MYDBG_OHNE_FLUGSCHREIBER
+#define MYDBG_FLUG_AKTIV 0
+#else
+#define MYDBG_FLUG_AKTIV 1 // jeder MYDBG-Aufruf wird erfasst, auch wenn er nichts ausgibt
+#endif
+
+// === System-Schnappschuss ===
+#ifndef MYDBG_SYSTEM_INTERVALL_MS
+#define MYDBG_SYSTEM_INTERVALL_MS 5000 // Auffrischen von Dateisystem, Heap und WLAN-Pegel
+#endif
+
+// Verhalten bei vollem Eintragspuffer (nur MYDBG_ASYNC)
+enum MYDBG_Ueberlauf : uint8_t
+{
+    MYDBG_VERWIRF_AELTESTE, // ältesten Eintrag überschreiben (Standard)
+    MYDBG_VERWIRF_NEUESTE,  // neuen Eintrag verwerfen
+    MYDBG_BLOCKIERE         // Aufrufer wartet, bis Platz frei ist
+};
 
 // === Statusvariablen ===
 inline bool MYDBG_timeInitDone = false;
@@ -56,9 +241,135 @@ inline bool MYDBG_webClientActive = false;
 inline bool MYDBG_filesystemReady = false;
 inline bool MYDBG_menuFirstCall = true;
 inline unsigned long MYDBG_menuTimeout = 5000;
+inline MYDBG_Ueberlauf MYDBG_ueberlauf = MYDBG_VERWIRF_AELTESTE;
+inline std::atomic<uint32_t> MYDBG_verworfen{0}; // Anzahl wegen vollem Eintragspuffer verworfener Einträge
+inline uint16_t MYDBG_rateProS = MYDBG_RATE_PRO_S; // Drosselung je Aufrufstelle, 0 = aus
+inline uint16_t MYDBG_rateBurst = MYDBG_RATE_BURST;
+inline uint32_t MYDBG_wiederholungMs = MYDBG_WIEDERHOLUNG_MS; // gleiche Werte zusammenfassen, 0 = aus
+inline bool MYDBG_gesundheitJeEintrag = true; // Heap und Stack in jeden Eintrag von MYDBG(1…9, ...)
 static bool MYDBG_resetGrundExported = false;
 static bool alreadyWritten = false;
 
+// === Logeintrag ===
+// Jede MYDBG-Aufrufstelle hat einen statischen Deskriptor (Funktion, Zeile, Text, Variablenname).
+// Ein Eintrag enthält nur die ID der Aufrufstelle, Zeitstempel und den Rohwert der Variable –
+// die Texte stehen einmal im Flash und werden erst bei der Ausgabe eingesetzt.
+#define MYDBG_FLAG_KONSOLE 0x01 // kurze Konsolenzeile (MYDBG(0, ...) oder wait AUS)
+#define MYDBG_FLAG_STOP 0x02    // volle Ausgabe: Konsole, Ringpuffer, Statusdatei, WebSocket
+#define MYDBG_FLAG_SITE 0x04    // Aufrufstelle steht noch nicht in /mydbg_sites.bin
+#define MYDBG_FLAG_ISR 0x08     // aus MYDBG_ISR: Registrierung, Flugschreiber und Drosselung folgen im Task
+#define MYDBG_FLAG_GESUNDHEIT 0x10 // obere 8 Byte des Werts enthalten Heap und Stack (siehe MYDBG_gesundheitEinpacken)
+
+// Typ des gespeicherten Werts
+enum MYDBG_Typ : uint8_t
+{
+    MYDBG_TYP_KEIN,
+    MYDBG_TYP_INT,
+    MYDBG_TYP_UINT,
+    MYDBG_TYP_FLOAT,
+    MYDBG_TYP_BOOL,
+    MYDBG_TYP_TEXT
+};
+
+// Rohwert einer Variable, Texte werden auf 15 Zeichen gekürzt
+union MYDBG_WertDaten
+{
+    int64_t i;
+    uint64_t u;
+    double f;
+    char text[16];
+};
+
+struct MYDBG_Wert
+{
+    uint8_t typ = MYDBG_TYP_KEIN;
+    MYDBG_WertDaten daten = {};
+}; // Ende der Struktur MYDBG_Wert
+
+// Statischer Deskriptor einer Aufrufstelle (Texte liegen im Flash)
+#define MYDBG_SITE_GESPEICHERT 0x01 // steht in /mydbg_sites.bin
+#define MYDBG_SITE_GESENDET 0x02    // wurde als Binär-Frame über Serial gemeldet
+
+// Zustand der Drosselung je Aufrufstelle (siehe MYDBG_drosseln)
+struct MYDBG_SiteDrossel
+{
+    int64_t frei;             // GCRA: frühester Zeitpunkt (µs), ab dem der Eimer wieder voll wäre
+    int64_t letzteAusgabe;    // µs des letzten ausgegebenen Eintrags
+    MYDBG_WertDaten letzterWert;
+    uint8_t letzterTyp;
+    bool hatWert;
+    uint32_t aufrufe;         // Aufrufe mit Ausgabe seit Start
+    uint32_t unterdrueckt;    // davon gedrosselt, seit Start
+    uint32_t offen;           // gedrosselt seit dem letzten Eintrag, wird mit dem nächsten ausgegeben
+}; // Ende der Struktur MYDBG_SiteDrossel
+
+struct MYDBG_Site
+{
+    const char *func;
+    const char *msg;
+    const char *varName;
+    uint16_t zeile;
+    uint8_t typ;    // Typ des Werts, beim ersten Aufruf ermittelt
+    uint8_t status; // MYDBG_SITE_...
+    uint32_t id;    // Hash aus Funktion, Text, Variable und Zeile; 0 = noch nicht registriert
+    MYDBG_Site *naechste;
+    MYDBG_SiteDrossel drossel;
+}; // Ende der Struktur MYDBG_Site
+
+// Ein Logeintrag mit fester Größe (40 Byte statt ~250 Byte JSON)
+struct MYDBG_LogRecord
+{
+    uint32_t seq;
+    uint32_t site;   // ID der Aufrufstelle
+    uint64_t mikros; // esp_timer_get_time(): µs seit Start, monoton, kein Überlauf
+    uint16_t boot;   // Startzähler – Uhrzeit = mikros + Zeitanker dieses Starts
+    uint8_t typ;     // MYDBG_TYP_...
+    uint8_t resetReason;
+    uint8_t flags;      // MYDBG_FLAG_...
+    uint8_t stufe;      // wait-Stufe des Aufrufs (0…9)
+    uint16_t unterdrueckt; // seit dem vorigen Eintrag dieser Stelle gedrosselte Aufrufe (gesättigt)
+    MYDBG_WertDaten wert;
+}; // Ende der Struktur MYDBG_LogRecord
+static_assert(sizeof(MYDBG_LogRecord) == 40, "MYDBG_LogRecord muss 40 Byte groß sein");
+
+// Heap und Stack zum Zeitpunkt eines Aufrufs
+struct MYDBG_GesundheitWert
+{
+    uint32_t heapFrei;  // Byte
+    uint32_t heapBlock; // größter freier Block – schrumpft er bei gleichem heapFrei, zerfällt der Heap
+    uint32_t heapMin;   // Minimum seit Start
+    uint32_t stackFrei; // kleinste Stack-Reserve des Tasks seit seinem Start (High-Water-Mark), Byte
+}; // Ende der Struktur MYDBG_GesundheitWert
+
+inline uint16_t MYDBG_saettigen16(uint32_t wert)
+{
+    return wert > 0xFFFF ? 0xFFFF : (uint16_t)wert;
+} // Ende der Funktion MYDBG_saettigen16
+
+// Legt Heap und Stack in die oberen 8 Byte des Werts, sofern der Wert sie nicht braucht (Zahlen, bool,
+// Texte bis 7 Zeichen): Heap in 8-Byte-Schritten, Stack in Byte, je 16 Bit gesättigt. Eintragsgröße und
+// Dateiformat bleiben gleich; MYDBG_FLAG_GESUNDHEIT zeigt an, dass die Werte da sind.
+inline bool MYDBG_gesundheitEinpacken(MYDBG_LogRecord &rec, const MYDBG_GesundheitWert &g)
+{
+    if (rec.typ == MYDBG_TYP_TEXT && strnlen(rec.wert.text, 8) == 8)
+        return false;
+    uint16_t teile[4] = {MYDBG_saettigen16(g.heapFrei / 8), MYDBG_saettigen16(g.heapBlock / 8),
+                         MYDBG_saettigen16(g.heapMin / 8), MYDBG_saettigen16(g.stackFrei)};
+    memcpy(rec.wert.text + 8, teile, sizeof(teile));
+    rec.flags |= MYDBG_FLAG_GESUNDHEIT;
+    return true;
+} // Ende der Funktion MYDBG_gesundheitEinpacken
+
+inline bool MYDBG_gesundheitAuspacken(const MYDBG_LogRecord &rec, MYDBG_GesundheitWert &g)
+{
+    if (!(rec.flags & MYDBG_FLAG_GESUNDHEIT))
+        return false;
+    uint16_t teile[4];
+    memcpy(teile, rec.wert.text + 8, sizeof(teile));
+    g = {teile[0] * 8u, teile[1] * 8u, teile[2] * 8u, teile[3]};
+    return true;
+} // Ende der Funktion MYDBG_gesundheitAuspacken
+
 // Vorwärtsdeklaration: JSON-Routen aktivieren
 void MYDBG_addJsonRoutes(AsyncWebServer &server);
 
@@ -71,25 +382,36 @@ inline String MYDBG_resetGrundText = "";
 inline void MYDBG_autoInit();
 inline void MYDBG_initFilesystem();
 inline void MYDBG_initTime(const char *ntpServer = "pool.ntp.org");
+inline void MYDBG_zeitPflegen();
+inline void MYDBG_statusPflegen();
+inline void MYDBG_segPflegen();
+inline void MYDBG_herunterfahren();
+inline void MYDBG_gesundheitStart();
+inline void MYDBG_gesundheitPruefen();
 
 // JSON-Dateien (Dateisystem)
 inline void MYDBG_prepareJsonFiles();
+inline void MYDBG_ringInit();
+inline void MYDBG_ringSchliessen();
 inline void MYDBG_resetJsonFiles();
 void MYDBG_deleteJsonLogs();
 void MYDBG_displayJsonLogs();
 
 // Debug-Ausgaben & Logging
 inline String MYDBG_getTimestamp();
-inline void MYDBG_stopAusgabe(const String &msg, const String &varName, const String &varValue, const String &func, int zeile);
-inline void MYDBG_logToJson(const String &text, const String &func, int line, const String &varName, const String &varValue);
-inline void MYDBG_writeStatusFile(const String &msg, const String &func, int line, const String &varName, const String &varValue);
+inline void MYDBG_erfassen(MYDBG_Site &site, uint8_t flags, uint8_t stufe, const MYDBG_Wert &wert);
+inline void MYDBG_ausgeben(MYDBG_LogRecord &rec);
+inline void MYDBG_warten(int waitIndex);
+inline void MYDBG_stopAusgabe(const MYDBG_LogRecord &rec);
+inline void MYDBG_logToJson(MYDBG_LogRecord &rec);
+inline void MYDBG_writeStatusFile(const MYDBG_LogRecord &rec);
 inline void MYDBG_writeWatchdogRestartFromLastLog();
 inline void MYDBG_fillResetInfo(JsonObject &doc, bool mitFarbe);
 
 // WebSocket / Web Debug
 inline void MYDBG_startWebDebug();
-inline void MYDBG_streamWebLine(const String &msg);
-inline void MYDBG_streamWebLineJSON(const String &msg, const String &varName, const String &varValue, const String &func, int zeile);
+inline void MYDBG_streamWebLine(const char *msg);
+inline void MYDBG_streamWebLineJSON(const MYDBG_LogRecord &rec);
 
 // Watchdog
 inline void MYDBG_setWatchdog(int sekunden);
@@ -145,6 +467,64 @@ inline MYDBG_ResetInfo MYDBG_interpretResetReason(esp_reset_reason_t rsn)
     }
 } // Ende der Funktion MYDBG_interpretResetReason
 
+// === System-Schnappschuss ===
+// Logeinträge lesen Resetgrund, Dateisystembelegung, Heap und WLAN-Pegel nur noch hier.
+// Der Resetgrund wird einmal erfasst. Der Rest wird außerhalb des Aufrufs aufgefrischt
+// (Ausgabe-Task mit MYDBG_ASYNC, sonst vor der Pause von MYDBG(n, ...)).
+// LittleFS.usedBytes() durchsucht die Belegungstabelle und wird nur nach Schreibvorgängen neu gemessen.
+struct MYDBG_SystemZustand
+{
+    esp_reset_reason_t resetGrund = ESP_RST_UNKNOWN;
+    bool resetErfasst = false;
+    uint32_t fsGesamt = 0; // Byte, 0 = Dateisystem nicht bereit
+    uint32_t fsBelegt = 0;
+    bool fsGeaendert = true; // seit der letzten Messung geschrieben
+    uint32_t heapFrei = 0;
+    uint32_t heapMin = 0;
+    int8_t rssi = 0; // dBm, 0 = kein WLAN
+    uint32_t aktualisiertMs = 0;
+    bool gueltig = false;
+}; // Ende der Struktur MYDBG_SystemZustand
+
+inline MYDBG_SystemZustand MYDBG_system;
+
+// Resetgrund dieses Starts (einmalig abgefragt)
+inline esp_reset_reason_t MYDBG_resetGrund()
+{
+    if (!MYDBG_system.resetErfasst)
+    {
+        MYDBG_system.resetGrund = esp_reset_reason();
+        MYDBG_system.resetErfasst = true;
+    }
+    return MYDBG_system.resetGrund;
+} // Ende der Funktion MYDBG_resetGrund
+
+// Frischt den Schnappschuss auf, höchstens alle MYDBG_SYSTEM_INTERVALL_MS (sofort = true: immer)
+inline void MYDBG_systemAktualisieren(bool sofort = false)
+{
+    MYDBG_zeitPflegen();
+    MYDBG_statusPflegen();
+    MYDBG_segPflegen();
+    MYDBG_gesundheitPruefen();
+
+    MYDBG_SystemZustand &z = MYDBG_system;
+    uint32_t jetzt = millis();
+    if (!sofort && z.gueltig && jetzt - z.aktualisiertMs < MYDBG_SYSTEM_INTERVALL_MS)
+        return;
+    MYDBG_resetGrund();
+    if (MYDBG_filesystemReady && (sofort || z.fsGeaendert || z.fsGesamt == 0))
+    {
+        z.fsGesamt = LittleFS.totalBytes();
+        z.fsBelegt = LittleFS.usedBytes();
+        z.fsGeaendert = false;
+    }
+    z.heapFrei = ESP.getFreeHeap();
+    z.heapMin = ESP.getMinFreeHeap();
+    z.rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+    z.aktualisiertMs = jetzt;
+    z.gueltig = true;
+} // Ende der Funktion MYDBG_systemAktualisieren
+
 // Diese Funktion initialisiert das Dateisystem und überprüft, ob es bereit ist.
 inline void MYDBG_autoInit()
 {
@@ -157,11 +537,12 @@ inline void MYDBG_autoInit()
         MYDBG_prepareJsonFiles(); // Jetzt mit Fehlerprüfung und Reparatur
     }
     if (!MYDBG_timeInitDone)
-        MYDBG_initTime(); // Gibt bereits bei Fehler selbstständig Warnung aus
+        MYDBG_initTime(); // blockiert nicht, startet SNTP einmalig sobald WLAN verbunden ist
+    MYDBG_gesundheitStart(); // einmalig: Abtast-Timer für den Heap-/Stack-Trend
 
     if (MYDBG_resetGrundText == "" && !MYDBG_resetGrundExported)
     {
-        MYDBG_ResetInfo info = MYDBG_interpretResetReason(esp_reset_reason());
+        MYDBG_ResetInfo info = MYDBG_interpretResetReason(MYDBG_resetGrund());
         MYDBG_resetGrundText = info.text;
         MYDBG_resetGrundExported = true;
     }
@@ -191,160 +572,4441 @@ inline void MYDBG_autoInit()
 
 } // Ende der Funktion MYDBG_autoInit
 
+// Platzhalter für beim Übersetzen entfernte Aufrufe (Argumente werden nicht ausgewertet)
+#define MYDBG_ENTFERNT(...) \
+    do                     \
+    {                      \
+    } while (0)
+
 // Makro für Debug-Ausgaben
+#if MYDBG_COMPILE_LEVEL > 9
+#define MYDBG(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#else
 #define MYDBG(...) MYDBG_WRAPPER(__VA_ARGS__, MYDBG3, MYDBG2)(__VA_ARGS__)
+#endif
 #define MYDBG_WRAPPER(_1, _2, _3, NAME, ...) NAME
-#define MYDBG2(waitIndex, msgText) MYDBG_INTERNAL(waitIndex, msgText, "", "")
-#define MYDBG3(waitIndex, msgText, var) MYDBG_INTERNAL(waitIndex, msgText, #var, String(var))
-
-#define MYDBG_INTERNAL(waitIndex, msgText, varName, varValue)                            \
-    do                                                                                   \
-    {                                                                                    \
-        MYDBG_autoInit();                                                                \
-        if (MYDBG_isEnabled && (!MYDBG_stopEnabled || waitIndex == 0))                   \
-        {                                                                                \
-            String meldung = String("[MYDBG] > ") + __LINE__ + " | " + msgText;          \
-            if (varName != "" && varValue != "")                                         \
-            {                                                                            \
-                meldung += " | " + String(varName) + " = " + String(varValue);           \
-            }                                                                            \
-            Serial.println(meldung);                                                     \
-        }                                                                                \
-        if (waitIndex > 0 && MYDBG_stopEnabled)                                          \
-        {                                                                                \
-            int ms = constrain(waitIndex * 1000, 0, 9000);                               \
-            MYDBG_stopAusgabe(msgText, varName, varValue, __FUNCTION__, __LINE__);       \
-            if (!MYDBG_filesystemReady)                                                  \
-                MYDBG_initFilesystem();                                                  \
-            MYDBG_logToJson(msgText, __FUNCTION__, __LINE__, varName, varValue);         \
-            MYDBG_writeStatusFile(msgText, __FUNCTION__, __LINE__, varName, varValue);   \
-            MYDBG_streamWebLineJSON(msgText, varName, varValue, __FUNCTION__, __LINE__); \
-            unsigned long __t0 = millis();                                               \
-            while (millis() - __t0 < ms)                                                 \
-            {                                                                            \
-                delay(10);                                                               \
-            }                                                                            \
-        }                                                                                \
+#define MYDBG2(waitIndex, msgText) MYDBG_INTERNAL(waitIndex, msgText, "", MYDBG_Wert())
+#define MYDBG3(waitIndex, msgText, var) MYDBG_INTERNAL(waitIndex, msgText, #var, MYDBG_wert(var))
+
+// msgText muss ein Stringliteral sein – es wird im Deskriptor der Aufrufstelle abgelegt
+
+// Ist wait eine Konstante unter MYDBG_COMPILE_LEVEL, verwirft if constexpr den Aufruf samt Deskriptor und Texten
+// schon beim Übersetzen (auch ohne Optimierung); ein variables wait wird immer zur Laufzeit geprüft.
+#define MYDBG_UNTER_SCHWELLE(waitIndex) \
+    (MYDBG_COMPILE_LEVEL > 0 && __builtin_constant_p(waitIndex) && (waitIndex) < MYDBG_COMPILE_LEVEL)
+
+#define MYDBG_INTERNAL(waitIndex, msgText, varName, varValue)                                            \
+    do                                                                                                   \
+    {                                                                                                    \
+        if constexpr (MYDBG_UNTER_SCHWELLE(waitIndex))                                                   \
+        {                                                                                                \
+        }                                                                                                \
+        else                                                                                             \
+        {                                                                                                \
+            MYDBG_autoInit();                                                                            \
+            uint8_t __flags = 0;                                                                         \
+            if (MYDBG_isEnabled && (!MYDBG_stopEnabled || waitIndex == 0))                               \
+                __flags |= MYDBG_FLAG_KONSOLE;                                                           \
+            if (waitIndex > 0 && MYDBG_stopEnabled)                                                      \
+                __flags |= MYDBG_FLAG_STOP;                                                              \
+            static MYDBG_Site __site = {__FUNCTION__, msgText, varName, __LINE__, 0, 0, 0, nullptr, {}}; \
+            if (__flags || MYDBG_FLUG_AKTIV)                                                             \
+                MYDBG_erfassen(__site, __flags, (uint8_t)(waitIndex), varValue);                        \
+            if (__flags & MYDBG_FLAG_STOP)                                                               \
+                MYDBG_warten(waitIndex);                                                                 \
+        }                                                                                                \
     } while (0) // Ende des Makros MYDBG_INTERNAL
 
-// diese Funktion gibt den Resetgrund aus
-inline void MYDBG_fillResetInfo(JsonObject &doc, bool mitFarbe = true)
+// Aus einer ISR: MYDBG_ISR("Text") oder MYDBG_ISR("Text", var) – volle Ausgabe wie MYDBG(1, ...), aber ohne Pause.
+// Reserviert nur einen Platz im Eintragspuffer und kopiert den Eintrag hinein; alles Weitere erledigt der
+// Ausgabe-Task (MYDBG_ASYNC) bzw. der nächste MYDBG-Aufruf. var muss eine Zahl, bool oder ein char-Zeiger sein –
+// String und andere Typen mit Heap-Zugriff sind in einer ISR nicht erlaubt. Zählt als Stufe 1 für MYDBG_COMPILE_LEVEL.
+#if MYDBG_COMPILE_LEVEL > 1
+#define MYDBG_ISR(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#else
+#define MYDBG_ISR(...) MYDBG_ISR_WRAPPER(__VA_ARGS__, MYDBG_ISR2, MYDBG_ISR1)(__VA_ARGS__)
+#endif
+#define MYDBG_ISR_WRAPPER(_1, _2, NAME, ...) NAME
+#define MYDBG_ISR1(msgText) MYDBG_ISR_INTERNAL(msgText, "", MYDBG_Wert())
+#define MYDBG_ISR2(msgText, var) MYDBG_ISR_INTERNAL(msgText, #var, MYDBG_wert(var))
+
+#define MYDBG_ISR_INTERNAL(msgText, varName, varValue)                                                \
+    do                                                                                                \
+    {                                                                                                 \
+        static MYDBG_Site __site = {__FUNCTION__, msgText, varName, __LINE__, 0, 0, 0, nullptr, {}}; \
+        MYDBG_isrErfassen(__site, varValue);                                                          \
+    } while (0) // Ende des Makros MYDBG_ISR_INTERNAL
+
+// Makros mit fester Stufe: MYDBG_L3("Text", var) entspricht MYDBG(3, "Text", var),
+// liegt die Stufe unter MYDBG_COMPILE_LEVEL, bleibt vom Aufruf nichts übrig
+#if MYDBG_COMPILE_LEVEL <= 0
+#define MYDBG_L0(...) MYDBG(0, __VA_ARGS__)
+#else
+#define MYDBG_L0(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 1
+#define MYDBG_L1(...) MYDBG(1, __VA_ARGS__)
+#else
+#define MYDBG_L1(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 2
+#define MYDBG_L2(...) MYDBG(2, __VA_ARGS__)
+#else
+#define MYDBG_L2(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 3
+#define MYDBG_L3(...) MYDBG(3, __VA_ARGS__)
+#else
+#define MYDBG_L3(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 4
+#define MYDBG_L4(...) MYDBG(4, __VA_ARGS__)
+#else
+#define MYDBG_L4(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 5
+#define MYDBG_L5(...) MYDBG(5, __VA_ARGS__)
+#else
+#define MYDBG_L5(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 6
+#define MYDBG_L6(...) MYDBG(6, __VA_ARGS__)
+#else
+#define MYDBG_L6(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 7
+#define MYDBG_L7(...) MYDBG(7, __VA_ARGS__)
+#else
+#define MYDBG_L7(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 8
+#define MYDBG_L8(...) MYDBG(8, __VA_ARGS__)
+#else
+#define MYDBG_L8(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+#if MYDBG_COMPILE_LEVEL <= 9
+#define MYDBG_L9(...) MYDBG(9, __VA_ARGS__)
+#else
+#define MYDBG_L9(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#endif
+
+// === Profiler ===
+// MYDBG_SCOPE("name") misst die Laufzeit bis zum Ende des umgebenden Blocks, MYDBG_TIC(x) … MYDBG_TOC(x)
+// eine beliebige Strecke innerhalb einer Funktion. Jede Messstelle ist eine statische Struktur mit Anzahl,
+// Minimum, Maximum, Summe und einem Histogramm in Zweierpotenzen – im heißen Pfad weder Heap noch Ein-/Ausgabe.
+// Gemessen wird mit dem Taktzähler der CPU (32 Bit, läuft bei 240 MHz nach knapp 18 s über). Strecken in Tasks,
+// die zwischen den Kernen wechseln dürfen, oder längere Strecken mit MYDBG_PROFIL_ESP_TIMER messen.
+// Nicht aus Interrupts verwenden.
+#ifdef MYDBG_PROFIL_ESP_TIMER
+#define MYDBG_PROFIL_START_BIT 0 // Klasse 0: unter 2 µs
+#else
+#define MYDBG_PROFIL_START_BIT 7 // Klasse 0: unter 256 Takte (ca. 1 µs bei 240 MHz)
+#endif
+
+// Jedes Feld für sich atomar: Messungen aus mehreren Tasks zählen ohne gemeinsame Sperre
+struct MYDBG_ProfilStelle
 {
-    esp_reset_reason_t rsn = esp_reset_reason();
-    MYDBG_ResetInfo info = MYDBG_interpretResetReason(rsn);
-    doc["resetReason"] = (int)rsn;
-    doc["ResetGrund"] = info.text;
-    if (mitFarbe)
-        doc["ResetColor"] = info.farbe;
-} // Ende der Funktion MYDBG_fillResetInfo
+    const char *name;
+    const char *func;
+    uint16_t zeile;
+    std::atomic<bool> registriert;
+    std::atomic<uint32_t> anzahl;
+    std::atomic<uint32_t> min; // Takte bzw. µs mit MYDBG_PROFIL_ESP_TIMER; UINT32_MAX, solange nichts gemessen ist
+    std::atomic<uint32_t> max;
+    std::atomic<uint64_t> summe;
+    std::atomic<uint32_t> klassen[MYDBG_PROFIL_KLASSEN]; // Klasse k: Dauer < 2^(k + 1 + MYDBG_PROFIL_START_BIT)
+    MYDBG_ProfilStelle *naechste;
+}; // Ende der Struktur MYDBG_ProfilStelle
 
-// Speichert den Watchdog mit dem MYDBUG(x, ...) vor dem Watchdog-Reset
-inline void MYDBG_writeWatchdogRestartFromLastLog()
+// Abzug einer Messstelle zum Ausgeben
+struct MYDBG_ProfilWerte
 {
-    
-    if (alreadyWritten)
-        return;
-    alreadyWritten = true;
+    const char *name;
+    const char *func;
+    uint16_t zeile;
+    uint32_t anzahl;
+    uint32_t min;
+    uint32_t max;
+    uint64_t summe;
+    uint32_t klassen[MYDBG_PROFIL_KLASSEN];
+}; // Ende der Struktur MYDBG_ProfilWerte
 
-    if (!LittleFS.exists("/mydbg_data.json"))
-        return;
+inline std::atomic<MYDBG_ProfilStelle *> MYDBG_profilListe{nullptr}; // Ausgaben laufen ohne Sperre durch
+inline portMUX_TYPE MYDBG_profilMux = portMUX_INITIALIZER_UNLOCKED;    // nur zum Eintragen
 
-    File file = LittleFS.open("/mydbg_data.json", "r");
-    if (!file)
-        return;
+__attribute__((always_inline)) inline uint32_t MYDBG_profilZeit()
+{
+#ifdef MYDBG_PROFIL_ESP_TIMER
+    return (uint32_t)esp_timer_get_time();
+#else
+    return ESP.getCycleCount();
+#endif
+} // Ende der Funktion MYDBG_profilZeit
 
-    StaticJsonDocument<2048> doc;
-    DeserializationError error = deserializeJson(doc, file);
-    file.close();
+// Einheiten von MYDBG_profilZeit() je Mikrosekunde
+inline uint32_t MYDBG_profilJeUs()
+{
+#ifdef MYDBG_PROFIL_ESP_TIMER
+    return 1;
+#else
+    return getCpuFrequencyMhz();
+#endif
+} // Ende der Funktion MYDBG_profilJeUs
 
-    if (error || !doc["log"].is<JsonArray>() || doc["log"].as<JsonArray>().size() == 0)
-        return;
+// Trägt eine Stelle beim ersten Aufruf in die Liste ein
+inline void MYDBG_profilRegistrieren(MYDBG_ProfilStelle &stelle)
+{
+    portENTER_CRITICAL(&MYDBG_profilMux);
+    if (!stelle.registriert.load(std::memory_order_relaxed))
+    {
+        stelle.naechste = MYDBG_profilListe.load(std::memory_order_relaxed);
+        MYDBG_profilListe.store(&stelle, std::memory_order_release);
+        stelle.registriert.store(true, std::memory_order_release);
+    }
+    portEXIT_CRITICAL(&MYDBG_profilMux);
+} // Ende der Funktion MYDBG_profilRegistrieren
 
-    JsonObject lastEntry = doc["log"][0];
+// Verbucht eine Messung
+inline void MYDBG_profilErfassen(MYDBG_ProfilStelle &stelle, uint32_t dauer)
+{
+    uint32_t bits = 31 - __builtin_clz(dauer | 1);
+    uint32_t k = bits > MYDBG_PROFIL_START_BIT ? bits - MYDBG_PROFIL_START_BIT : 0;
+    if (k >= MYDBG_PROFIL_KLASSEN)
+        k = MYDBG_PROFIL_KLASSEN - 1;
+    if (!stelle.registriert.load(std::memory_order_acquire))
+        MYDBG_profilRegistrieren(stelle);
+    uint32_t alt = stelle.min.load(std::memory_order_relaxed);
+    while (dauer < alt && !stelle.min.compare_exchange_weak(alt, dauer, std::memory_order_relaxed))
+    {
+    }
+    alt = stelle.max.load(std::memory_order_relaxed);
+    while (dauer > alt && !stelle.max.compare_exchange_weak(alt, dauer, std::memory_order_relaxed))
+    {
+    }
+    stelle.summe.fetch_add(dauer, std::memory_order_relaxed);
+    stelle.klassen[k].fetch_add(1, std::memory_order_relaxed);
+    stelle.anzahl.fetch_add(1, std::memory_order_relaxed);
+} // Ende der Funktion MYDBG_profilErfassen
 
-    // Watchdog-Log vorbereiten
-    StaticJsonDocument<2048> wdDoc;
-    if (LittleFS.exists("/mydbg_watchdog.json"))
+// Liest die Werte einer Stelle, auf Wunsch werden sie im selben Zug geleert. Feld für Feld: eine Messung,
+// die gerade verbucht wird, kann im Abzug halb stehen (z. B. schon in summe, noch nicht in anzahl).
+inline void MYDBG_profilLesen(MYDBG_ProfilStelle &stelle, MYDBG_ProfilWerte &werte, bool leeren = false)
+{
+    werte.name = stelle.name;
+    werte.func = stelle.func;
+    werte.zeile = stelle.zeile;
+    if (leeren)
     {
-        File f = LittleFS.open("/mydbg_watchdog.json", "r");
-        if (f)
+        werte.anzahl = stelle.anzahl.exchange(0, std::memory_order_relaxed);
+        werte.min = stelle.min.exchange(UINT32_MAX, std::memory_order_relaxed);
+        werte.max = stelle.max.exchange(0, std::memory_order_relaxed);
+        werte.summe = stelle.summe.exchange(0, std::memory_order_relaxed);
+        for (uint8_t k = 0; k < MYDBG_PROFIL_KLASSEN; k++)
+            werte.klassen[k] = stelle.klassen[k].exchange(0, std::memory_order_relaxed);
+    }
+    else
+    {
+        werte.anzahl = stelle.anzahl.load(std::memory_order_relaxed);
+        werte.min = stelle.min.load(std::memory_order_relaxed);
+        werte.max = stelle.max.load(std::memory_order_relaxed);
+        werte.summe = stelle.summe.load(std::memory_order_relaxed);
+        for (uint8_t k = 0; k < MYDBG_PROFIL_KLASSEN; k++)
+            werte.klassen[k] = stelle.klassen[k].load(std::memory_order_relaxed);
+    }
+    if (werte.min == UINT32_MAX)
+        werte.min = 0;
+} // Ende der Funktion MYDBG_profilLesen
+
+// Setzt alle Messstellen zurück, die Stellen bleiben registriert
+inline void MYDBG_profilZuruecksetzen()
+{
+    MYDBG_ProfilWerte werte;
+    for (MYDBG_ProfilStelle *s = MYDBG_profilListe.load(std::memory_order_acquire); s; s = s->naechste)
+        MYDBG_profilLesen(*s, werte, true);
+} // Ende der Funktion MYDBG_profilZuruecksetzen
+
+// Obergrenze der Klasse k in µs
+inline float MYDBG_profilGrenzeUs(uint8_t k)
+{
+    return (float)(1ull << (k + 1 + MYDBG_PROFIL_START_BIT)) / MYDBG_profilJeUs();
+} // Ende der Funktion MYDBG_profilGrenzeUs
+
+// Klasse, in die der Anteil (z. B. 0.99) der Messungen fällt – Perzentil als Obergrenze
+inline uint8_t MYDBG_profilPerzentil(const MYDBG_ProfilWerte &s, float anteil)
+{
+    uint32_t ziel = (uint32_t)(s.anzahl * anteil + 0.5f);
+    uint32_t summe = 0;
+    for (uint8_t k = 0; k < MYDBG_PROFIL_KLASSEN; k++)
+    {
+        summe += s.klassen[k];
+        if (summe >= ziel && summe > 0)
+            return k;
+    }
+    return MYDBG_PROFIL_KLASSEN - 1;
+} // Ende der Funktion MYDBG_profilPerzentil
+
+// Misst vom Anlegen bis zum Ende des Blocks
+struct MYDBG_ProfilScope
+{
+    MYDBG_ProfilStelle &stelle;
+    uint32_t start;
+
+    explicit MYDBG_ProfilScope(MYDBG_ProfilStelle &s) : stelle(s), start(MYDBG_profilZeit()) {}
+    ~MYDBG_ProfilScope() { MYDBG_profilErfassen(stelle, MYDBG_profilZeit() - start); }
+    MYDBG_ProfilScope(const MYDBG_ProfilScope &) = delete;
+    MYDBG_ProfilScope &operator=(const MYDBG_ProfilScope &) = delete;
+}; // Ende der Struktur MYDBG_ProfilScope
+
+#define MYDBG_VERBINDEN2(a, b) a##b
+#define MYDBG_VERBINDEN(a, b) MYDBG_VERBINDEN2(a, b)
+#define MYDBG_PROFIL_STELLE(name) {name, __FUNCTION__, __LINE__, false, 0, UINT32_MAX, 0, 0, {}, nullptr}
+
+#ifndef MYDBG_OHNE_PROFILER
+// MYDBG_SCOPE("sensor lesen"); – name muss ein Stringliteral sein
+#define MYDBG_SCOPE(name)                                                                                   \
+    static MYDBG_ProfilStelle MYDBG_VERBINDEN(__mydbg_stelle_, __LINE__) = MYDBG_PROFIL_STELLE(name);        \
+    MYDBG_ProfilScope MYDBG_VERBINDEN(__mydbg_scope_, __LINE__)(MYDBG_VERBINDEN(__mydbg_stelle_, __LINE__))
+// MYDBG_TIC(senden); … MYDBG_TOC(senden); – name ist ein Bezeichner, beide im selben Block
+#define MYDBG_TIC(name)                                                               \
+    static MYDBG_ProfilStelle __mydbg_stelle_##name = MYDBG_PROFIL_STELLE(#name);     \
+    uint32_t __mydbg_tic_##name = MYDBG_profilZeit()
+#define MYDBG_TOC(name) MYDBG_profilErfassen(__mydbg_stelle_##name, MYDBG_profilZeit() - __mydbg_tic_##name)
+#else
+#define MYDBG_SCOPE(name) MYDBG_ENTFERNT(name)
+#define MYDBG_TIC(name) MYDBG_ENTFERNT(name)
+#define MYDBG_TOC(name) MYDBG_ENTFERNT(name)
+#endif
+
+// === Metriken ===
+// MYDBG_COUNTER(name[, n]), MYDBG_GAUGE(name, wert) und MYDBG_HISTOGRAM(name, wert) ersetzen Logzeilen, die eigentlich
+// Zähler oder Messwerte sind. Jede Stelle ist eine statische Struktur mit Atomics: ein Aufruf kostet wenige Befehle,
+// ohne Sperre, Heap, Konsole, WebSocket oder Dateisystem. Beim ersten Aufruf trägt sich die Stelle in eine Liste ein;
+// Stellen mit gleichem Namen teilen sich einen Wert. GET /metrics liefert alles im Textformat von Prometheus.
+// name ist ein Bezeichner (z. B. wlan_versuche). Nicht aus Interrupts verwenden (Eintragen beim ersten Aufruf).
+static_assert(MYDBG_METRIK_KLASSEN >= 2 && MYDBG_METRIK_KLASSEN <= 32, "MYDBG_METRIK_KLASSEN muss zwischen 2 und 32 liegen");
+
+enum MYDBG_MetrikArt : uint8_t
+{
+    MYDBG_METRIK_ZAEHLER,   // counter: wächst nur
+    MYDBG_METRIK_PEGEL,     // gauge: letzter gesetzter Wert
+    MYDBG_METRIK_VERTEILUNG // histogram: Klassen in Zweierpotenzen, Summe und Anzahl
+};
+
+struct MYDBG_Metrik
+{
+    const char *name;
+    MYDBG_MetrikArt art;
+    std::atomic<MYDBG_Metrik *> ziel; // nach dem ersten Aufruf: hält den Wert (sie selbst oder die erste gleichen Namens)
+    std::atomic<uint32_t> zaehler;    // Zähler
+    std::atomic<float> wert;          // Pegel: letzter Wert
+    MYDBG_Metrik *naechste;
+}; // Ende der Struktur MYDBG_Metrik
+
+struct MYDBG_Verteilung : MYDBG_Metrik
+{
+    std::atomic<uint32_t> klassen[MYDBG_METRIK_KLASSEN]; // Klasse k: Wert ≤ 2^k, die letzte ohne Obergrenze
+    std::atomic<double> summe; // double, damit die Summe auch nach Millionen Werten stimmt
+}; // Ende der Struktur MYDBG_Verteilung
+
+inline std::atomic<MYDBG_Metrik *> MYDBG_metrikListe{nullptr}; // /metrics liest ohne Sperre
+inline portMUX_TYPE MYDBG_metrikMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Trägt eine Stelle beim ersten Aufruf ein; gibt es den Namen schon, übernimmt die erste Stelle den Wert
+inline MYDBG_Metrik &MYDBG_metrikRegistrieren(MYDBG_Metrik &m)
+{
+    bool konflikt = false;
+    portENTER_CRITICAL(&MYDBG_metrikMux);
+    if (!m.ziel.load(std::memory_order_relaxed))
+    {
+        MYDBG_Metrik *gleich = MYDBG_metrikListe;
+        while (gleich && strcmp(gleich->name, m.name) != 0)
+            gleich = gleich->naechste;
+        if (gleich && gleich->art == m.art)
         {
-            deserializeJson(wdDoc, f);
-            f.close();
+            m.ziel.store(gleich, std::memory_order_release);
+        }
+        else
+        {
+            konflikt = gleich != nullptr; // gleicher Name, anderer Typ: zählt weiter, wird aber nicht ausgegeben
+            if (!konflikt)
+            {
+                m.naechste = MYDBG_metrikListe;
+                MYDBG_metrikListe = &m;
+            }
+            m.ziel.store(&m, std::memory_order_release);
         }
     }
+    portEXIT_CRITICAL(&MYDBG_metrikMux);
+    if (konflikt)
+        Serial.printf("[MYDBG] ⚠️ Metrik \"%s\" gibt es schon mit anderem Typ – diese Stelle fehlt in /metrics\n", m.name);
+    return *m.ziel.load(std::memory_order_acquire);
+} // Ende der Funktion MYDBG_metrikRegistrieren
 
-    JsonArray wdArr = wdDoc["watchdogs"].is<JsonArray>() ? wdDoc["watchdogs"].as<JsonArray>() : wdDoc.createNestedArray("watchdogs");
+__attribute__((always_inline)) inline MYDBG_Metrik &MYDBG_metrik(MYDBG_Metrik &m)
+{
+    MYDBG_Metrik *ziel = m.ziel.load(std::memory_order_acquire);
+    return ziel ? *ziel : MYDBG_metrikRegistrieren(m);
+} // Ende der Funktion MYDBG_metrik
 
-    JsonObject copy = wdArr.createNestedObject();
-    for (JsonPair kv : lastEntry)
-        copy[kv.key()] = kv.value();
+// Klasse eines Werts: 0 für ≤ 1 (auch negative Werte), k für ≤ 2^k, die letzte für alles darüber
+inline uint8_t MYDBG_metrikKlasse(float w)
+{
+    if (!(w > 1.0f))
+        return 0;
+    if (w > (float)(1ul << (MYDBG_METRIK_KLASSEN - 2)))
+        return MYDBG_METRIK_KLASSEN - 1;
+    uint32_t ganz = (uint32_t)ceilf(w);
+    return 32 - __builtin_clz(ganz - 1);
+} // Ende der Funktion MYDBG_metrikKlasse
 
-    esp_reset_reason_t rsn = esp_reset_reason();
-    MYDBG_ResetInfo info = MYDBG_interpretResetReason(rsn);
-    copy["ResetGrund"] = info.text;
-    copy["reason"] = (int)rsn;
+inline void MYDBG_metrikZaehlen(MYDBG_Metrik &m, uint32_t n)
+{
+    MYDBG_metrik(m).zaehler.fetch_add(n, std::memory_order_relaxed);
+} // Ende der Funktion MYDBG_metrikZaehlen
 
-    // Markiere kritische Resetarten
-    switch (rsn)
+inline void MYDBG_metrikSetzen(MYDBG_Metrik &m, float w)
+{
+    MYDBG_metrik(m).wert.store(w, std::memory_order_relaxed);
+} // Ende der Funktion MYDBG_metrikSetzen
+
+inline void MYDBG_metrikVerteilen(MYDBG_Verteilung &v, float w)
+{
+    MYDBG_Verteilung &ziel = static_cast<MYDBG_Verteilung &>(MYDBG_metrik(v));
+    ziel.klassen[MYDBG_metrikKlasse(w)].fetch_add(1, std::memory_order_relaxed);
+    double summe = ziel.summe.load(std::memory_order_relaxed);
+    while (!ziel.summe.compare_exchange_weak(summe, summe + w, std::memory_order_relaxed))
     {
-    case ESP_RST_PANIC:
-    case ESP_RST_INT_WDT:
-    case ESP_RST_TASK_WDT:
-    case ESP_RST_WDT:
-    case ESP_RST_BROWNOUT:
-        copy["kritisch"] = true;
-        break;
-    default:
-        copy["kritisch"] = false;
-        break;
+    }
+} // Ende der Funktion MYDBG_metrikVerteilen
+
+#define MYDBG_METRIK(name, art) {#name, art, nullptr, 0, 0.0f, nullptr}
+
+#ifndef MYDBG_OHNE_METRIKEN
+// MYDBG_COUNTER(schleifen); MYDBG_COUNTER(bytes_gesendet, n); – zählt um 1 bzw. n weiter
+#define MYDBG_COUNTER(...) MYDBG_COUNTER_WRAPPER(__VA_ARGS__, MYDBG_COUNTER2, MYDBG_COUNTER1)(__VA_ARGS__)
+#define MYDBG_COUNTER_WRAPPER(_1, _2, NAME, ...) NAME
+#define MYDBG_COUNTER1(name) MYDBG_COUNTER2(name, 1)
+#define MYDBG_COUNTER2(name, n)                                                                \
+    do                                                                                         \
+    {                                                                                          \
+        static MYDBG_Metrik __mydbg_metrik = MYDBG_METRIK(name, MYDBG_METRIK_ZAEHLER);         \
+        MYDBG_metrikZaehlen(__mydbg_metrik, (uint32_t)(n));                                   \
+    } while (0) // Ende des Makros MYDBG_COUNTER2
+// MYDBG_GAUGE(temperatur, t); – merkt sich den letzten Wert
+#define MYDBG_GAUGE(name, wert)                                                                \
+    do                                                                                         \
+    {                                                                                          \
+        static MYDBG_Metrik __mydbg_metrik = MYDBG_METRIK(name, MYDBG_METRIK_PEGEL);           \
+        MYDBG_metrikSetzen(__mydbg_metrik, (float)(wert));                                     \
+    } while (0) // Ende des Makros MYDBG_GAUGE
+// MYDBG_HISTOGRAM(antwort_ms, dauer); – Verteilung in Zweierpotenzen bis 2^(MYDBG_METRIK_KLASSEN - 2)
+#define MYDBG_HISTOGRAM(name, wert)                                                                     \
+    do                                                                                                  \
+    {                                                                                                   \
+        static MYDBG_Verteilung __mydbg_metrik = {MYDBG_METRIK(name, MYDBG_METRIK_VERTEILUNG), {}, 0.0}; \
+        MYDBG_metrikVerteilen(__mydbg_metrik, (float)(wert));                                           \
+    } while (0) // Ende des Makros MYDBG_HISTOGRAM
+#else
+#define MYDBG_COUNTER(...) MYDBG_ENTFERNT(__VA_ARGS__)
+#define MYDBG_GAUGE(name, wert) MYDBG_ENTFERNT(name, wert)
+#define MYDBG_HISTOGRAM(name, wert) MYDBG_ENTFERNT(name, wert)
+#endif
+
+// Kopiert einen Text gekürzt und nullterminiert in ein festes Feld, ohne UTF-8-Zeichen zu zerschneiden
+inline void MYDBG_kopiere(char *ziel, size_t groesse, const char *quelle)
+{
+    size_t i = 0;
+    while (quelle && quelle[i] && i + 1 < groesse)
+    {
+        ziel[i] = quelle[i];
+        i++;
+    }
+    if (quelle && quelle[i])
+    {
+        while (i > 0 && ((uint8_t)quelle[i] & 0xC0) == 0x80)
+            i--; // mitten im Zeichen gekürzt → angefangenes Zeichen weglassen
+    }
+    ziel[i] = '\0';
+} // Ende der Funktion MYDBG_kopiere
+
+// === Trace ===
+// MYDBG_TRACE_BEGIN("name") … MYDBG_TRACE_END("name") und MYDBG_TRACE_SCOPE("name") schreiben Anfang und Ende einer
+// Strecke mit Zeitstempel, Kern und Task in einen festen Ring im RAM; GET /mydbg_trace.json liefert ihn als
+// Chrome-Trace-JSON (chrome://tracing, ui.perfetto.dev). Ein Ereignis kostet einen Zeitstempel, ein fetch_add und
+// 16 Byte schreiben – ohne Sperre und ohne Heap, auch aus Interrupts. Bei vollem Ring wird das älteste überschrieben.
+// name muss ein Stringliteral sein, gespeichert wird nur der Zeiger.
+static_assert((MYDBG_TRACE_EINTRAEGE & (MYDBG_TRACE_EINTRAEGE - 1)) == 0, "MYDBG_TRACE_EINTRAEGE muss eine Zweierpotenz sein");
+#define MYDBG_TRACE_TASKS 16    // Tasks mit eigenem Namen im Trace, weitere erscheinen als "andere"
+#define MYDBG_TRACE_ISR 0xFF    // Ereignis aus einer Interrupt-Routine
+
+struct MYDBG_TraceEreignis
+{
+    const char *name;
+    uint32_t mikros;          // untere 32 Bit von esp_timer_get_time(), beim Export wieder ergänzt
+    std::atomic<uint32_t> nr; // Position + 1, sobald vollständig geschrieben; 0 = wird gerade geschrieben
+    char art;                 // 'B' oder 'E'
+    uint8_t kern;
+    uint8_t task;             // Index in MYDBG_traceTasks, MYDBG_TRACE_TASKS = andere, MYDBG_TRACE_ISR
+}; // Ende der Struktur MYDBG_TraceEreignis
+
+struct MYDBG_TraceTask
+{
+    TaskHandle_t handle;
+    char name[16];
+}; // Ende der Struktur MYDBG_TraceTask
+
+inline bool MYDBG_traceAktiv = true; // zur Laufzeit abschaltbar, die Aufrufe kosten dann nur die Abfrage
+inline MYDBG_TraceEreignis MYDBG_traceRing[MYDBG_TRACE_EINTRAEGE];
+inline std::atomic<uint32_t> MYDBG_traceKopf{0}; // nächste Position
+inline uint32_t MYDBG_traceAb = 0;               // ältere Ereignisse gelten nach MYDBG_traceLeeren() als gelöscht
+inline MYDBG_TraceTask MYDBG_traceTasks[MYDBG_TRACE_TASKS];
+inline std::atomic<uint8_t> MYDBG_traceTaskAnzahl{0};
+inline portMUX_TYPE MYDBG_traceMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Index des laufenden Tasks; der Name wird beim ersten Ereignis eines Tasks einmal kopiert
+inline uint8_t IRAM_ATTR MYDBG_traceTask()
+{
+    if (xPortInIsrContext())
+        return MYDBG_TRACE_ISR;
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    uint8_t anzahl = MYDBG_traceTaskAnzahl.load(std::memory_order_acquire);
+    for (uint8_t i = 0; i < anzahl; i++)
+    {
+        if (MYDBG_traceTasks[i].handle == task)
+            return i;
+    }
+    uint8_t nr = MYDBG_TRACE_TASKS;
+    portENTER_CRITICAL(&MYDBG_traceMux);
+    anzahl = MYDBG_traceTaskAnzahl.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < anzahl && nr == MYDBG_TRACE_TASKS; i++)
+    {
+        if (MYDBG_traceTasks[i].handle == task)
+            nr = i;
+    }
+    if (nr == MYDBG_TRACE_TASKS && anzahl < MYDBG_TRACE_TASKS)
+    {
+        nr = anzahl;
+        MYDBG_traceTasks[nr].handle = task;
+        MYDBG_kopiere(MYDBG_traceTasks[nr].name, sizeof(MYDBG_traceTasks[nr].name), pcTaskGetName(nullptr));
+        MYDBG_traceTaskAnzahl.store(anzahl + 1, std::memory_order_release);
+    }
+    portEXIT_CRITICAL(&MYDBG_traceMux);
+    return nr;
+} // Ende der Funktion MYDBG_traceTask
+
+inline void IRAM_ATTR MYDBG_traceSchreiben(const char *name, char art)
+{
+    if (!MYDBG_traceAktiv)
+        return;
+    uint32_t mikros = (uint32_t)esp_timer_get_time();
+    uint8_t task = MYDBG_traceTask();
+    uint32_t pos = MYDBG_traceKopf.fetch_add(1, std::memory_order_relaxed);
+    MYDBG_TraceEreignis &e = MYDBG_traceRing[pos % MYDBG_TRACE_EINTRAEGE];
+    // Wie ein Seqlock: der Export übernimmt ein Ereignis nur, wenn nr vor und nach dem Kopieren stimmt
+    e.nr.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    e.name = name;
+    e.mikros = mikros;
+    e.art = art;
+    e.kern = (uint8_t)xPortGetCoreID();
+    e.task = task;
+    e.nr.store(pos + 1, std::memory_order_release);
+} // Ende der Funktion MYDBG_traceSchreiben
+
+// Kopiert das Ereignis an Position pos; false, wenn es überschrieben wurde oder gerade geschrieben wird
+inline bool MYDBG_traceLesen(uint32_t pos, MYDBG_TraceEreignis &kopie)
+{
+    MYDBG_TraceEreignis &e = MYDBG_traceRing[pos % MYDBG_TRACE_EINTRAEGE];
+    if (e.nr.load(std::memory_order_acquire) != pos + 1)
+        return false;
+    kopie.name = e.name;
+    kopie.mikros = e.mikros;
+    kopie.art = e.art;
+    kopie.kern = e.kern;
+    kopie.task = e.task;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return e.nr.load(std::memory_order_relaxed) == pos + 1;
+} // Ende der Funktion MYDBG_traceLesen
+
+// Verwirft alle bisherigen Ereignisse (z. B. vor einer gezielten Aufnahme)
+inline void MYDBG_traceLeeren()
+{
+    MYDBG_traceAb = MYDBG_traceKopf.load(std::memory_order_relaxed);
+} // Ende der Funktion MYDBG_traceLeeren
+
+// Schreibt das Ende beim Verlassen des Blocks
+struct MYDBG_TraceScope
+{
+    const char *name;
+
+    explicit MYDBG_TraceScope(const char *n) : name(n) { MYDBG_traceSchreiben(name, 'B'); }
+    ~MYDBG_TraceScope() { MYDBG_traceSchreiben(name, 'E'); }
+    MYDBG_TraceScope(const MYDBG_TraceScope &) = delete;
+    MYDBG_TraceScope &operator=(const MYDBG_TraceScope &) = delete;
+}; // Ende der Struktur MYDBG_TraceScope
+
+#ifndef MYDBG_OHNE_TRACE
+#define MYDBG_TRACE_BEGIN(name) MYDBG_traceSchreiben(name, 'B')
+#define MYDBG_TRACE_END(name) MYDBG_traceSchreiben(name, 'E')
+#define MYDBG_TRACE_SCOPE(name) MYDBG_TraceScope MYDBG_VERBINDEN(__mydbg_trace_, __LINE__)(name)
+#else
+#define MYDBG_TRACE_BEGIN(name) MYDBG_ENTFERNT(name)
+#define MYDBG_TRACE_END(name) MYDBG_ENTFERNT(name)
+#define MYDBG_TRACE_SCOPE(name) MYDBG_ENTFERNT(name)
+#endif
+
+// Übernimmt den Wert einer Variable typgerecht als Rohwert (Formatierung erst bei der Ausgabe)
+template <typename T>
+inline MYDBG_Wert MYDBG_wert(const T &var)
+{
+    MYDBG_Wert w;
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        w.typ = MYDBG_TYP_BOOL;
+        w.daten.u = var ? 1 : 0;
+    }
+    else if constexpr (std::is_same<T, char>::value)
+    {
+        w.typ = MYDBG_TYP_TEXT;
+        w.daten.text[0] = var;
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        w.typ = MYDBG_TYP_INT;
+        w.daten.i = (int64_t)var;
+    }
+    else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value)
+    {
+        w.typ = MYDBG_TYP_INT;
+        w.daten.i = var;
+    }
+    else if constexpr (std::is_integral<T>::value)
+    {
+        w.typ = MYDBG_TYP_UINT;
+        w.daten.u = var;
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        w.typ = MYDBG_TYP_FLOAT;
+        w.daten.f = var;
+    }
+    else if constexpr (std::is_convertible<T, const char *>::value)
+    {
+        w.typ = MYDBG_TYP_TEXT;
+        MYDBG_kopiere(w.daten.text, sizeof(w.daten.text), var);
+    }
+    else if constexpr (std::is_same<T, String>::value)
+    {
+        w.typ = MYDBG_TYP_TEXT;
+        MYDBG_kopiere(w.daten.text, sizeof(w.daten.text), var.c_str());
+    }
+    else
+    {
+        w.typ = MYDBG_TYP_TEXT; // sonstige Typen (z. B. IPAddress) über String – nur hier wird Heap benutzt
+        MYDBG_kopiere(w.daten.text, sizeof(w.daten.text), String(var).c_str());
+    }
+    return w;
+} // Ende der Funktion MYDBG_wert
+
+// diese Funktion gibt den Resetgrund aus
+inline void MYDBG_fillResetInfo(JsonObject &doc, bool mitFarbe = true)
+{
+    esp_reset_reason_t rsn = MYDBG_resetGrund();
+    MYDBG_ResetInfo info = MYDBG_interpretResetReason(rsn);
+    doc["resetReason"] = (int)rsn;
+    doc["ResetGrund"] = info.text;
+    if (mitFarbe)
+        doc["ResetColor"] = info.farbe;
+} // Ende der Funktion MYDBG_fillResetInfo
+
+// === Ausgabesperre ===
+// Sperre für Konsole, Dateisystem und WebSocket: Einträge aus mehreren Tasks werden nacheinander ausgegeben.
+// Auch wer den Log-Speicher aus einem anderen Task liest, löscht oder neu aufsetzt (Webserver, Konsolenmenü),
+// hält sie. Rekursiv, damit verschachtelte Aufrufe im selben Task nicht hängen; nie aus einer ISR verwenden.
+inline SemaphoreHandle_t MYDBG_ausgabeSperre()
+{
+    static SemaphoreHandle_t sperre = xSemaphoreCreateRecursiveMutex();
+    return sperre;
+} // Ende der Funktion MYDBG_ausgabeSperre
+
+struct MYDBG_Sperre
+{
+    MYDBG_Sperre() { xSemaphoreTakeRecursive(MYDBG_ausgabeSperre(), portMAX_DELAY); }
+    ~MYDBG_Sperre() { xSemaphoreGiveRecursive(MYDBG_ausgabeSperre()); }
+    MYDBG_Sperre(const MYDBG_Sperre &) = delete;
+    MYDBG_Sperre &operator=(const MYDBG_Sperre &) = delete;
+}; // Ende der Struktur MYDBG_Sperre
+
+// === Binärer Log-Speicher in Segmenten ===
+// LittleFS arbeitet copy-on-write: wird mitten in einer Datei überschrieben, kopiert es den ganzen Rest der Datei.
+// Einträge werden deshalb nur an das jüngste Segment /mydbg/seg_NNNN angehängt. Ältere Segmente werden nie mehr
+// verändert, sondern nur als Ganzes gelöscht, sobald das Budget (Anteil der Partition) erreicht ist.
+// /mydbg/manifest.bin merkt sich den Bereich der Segmentnummern und das zur Laufzeit eingestellte Budget.
+#define MYDBG_SEG_VERZEICHNIS "/mydbg"
+#define MYDBG_SEG_MANIFEST "/mydbg/manifest.bin"
+#define MYDBG_RING_MAGIC 0x4742444Du     // "MDBG"
+#define MYDBG_MANIFEST_MAGIC 0x5347444Du // "MDGS"
+#define MYDBG_RING_VERSION 3
+#define MYDBG_SEGZ_MAGIC 0x5A42444Du // "MDBZ" – gepacktes Segment
+#define MYDBG_SEG_TEMP "/mydbg/pack.tmp"
+#define MYDBG_ZEIT_GUELTIG_AB 1577836800 // 01.01.2020, davor gilt die Uhr als nicht gestellt
+#define MYDBG_CHUNK_ZEILE 1024 // muss den längsten JSON-Eintrag fassen, siehe MYDBG_JSON_EINTRAG_MAX
+#define MYDBG_SITES_DATEI "/mydbg_sites.bin"
+
+// Dateikopf jedes Segments, wird nur beim Anlegen geschrieben
+struct MYDBG_RingHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t firstSeq; // Sequenznummer des ersten Eintrags dieses Segments
+}; // Ende der Struktur MYDBG_RingHeader
+
+// Gepacktes Segment: Kopf mit MYDBG_SEGZ_MAGIC, danach dieser Zusatzkopf, die gepackten Blöcke und am Dateiende
+// eine Tabelle mit dem Endoffset jedes Blocks (uint32_t je Block). Jeder Block ist für sich entpackbar.
+struct MYDBG_SegZKopf
+{
+    uint32_t anzahl; // Einträge im Segment
+    uint16_t bloecke;
+    uint16_t jeBlock; // Einträge je Block
+}; // Ende der Struktur MYDBG_SegZKopf
+
+// Ergebnis von MYDBG_segKopfLesen()
+struct MYDBG_SegInfo
+{
+    MYDBG_RingHeader kopf;
+    MYDBG_SegZKopf z;
+    uint32_t anzahl = 0;
+    size_t groesse = 0;
+    bool ausgerichtet = false; // false = letzter Eintrag nur halb geschrieben
+    bool komprimiert = false;
+}; // Ende der Struktur MYDBG_SegInfo
+
+// Inhalt von /mydbg/manifest.bin, wird nur beim Anlegen eines Segments und beim Ändern des Budgets geschrieben
+struct MYDBG_SegManifest
+{
+    uint32_t magic;
+    uint16_t version;
+    uint8_t budgetProzent;
+    uint8_t reserve;
+    uint32_t ersteNr; // ältestes Segment
+    uint32_t letzteNr; // jüngstes Segment
+}; // Ende der Struktur MYDBG_SegManifest
+
+// Zustand des Log-Speichers im RAM, wird beim Start aus Manifest und Segmentköpfen rekonstruiert
+struct MYDBG_RingState
+{
+    bool bereit = false;
+    uint32_t nextSeq = 1;         // Sequenznummer des nächsten Eintrags
+    uint32_t ersteSeq = 1;        // ältester gespeicherter Eintrag
+    uint32_t ersteNr = 1;         // ältestes Segment
+    uint32_t letzteNr = 0;        // jüngstes Segment, hier wird angehängt (letzteNr < ersteNr = keine Segmente)
+    uint32_t firstSeqAktuell = 1; // erster Eintrag des jüngsten Segments
+    uint32_t anzahlAktuell = 0;
+    uint8_t budgetProzent = MYDBG_LOG_BUDGET_PROZENT;
+    uint32_t belegt = 0;          // Flash aller Segmente in ganzen Blöcken, das jüngste zählt mit voller Größe
+    uint32_t packNr = 0;          // nächstes Segment, das die Hintergrundarbeit zu packen versucht
+    File datei; // jüngstes Segment, bleibt zum Anhängen geöffnet
+
+    uint32_t segmente() const { return letzteNr >= ersteNr ? letzteNr - ersteNr + 1 : 0; }
+}; // Ende der Struktur MYDBG_RingState
+inline MYDBG_RingState MYDBG_ring;
+
+// === Zeit ===
+// Einträge tragen nur die monotone Zeit seit Start (esp_timer, µs) und die Startnummer.
+// Sobald SNTP die Uhr stellt, wird je Start ein Zeitanker (Unix-Zeit minus monotone Zeit) gemerkt
+// und in /mydbg_zeit.bin abgelegt. Die Uhrzeit eines Eintrags entsteht erst bei der Ausgabe –
+// damit bekommen auch Einträge von vor der Synchronisation und aus früheren Starts die richtige Zeit.
+#define MYDBG_ZEIT_DATEI "/mydbg_zeit.bin"
+#define MYDBG_MAX_STARTS 16 // Zeitanker der letzten Starts
+
+struct MYDBG_ZeitAnker
+{
+    uint16_t boot;
+    uint16_t reserve;
+    uint32_t reserve2;
+    int64_t offsetUs; // Unix-Zeit in µs minus esp_timer_get_time(), 0 = Uhr in diesem Start nicht gestellt
+}; // Ende der Struktur MYDBG_ZeitAnker
+
+struct MYDBG_ZeitZustand
+{
+    MYDBG_ZeitAnker anker[MYDBG_MAX_STARTS];
+    uint8_t anzahl = 0;
+    uint16_t boot = 0;              // Startnummer dieses Laufs, 0 = noch nicht geladen
+    std::atomic<int64_t> offsetUs{0}; // Zeitanker dieses Laufs; setzt der Netzwerk-Task, 64 Bit am Stück nur atomar
+    std::atomic<bool> geaendert{false}; // Anker muss noch gespeichert werden
+    bool sntpGestartet = false;
+    int64_t gesendetUs = 0; // zuletzt als Binärrahmen gesendeter Anker
+}; // Ende der Struktur MYDBG_ZeitZustand
+
+inline MYDBG_ZeitZustand MYDBG_zeit;
+
+// Übernimmt die gestellte Uhr als Zeitanker dieses Starts
+inline void MYDBG_zeitUebernehmen()
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec < MYDBG_ZEIT_GUELTIG_AB)
+        return;
+    MYDBG_zeit.offsetUs.store((int64_t)tv.tv_sec * 1000000LL + tv.tv_usec - esp_timer_get_time(), std::memory_order_relaxed);
+    MYDBG_zeit.geaendert.store(true, std::memory_order_release);
+    MYDBG_timeInitDone = true;
+} // Ende der Funktion MYDBG_zeitUebernehmen
+
+// SNTP-Rückruf: läuft im Netzwerk-Task, schreibt deshalb nicht selbst ins Dateisystem
+inline void MYDBG_zeitSynchronisiert(struct timeval *)
+{
+    bool erstesMal = !MYDBG_timeInitDone;
+    MYDBG_zeitUebernehmen();
+    if (erstesMal && MYDBG_timeInitDone)
+        Serial.println("[MYDBG] ⏰ Zeit über NTP synchronisiert.");
+} // Ende der Funktion MYDBG_zeitSynchronisiert
+
+// Liest die Zeitanker früherer Starts und vergibt die Startnummer dieses Laufs
+inline void MYDBG_zeitLaden()
+{
+    if (MYDBG_zeit.boot != 0)
+        return;
+    MYDBG_zeit.anzahl = 0;
+    File f = LittleFS.open(MYDBG_ZEIT_DATEI, "r");
+    if (f)
+    {
+        while (MYDBG_zeit.anzahl < MYDBG_MAX_STARTS &&
+               f.read((uint8_t *)&MYDBG_zeit.anker[MYDBG_zeit.anzahl], sizeof(MYDBG_ZeitAnker)) == sizeof(MYDBG_ZeitAnker))
+            MYDBG_zeit.anzahl++;
+        f.close();
+    }
+    uint16_t boot = MYDBG_zeit.anzahl ? MYDBG_zeit.anker[MYDBG_zeit.anzahl - 1].boot + 1 : 1;
+    MYDBG_zeit.boot = boot ? boot : 1;
+    if (MYDBG_zeit.anzahl == MYDBG_MAX_STARTS)
+    {
+        memmove(MYDBG_zeit.anker, MYDBG_zeit.anker + 1, sizeof(MYDBG_ZeitAnker) * (MYDBG_MAX_STARTS - 1));
+        MYDBG_zeit.anzahl--;
+    }
+    MYDBG_zeit.anker[MYDBG_zeit.anzahl++] = {MYDBG_zeit.boot, 0, 0, 0};
+    MYDBG_zeit.geaendert.store(true, std::memory_order_release);
+    MYDBG_zeitUebernehmen(); // Uhr evtl. schon gestellt (RTC, eigenes configTime)
+} // Ende der Funktion MYDBG_zeitLaden
+
+// Schreibt geänderte Zeitanker (Hintergrund: Ausgabe-Task bzw. Pause von MYDBG(n, ...))
+inline void MYDBG_zeitSpeichern()
+{
+    if (!MYDBG_zeit.geaendert.load(std::memory_order_acquire) || MYDBG_zeit.boot == 0 || !MYDBG_filesystemReady)
+        return;
+    MYDBG_zeit.geaendert.store(false, std::memory_order_relaxed);
+    MYDBG_zeit.anker[MYDBG_zeit.anzahl - 1].offsetUs = MYDBG_zeit.offsetUs.load(std::memory_order_relaxed);
+    File f = LittleFS.open(MYDBG_ZEIT_DATEI, "w");
+    if (!f)
+        return;
+    f.write((const uint8_t *)MYDBG_zeit.anker, sizeof(MYDBG_ZeitAnker) * MYDBG_zeit.anzahl);
+    f.close();
+} // Ende der Funktion MYDBG_zeitSpeichern
+
+#ifdef MYDBG_SERIAL_BINAER
+// Sendet den Zeitanker als Binärrahmen A5 5C Länge Anker, sobald er sich geändert hat
+inline void MYDBG_serialAnker()
+{
+    int64_t offsetUs = MYDBG_zeit.offsetUs.load(std::memory_order_relaxed);
+    if (offsetUs == MYDBG_zeit.gesendetUs)
+        return;
+    MYDBG_ZeitAnker anker = {MYDBG_zeit.boot, 0, 0, offsetUs};
+    uint8_t kopf[3] = {0xA5, 0x5C, (uint8_t)sizeof(anker)};
+    Serial.write(kopf, sizeof(kopf));
+    Serial.write((const uint8_t *)&anker, sizeof(anker));
+    MYDBG_zeit.gesendetUs = anker.offsetUs;
+} // Ende der Funktion MYDBG_serialAnker
+#endif
+
+// Hintergrundarbeit: Uhr ohne SNTP-Rückruf gestellt (z. B. settimeofday) übernehmen, Anker speichern
+inline void MYDBG_zeitPflegen()
+{
+    if (MYDBG_zeit.offsetUs.load(std::memory_order_relaxed) == 0 && MYDBG_zeit.boot != 0)
+        MYDBG_zeitUebernehmen();
+    MYDBG_zeitSpeichern();
+#ifdef MYDBG_SERIAL_BINAER
+    MYDBG_serialAnker();
+#endif
+} // Ende der Funktion MYDBG_zeitPflegen
+
+// Zeitanker eines Starts, 0 = unbekannt
+inline int64_t MYDBG_zeitOffset(uint16_t boot)
+{
+    if (boot == MYDBG_zeit.boot)
+        return MYDBG_zeit.offsetUs.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < MYDBG_zeit.anzahl; i++)
+    {
+        if (MYDBG_zeit.anker[i].boot == boot)
+            return MYDBG_zeit.anker[i].offsetUs;
+    }
+    return 0;
+} // Ende der Funktion MYDBG_zeitOffset
+
+// Unix-Zeit eines Eintrags oder 0, wenn die Uhr in seinem Start nie gestellt wurde
+inline uint32_t MYDBG_unixZeit(const MYDBG_LogRecord &rec)
+{
+    int64_t offset = MYDBG_zeitOffset(rec.boot);
+    if (offset == 0)
+        return 0;
+    int64_t zeit = ((int64_t)rec.mikros + offset) / 1000000LL;
+    return zeit >= MYDBG_ZEIT_GUELTIG_AB ? (uint32_t)zeit : 0;
+} // Ende der Funktion MYDBG_unixZeit
+
+// Formatiert eine Unix-Zeit wie MYDBG_getTimestamp()
+inline void MYDBG_formatZeit(uint32_t zeit, char *buf, size_t groesse)
+{
+    if (zeit == 0)
+    {
+        MYDBG_kopiere(buf, groesse, "[keine Zeit]");
+        return;
+    }
+    time_t t = (time_t)zeit;
+    struct tm timeinfo;
+    localtime_r(&t, &timeinfo);
+    strftime(buf, groesse, "%Y-%m-%d %H:%M:%S", &timeinfo);
+} // Ende der Funktion MYDBG_formatZeit
+
+// === Aufrufstellen (Sites) ===
+// Registrierte Aufrufstellen bilden eine verkettete Liste im RAM. Stellen, deren Einträge im Ringpuffer landen,
+// werden einmalig in /mydbg_sites.bin abgelegt, damit alte Einträge auch nach einem Neustart lesbar bleiben.
+// Format je Stelle: id (4) | zeile (2) | typ (1) | Längen func/msg/var (je 1) | Texte ohne Nullbyte
+#define MYDBG_SITE_KOPF 10
+#define MYDBG_SITE_TEXT_MAX 120
+
+inline std::atomic<MYDBG_Site *> MYDBG_siteListe{nullptr}; // Leser laufen ohne Sperre die Liste entlang
+inline portMUX_TYPE MYDBG_siteMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Index von /mydbg_sites.bin: ID → Position in der Datei
+struct MYDBG_SiteIndexEintrag
+{
+    uint32_t id;
+    uint32_t offset;
+};
+inline MYDBG_SiteIndexEintrag MYDBG_siteIndex[MYDBG_MAX_SITES];
+inline uint16_t MYDBG_siteIndexAnzahl = 0;
+inline bool MYDBG_siteIndexGeladen = false;
+
+// Lesbare Form eines Eintrags: Texte der Aufrufstelle und formatierter Wert
+struct MYDBG_Klartext
+{
+    const char *func = "?";
+    const char *msg = "?";
+    const char *varName = "";
+    uint16_t zeile = 0;
+    uint8_t typ = MYDBG_TYP_KEIN; // Typ des Werts an dieser Stelle
+    char varValue[32];
+    char puffer[3 * (MYDBG_SITE_TEXT_MAX + 1)]; // Texte einer nur aus der Datei bekannten Aufrufstelle
+}; // Ende der Struktur MYDBG_Klartext
+
+// FNV-1a über einen Text, mit Trennzeichen
+inline uint32_t MYDBG_fnv(uint32_t h, const char *text)
+{
+    for (; text && *text; text++)
+    {
+        h ^= (uint8_t)*text;
+        h *= 16777619u;
+    }
+    h ^= 0xFF;
+    return h * 16777619u;
+} // Ende der Funktion MYDBG_fnv
+
+// Stabile ID einer Aufrufstelle: gleich bei jedem Start derselben Firmware
+inline uint32_t MYDBG_siteHash(const MYDBG_Site &site)
+{
+    uint32_t h = 2166136261u;
+    h = MYDBG_fnv(h, site.func);
+    h = MYDBG_fnv(h, site.msg);
+    h = MYDBG_fnv(h, site.varName);
+    h = (h ^ site.zeile) * 16777619u;
+    return h ? h : 1;
+} // Ende der Funktion MYDBG_siteHash
+
+// Trägt eine Aufrufstelle beim ersten Durchlauf in die Liste ein
+inline void MYDBG_siteRegistrieren(MYDBG_Site &site, uint8_t typ)
+{
+    uint32_t id = MYDBG_siteHash(site);
+    portENTER_CRITICAL(&MYDBG_siteMux);
+    if (site.id == 0)
+    {
+        site.typ = typ;
+        site.id = id;
+        site.naechste = MYDBG_siteListe;
+        MYDBG_siteListe = &site; // erst vollständig, dann sichtbar
+    }
+    portEXIT_CRITICAL(&MYDBG_siteMux);
+} // Ende der Funktion MYDBG_siteRegistrieren
+
+// Sucht eine Aufrufstelle dieses Laufs über ihre ID
+inline MYDBG_Site *MYDBG_siteSuchen(uint32_t id)
+{
+    for (MYDBG_Site *site = MYDBG_siteListe; site; site = site->naechste)
+    {
+        if (site->id == id)
+            return site;
+    }
+    return nullptr;
+} // Ende der Funktion MYDBG_siteSuchen
+
+// Kodiert eine Aufrufstelle im Format von /mydbg_sites.bin
+inline size_t MYDBG_siteKodieren(const MYDBG_Site &site, uint8_t *buf)
+{
+    const char *texte[3] = {site.func, site.msg, site.varName};
+    size_t n = MYDBG_SITE_KOPF;
+    memcpy(buf, &site.id, 4);
+    memcpy(buf + 4, &site.zeile, 2);
+    buf[6] = site.typ;
+    for (int i = 0; i < 3; i++)
+    {
+        size_t laenge = min(strlen(texte[i] ? texte[i] : ""), (size_t)MYDBG_SITE_TEXT_MAX);
+        buf[7 + i] = (uint8_t)laenge;
+        memcpy(buf + n, texte[i], laenge);
+        n += laenge;
+    }
+    return n;
+} // Ende der Funktion MYDBG_siteKodieren
+
+// Liest den Index von /mydbg_sites.bin (einmalig beim Start)
+inline void MYDBG_siteIndexLaden()
+{
+    MYDBG_siteIndexAnzahl = 0;
+    MYDBG_siteIndexGeladen = true;
+    File f = LittleFS.open(MYDBG_SITES_DATEI, "r");
+    if (!f)
+        return;
+    uint8_t kopf[MYDBG_SITE_KOPF];
+    uint32_t offset = 0;
+    while (f.read(kopf, sizeof(kopf)) == sizeof(kopf))
+    {
+        uint32_t laenge = MYDBG_SITE_KOPF + kopf[7] + kopf[8] + kopf[9];
+        if (MYDBG_siteIndexAnzahl < MYDBG_MAX_SITES)
+        {
+            memcpy(&MYDBG_siteIndex[MYDBG_siteIndexAnzahl].id, kopf, 4);
+            MYDBG_siteIndex[MYDBG_siteIndexAnzahl].offset = offset;
+            MYDBG_siteIndexAnzahl++;
+        }
+        offset += laenge;
+        if (!f.seek(offset))
+            break;
+    }
+    f.close();
+} // Ende der Funktion MYDBG_siteIndexLaden
+
+// Position einer Aufrufstelle in /mydbg_sites.bin, -1 = unbekannt
+inline int32_t MYDBG_siteIndexFinden(uint32_t id)
+{
+    if (!MYDBG_siteIndexGeladen)
+        MYDBG_siteIndexLaden();
+    for (uint16_t i = 0; i < MYDBG_siteIndexAnzahl; i++)
+    {
+        if (MYDBG_siteIndex[i].id == id)
+            return (int32_t)MYDBG_siteIndex[i].offset;
+    }
+    return -1;
+} // Ende der Funktion MYDBG_siteIndexFinden
+
+// Legt eine Aufrufstelle einmalig in /mydbg_sites.bin ab (bekannte Stellen aus früheren Läufen werden übersprungen)
+inline void MYDBG_siteSpeichern(MYDBG_Site &site)
+{
+    if (site.status & MYDBG_SITE_GESPEICHERT)
+        return;
+    site.status |= MYDBG_SITE_GESPEICHERT;
+    if (MYDBG_siteIndexFinden(site.id) >= 0)
+        return;
+    if (MYDBG_siteIndexAnzahl >= MYDBG_MAX_SITES)
+        return; // ohne Indexplatz wäre die Stelle nach dem Neustart nicht auffindbar und würde jedes Mal neu angehängt
+
+    uint8_t buf[MYDBG_SITE_KOPF + 3 * MYDBG_SITE_TEXT_MAX];
+    size_t laenge = MYDBG_siteKodieren(site, buf);
+    File f = LittleFS.open(MYDBG_SITES_DATEI, "a");
+    if (!f)
+        return;
+    uint32_t offset = f.size();
+    f.write(buf, laenge);
+    f.close();
+    MYDBG_siteIndex[MYDBG_siteIndexAnzahl].id = site.id;
+    MYDBG_siteIndex[MYDBG_siteIndexAnzahl].offset = offset;
+    MYDBG_siteIndexAnzahl++;
+} // Ende der Funktion MYDBG_siteSpeichern
+
+// Liest die Texte einer Aufrufstelle aus /mydbg_sites.bin in den Klartext-Puffer
+inline bool MYDBG_siteLaden(uint32_t id, MYDBG_Klartext &k)
+{
+    int32_t offset = MYDBG_siteIndexFinden(id);
+    if (offset < 0)
+        return false;
+    File f = LittleFS.open(MYDBG_SITES_DATEI, "r");
+    if (!f)
+        return false;
+    uint8_t kopf[MYDBG_SITE_KOPF];
+    bool ok = f.seek(offset) && f.read(kopf, sizeof(kopf)) == sizeof(kopf);
+    char *ziel = k.puffer;
+    const char **texte[3] = {&k.func, &k.msg, &k.varName};
+    for (int i = 0; ok && i < 3; i++)
+    {
+        ok = f.read((uint8_t *)ziel, kopf[7 + i]) == kopf[7 + i];
+        ziel[kopf[7 + i]] = '\0';
+        *texte[i] = ziel;
+        ziel += kopf[7 + i] + 1;
+    }
+    f.close();
+    if (ok)
+    {
+        memcpy(&k.zeile, kopf + 4, 2);
+        k.typ = kopf[6];
+    }
+    return ok;
+} // Ende der Funktion MYDBG_siteLaden
+
+// Formatiert einen Rohwert als Text
+inline void MYDBG_wertText(uint8_t typ, const MYDBG_WertDaten &w, char *buf, size_t groesse)
+{
+    switch (typ)
+    {
+    case MYDBG_TYP_INT:
+        snprintf(buf, groesse, "%lld", (long long)w.i);
+        break;
+    case MYDBG_TYP_UINT:
+        snprintf(buf, groesse, "%llu", (unsigned long long)w.u);
+        break;
+    case MYDBG_TYP_FLOAT:
+        snprintf(buf, groesse, "%.2f", w.f);
+        break;
+    case MYDBG_TYP_BOOL:
+        snprintf(buf, groesse, "%u", w.u ? 1 : 0);
+        break;
+    case MYDBG_TYP_TEXT:
+        MYDBG_kopiere(buf, groesse, w.text);
+        break;
+    default:
+        buf[0] = '\0';
+        break;
+    }
+} // Ende der Funktion MYDBG_wertText
+
+// Texte einer Aufrufstelle: aus der Liste dieses Laufs, sonst aus /mydbg_sites.bin
+inline void MYDBG_siteTexte(uint32_t id, MYDBG_Klartext &k)
+{
+    const MYDBG_Site *site = MYDBG_siteSuchen(id);
+    if (site)
+    {
+        k.func = site->func;
+        k.msg = site->msg;
+        k.varName = site->varName;
+        k.zeile = site->zeile;
+        k.typ = site->typ;
+    }
+    else
+    {
+        MYDBG_siteLaden(id, k);
+    }
+} // Ende der Funktion MYDBG_siteTexte
+
+// Setzt Texte der Aufrufstelle und formatierten Wert eines Eintrags zusammen
+inline void MYDBG_klartext(const MYDBG_LogRecord &rec, MYDBG_Klartext &k)
+{
+    MYDBG_siteTexte(rec.site, k);
+    MYDBG_wertText(rec.typ, rec.wert, k.varValue, sizeof(k.varValue));
+} // Ende der Funktion MYDBG_klartext
+
+// Pfad eines Segments, z. B. /mydbg/seg_0042
+inline void MYDBG_segPfad(char *buf, size_t groesse, uint32_t nr)
+{
+    snprintf(buf, groesse, MYDBG_SEG_VERZEICHNIS "/seg_%04u", (unsigned)nr);
+} // Ende der Funktion MYDBG_segPfad
+
+// Prüft den Kopf eines Segments und ermittelt die Anzahl vollständiger Einträge
+inline bool MYDBG_segKopfLesen(uint32_t nr, MYDBG_SegInfo &info)
+{
+    info = MYDBG_SegInfo();
+    char pfad[32];
+    MYDBG_segPfad(pfad, sizeof(pfad), nr);
+    if (!LittleFS.exists(pfad))
+        return false;
+    File f = LittleFS.open(pfad, "r");
+    if (!f)
+        return false;
+
+    MYDBG_RingHeader &kopf = info.kopf;
+    info.groesse = f.size();
+    bool ok = f.read((uint8_t *)&kopf, sizeof(kopf)) == sizeof(kopf) &&
+              (kopf.magic == MYDBG_RING_MAGIC || kopf.magic == MYDBG_SEGZ_MAGIC) &&
+              kopf.version == MYDBG_RING_VERSION &&
+              kopf.recordSize == sizeof(MYDBG_LogRecord);
+    if (ok && kopf.magic == MYDBG_SEGZ_MAGIC)
+    {
+        MYDBG_SegZKopf &z = info.z;
+        ok = f.read((uint8_t *)&z, sizeof(z)) == sizeof(z) &&
+             z.jeBlock > 0 && z.jeBlock <= MYDBG_Z_BLOCK_EINTRAEGE &&
+             z.bloecke == (z.anzahl + z.jeBlock - 1) / z.jeBlock &&
+             info.groesse >= sizeof(kopf) + sizeof(z) + z.bloecke * sizeof(uint32_t);
+        info.anzahl = z.anzahl;
+        info.ausgerichtet = true;
+        info.komprimiert = true;
+    }
+    else if (ok)
+    {
+        size_t daten = info.groesse - sizeof(kopf);
+        info.anzahl = daten / sizeof(MYDBG_LogRecord);
+        info.ausgerichtet = (daten % sizeof(MYDBG_LogRecord)) == 0; // sonst wurde ein Eintrag nur halb geschrieben
+    }
+    f.close();
+    return ok;
+} // Ende der Funktion MYDBG_segKopfLesen
+
+inline void MYDBG_segManifestSchreiben()
+{
+    MYDBG_SegManifest m = {MYDBG_MANIFEST_MAGIC, MYDBG_RING_VERSION, MYDBG_ring.budgetProzent, 0, MYDBG_ring.ersteNr, MYDBG_ring.letzteNr};
+    File f = LittleFS.open(MYDBG_SEG_MANIFEST, "w");
+    if (!f)
+        return;
+    f.write((const uint8_t *)&m, sizeof(m));
+    f.close();
+} // Ende der Funktion MYDBG_segManifestSchreiben
+
+// Dateigröße auf ganze LittleFS-Blöcke aufgerundet
+inline uint32_t MYDBG_fsBloecke(size_t bytes)
+{
+    return (bytes + MYDBG_FS_BLOCK - 1) / MYDBG_FS_BLOCK * MYDBG_FS_BLOCK;
+} // Ende der Funktion MYDBG_fsBloecke
+
+// Flash, den ein volles ungepacktes Segment belegt
+inline uint32_t MYDBG_segVoll()
+{
+    return MYDBG_fsBloecke(sizeof(MYDBG_RingHeader) + MYDBG_SEGMENT_EINTRAEGE * sizeof(MYDBG_LogRecord));
+} // Ende der Funktion MYDBG_segVoll
+
+// Byte, die das Budget den Segmenten erlaubt
+inline uint32_t MYDBG_segBudget()
+{
+    return (uint64_t)LittleFS.totalBytes() * MYDBG_ring.budgetProzent / 100;
+} // Ende der Funktion MYDBG_segBudget
+
+// Löscht die ältesten Segmente, bis das Budget eingehalten ist – mindestens zwei bleiben,
+// damit nach dem Löschen noch Verlauf übrig ist
+inline bool MYDBG_segKuerzen()
+{
+    uint32_t budget = MYDBG_segBudget();
+    if (MYDBG_ring.segmente() <= 2 || MYDBG_ring.belegt <= budget)
+        return false;
+    char pfad[32];
+    MYDBG_SegInfo info;
+    while (MYDBG_ring.segmente() > 2 && MYDBG_ring.belegt > budget)
+    {
+        MYDBG_segPfad(pfad, sizeof(pfad), MYDBG_ring.ersteNr);
+        File f = LittleFS.open(pfad, "r");
+        uint32_t bytes = f ? MYDBG_fsBloecke(f.size()) : 0;
+        if (f)
+            f.close();
+        LittleFS.remove(pfad);
+        MYDBG_ring.belegt -= min(bytes, MYDBG_ring.belegt);
+        MYDBG_ring.ersteNr++;
+    }
+    if (MYDBG_segKopfLesen(MYDBG_ring.ersteNr, info))
+        MYDBG_ring.ersteSeq = info.kopf.firstSeq;
+    else
+        MYDBG_ring.ersteSeq = MYDBG_ring.firstSeqAktuell;
+    MYDBG_system.fsGeaendert = true;
+    return true;
+} // Ende der Funktion MYDBG_segKuerzen
+
+// Schließt das jüngste Segment ab und beginnt ein neues, danach wird auf das Budget gekürzt
+inline bool MYDBG_segNeu()
+{
+    if (MYDBG_ring.datei)
+        MYDBG_ring.datei.close();
+
+    uint32_t nr = MYDBG_ring.letzteNr + 1;
+    char pfad[32];
+    MYDBG_segPfad(pfad, sizeof(pfad), nr);
+    MYDBG_RingHeader kopf = {MYDBG_RING_MAGIC, MYDBG_RING_VERSION, sizeof(MYDBG_LogRecord), MYDBG_ring.nextSeq};
+    MYDBG_ring.datei = LittleFS.open(pfad, "w");
+    if (!MYDBG_ring.datei)
+        return false;
+    MYDBG_ring.datei.write((const uint8_t *)&kopf, sizeof(kopf));
+    MYDBG_ring.datei.flush();
+    if (MYDBG_ring.segmente() == 0)
+    {
+        MYDBG_ring.ersteNr = nr;
+        MYDBG_ring.ersteSeq = MYDBG_ring.nextSeq;
+        MYDBG_ring.belegt = 0;
+    }
+    MYDBG_ring.letzteNr = nr;
+    MYDBG_ring.firstSeqAktuell = MYDBG_ring.nextSeq;
+    MYDBG_ring.anzahlAktuell = 0;
+    MYDBG_ring.belegt += MYDBG_segVoll();
+    MYDBG_segKuerzen();
+    MYDBG_segManifestSchreiben();
+    MYDBG_system.fsGeaendert = true;
+    return true;
+} // Ende der Funktion MYDBG_segNeu
+
+// Segmentbereich ohne Manifest aus dem Verzeichnis ermitteln
+inline void MYDBG_segSuchen(uint32_t &erste, uint32_t &letzte)
+{
+    erste = 1;
+    letzte = 0;
+    File dir = LittleFS.open(MYDBG_SEG_VERZEICHNIS);
+    if (!dir || !dir.isDirectory())
+        return;
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile())
+    {
+        unsigned nr = 0;
+        const char *name = strrchr(f.name(), '/');
+        if (sscanf(name ? name + 1 : f.name(), "seg_%u", &nr) == 1 && nr > 0)
+        {
+            if (letzte < erste)
+                erste = letzte = nr;
+            erste = min(erste, (uint32_t)nr);
+            letzte = max(letzte, (uint32_t)nr);
+        }
+        f.close();
+    }
+} // Ende der Funktion MYDBG_segSuchen
+
+// Log-Speicher öffnen: Manifest lesen, vom jüngsten Segment rückwärts die lückenlose Kette gültiger Segmente
+// bestimmen und alles davor (beschädigt oder Rest einer unterbrochenen Rotation) löschen
+inline void MYDBG_ringInit()
+{
+    MYDBG_Sperre sperre;
+    MYDBG_ringSchliessen();
+    MYDBG_ring.nextSeq = 1;
+    MYDBG_ring.anzahlAktuell = 0;
+    MYDBG_ring.belegt = 0;
+
+    if (!LittleFS.exists(MYDBG_SEG_VERZEICHNIS))
+        LittleFS.mkdir(MYDBG_SEG_VERZEICHNIS);
+    if (LittleFS.exists(MYDBG_SEG_TEMP))
+        LittleFS.remove(MYDBG_SEG_TEMP); // Packen wurde unterbrochen, das Original ist noch vorhanden
+
+    // Ring aus zwei Hälften früherer Versionen
+    const char *altDateien[] = {"/mydbg_log.bin", "/mydbg_log.old"};
+    for (const char *alt : altDateien)
+    {
+        if (LittleFS.exists(alt))
+        {
+            LittleFS.remove(alt);
+            Serial.printf("[MYDBG] Alter Ringpuffer %s entfernt – Logs liegen jetzt in " MYDBG_SEG_VERZEICHNIS "/seg_NNNN.\n", alt);
+        }
+    }
+
+    uint32_t erste = 1, letzte = 0;
+    MYDBG_SegManifest m;
+    File f = LittleFS.open(MYDBG_SEG_MANIFEST, "r");
+    bool manifestOk = f && f.read((uint8_t *)&m, sizeof(m)) == sizeof(m) &&
+                      m.magic == MYDBG_MANIFEST_MAGIC && m.version == MYDBG_RING_VERSION;
+    if (f)
+        f.close();
+    if (manifestOk)
+    {
+        erste = m.ersteNr;
+        letzte = m.letzteNr;
+        if (m.budgetProzent >= 1 && m.budgetProzent <= 90)
+            MYDBG_ring.budgetProzent = m.budgetProzent;
+    }
+    else
+    {
+        MYDBG_segSuchen(erste, letzte);
+    }
+    char pfad[32];
+    for (;;) // Segmente, die nach dem letzten Schreiben des Manifests angelegt wurden
+    {
+        MYDBG_segPfad(pfad, sizeof(pfad), letzte + 1);
+        if (!LittleFS.exists(pfad))
+            break;
+        letzte++;
+    }
+
+    MYDBG_SegInfo info;
+    bool jungAnhaengbar = false;
+    while (letzte >= erste && letzte > 0 && !MYDBG_segKopfLesen(letzte, info))
+    {
+        MYDBG_segPfad(pfad, sizeof(pfad), letzte); // z. B. Neustart, bevor der Kopf eines neuen Segments geschrieben war
+        LittleFS.remove(pfad);
+        letzte--;
+    }
+    uint32_t gueltigAb = letzte + 1;
+    for (uint32_t nr = letzte; nr >= erste && nr > 0; nr--)
+    {
+        if (!MYDBG_segKopfLesen(nr, info))
+            break;
+        if (nr == letzte)
+        {
+            MYDBG_ring.firstSeqAktuell = info.kopf.firstSeq;
+            MYDBG_ring.anzahlAktuell = info.anzahl;
+            MYDBG_ring.nextSeq = info.kopf.firstSeq + info.anzahl;
+            jungAnhaengbar = info.ausgerichtet && !info.komprimiert;
+            MYDBG_ring.belegt += MYDBG_segVoll();
+        }
+        else if (info.kopf.firstSeq + info.anzahl != MYDBG_ring.ersteSeq)
+        {
+            break; // Lücke in den Sequenznummern
+        }
+        else
+        {
+            MYDBG_ring.belegt += MYDBG_fsBloecke(info.groesse);
+        }
+        MYDBG_ring.ersteSeq = info.kopf.firstSeq;
+        gueltigAb = nr;
+    }
+    for (uint32_t nr = erste; nr < gueltigAb; nr++)
+    {
+        MYDBG_segPfad(pfad, sizeof(pfad), nr);
+        if (LittleFS.exists(pfad))
+        {
+            Serial.printf("[MYDBG] ⚠️ Segment %s ungültig oder nicht mehr lückenlos → wird gelöscht\n", pfad);
+            LittleFS.remove(pfad);
+        }
+    }
+    MYDBG_ring.ersteNr = gueltigAb;
+    MYDBG_ring.letzteNr = gueltigAb > letzte ? gueltigAb - 1 : letzte;
+    MYDBG_ring.packNr = MYDBG_ring.ersteNr;
+    if (MYDBG_ring.segmente() == 0)
+    {
+        MYDBG_ring.ersteSeq = 1;
+        MYDBG_ring.firstSeqAktuell = 1;
+    }
+
+    if (MYDBG_ring.segmente() > 0 && jungAnhaengbar && MYDBG_ring.anzahlAktuell < MYDBG_SEGMENT_EINTRAEGE)
+    {
+        MYDBG_segPfad(pfad, sizeof(pfad), MYDBG_ring.letzteNr);
+        MYDBG_ring.datei = LittleFS.open(pfad, "a");
+        MYDBG_segKuerzen();
+        MYDBG_segManifestSchreiben();
+    }
+    else
+    {
+        MYDBG_segNeu(); // leer, voll oder halber Eintrag am Ende → neues Segment
+    }
+
+    MYDBG_ring.bereit = (bool)MYDBG_ring.datei;
+    if (MYDBG_ring.bereit)
+        Serial.printf("[MYDBG] OK: %u Logeinträge in %u Segmenten geladen (%u von %u kB Budget, %u%%).\n",
+                      (unsigned)(MYDBG_ring.nextSeq - MYDBG_ring.ersteSeq), (unsigned)MYDBG_ring.segmente(),
+                      (unsigned)(MYDBG_ring.belegt / 1024), (unsigned)(MYDBG_segBudget() / 1024), (unsigned)MYDBG_ring.budgetProzent);
+    else
+        Serial.println("[MYDBG] ❌ Fehler beim Öffnen des Log-Segments");
+} // Ende der Funktion MYDBG_ringInit
+
+// Log-Speicher schließen (z. B. vor dem Löschen der Dateien)
+inline void MYDBG_ringSchliessen()
+{
+    if (MYDBG_ring.datei)
+        MYDBG_ring.datei.close();
+    MYDBG_ring.bereit = false;
+} // Ende der Funktion MYDBG_ringSchliessen
+
+// Hängt einen Eintrag an das jüngste Segment an: ein Schreibvorgang fester Größe, unabhängig von der Anzahl gespeicherter Einträge
+inline void MYDBG_ringAppend(MYDBG_LogRecord &rec)
+{
+    if (!MYDBG_ring.bereit)
+        MYDBG_ringInit();
+    if (!MYDBG_ring.bereit)
+        return;
+
+    if (MYDBG_ring.anzahlAktuell >= MYDBG_SEGMENT_EINTRAEGE && !MYDBG_segNeu())
+    {
+        MYDBG_ring.bereit = false;
+        return;
+    }
+
+    rec.seq = MYDBG_ring.nextSeq;
+    if (MYDBG_ring.datei.write((const uint8_t *)&rec, sizeof(rec)) != sizeof(rec))
+    {
+        MYDBG_ringSchliessen(); // z. B. Flash voll – beim nächsten Aufruf neu aufsetzen
+        return;
+    }
+    MYDBG_ring.datei.flush();
+    MYDBG_ring.nextSeq++;
+    MYDBG_ring.anzahlAktuell++;
+} // Ende der Funktion MYDBG_ringAppend
+
+// Anteil der LittleFS-Partition für Logsegmente ändern (1…90 %), gilt sofort und bleibt über Neustarts erhalten
+inline void MYDBG_setzeLogBudget(uint8_t prozent)
+{
+    MYDBG_Sperre sperre;
+    if (!MYDBG_ring.bereit)
+        MYDBG_ringInit();
+    MYDBG_ring.budgetProzent = constrain(prozent, 1, 90);
+    MYDBG_segKuerzen();
+    MYDBG_segManifestSchreiben();
+} // Ende der Funktion MYDBG_setzeLogBudget
+
+#ifndef MYDBG_OHNE_KOMPRESSION
+// Packt ein abgeschlossenes Segment blockweise nach MYDBG_SEG_TEMP und ersetzt das Original per rename
+// (LittleFS tauscht die Datei atomar – nach einem Reset liegt entweder das alte oder das gepackte Segment vor).
+// Arbeitsspeicher: ein Block Einträge (4 kB) und die Hashtabelle (2 kB), nur für die Dauer des Aufrufs.
+inline bool MYDBG_segPacken(uint32_t nr)
+{
+    MYDBG_SegInfo info;
+    if (!MYDBG_segKopfLesen(nr, info) || info.komprimiert || !info.ausgerichtet || info.anzahl == 0)
+        return false;
+
+    const uint16_t bloecke = (info.anzahl + MYDBG_Z_BLOCK_EINTRAEGE - 1) / MYDBG_Z_BLOCK_EINTRAEGE;
+    std::unique_ptr<uint8_t[]> roh(new (std::nothrow) uint8_t[MYDBG_Z_BLOCK_EINTRAEGE * sizeof(MYDBG_LogRecord)]);
+    std::unique_ptr<uint16_t[]> hash(new (std::nothrow) uint16_t[1 << MYDBG_LZ_HASH_BITS]);
+    std::unique_ptr<uint32_t[]> enden(new (std::nothrow) uint32_t[bloecke]);
+    if (!roh || !hash || !enden)
+        return false;
+
+    char pfad[32];
+    MYDBG_segPfad(pfad, sizeof(pfad), nr);
+    File ein = LittleFS.open(pfad, "r");
+    File aus = LittleFS.open(MYDBG_SEG_TEMP, "w");
+    bool ok = ein && aus && ein.seek(sizeof(MYDBG_RingHeader));
+
+    MYDBG_RingHeader kopf = info.kopf;
+    kopf.magic = MYDBG_SEGZ_MAGIC;
+    MYDBG_SegZKopf z = {info.anzahl, bloecke, MYDBG_Z_BLOCK_EINTRAEGE};
+    ok = ok && aus.write((const uint8_t *)&kopf, sizeof(kopf)) == sizeof(kopf) &&
+         aus.write((const uint8_t *)&z, sizeof(z)) == sizeof(z);
+    uint32_t pos = sizeof(kopf) + sizeof(z);
+    for (uint16_t b = 0; ok && b < bloecke; b++)
+    {
+        size_t n = min((uint32_t)MYDBG_Z_BLOCK_EINTRAEGE, info.anzahl - b * MYDBG_Z_BLOCK_EINTRAEGE) * sizeof(MYDBG_LogRecord);
+        ok = ein.read(roh.get(), n) == n;
+        if (ok)
+            pos += MYDBG_lzPacken(roh.get(), n, [&](const uint8_t *daten, size_t laenge)
+                                  { ok = ok && aus.write(daten, laenge) == laenge; },
+                                  hash.get(), sizeof(MYDBG_LogRecord));
+        enden[b] = pos;
+    }
+    ok = ok && aus.write((const uint8_t *)enden.get(), bloecke * sizeof(uint32_t)) == bloecke * sizeof(uint32_t);
+    pos += bloecke * sizeof(uint32_t);
+    if (ein)
+        ein.close();
+    if (aus)
+        aus.close();
+
+    // Nur ersetzen, wenn tatsächlich Blöcke frei werden
+    if (!ok || MYDBG_fsBloecke(pos) >= MYDBG_fsBloecke(info.groesse) || !LittleFS.rename(MYDBG_SEG_TEMP, pfad))
+    {
+        LittleFS.remove(MYDBG_SEG_TEMP);
+        return false;
+    }
+    MYDBG_ring.belegt -= min(MYDBG_fsBloecke(info.groesse) - MYDBG_fsBloecke(pos), MYDBG_ring.belegt);
+    MYDBG_system.fsGeaendert = true;
+    return true;
+} // Ende der Funktion MYDBG_segPacken
+
+// Hintergrundarbeit: packt je Aufruf höchstens ein abgeschlossenes Segment (das jüngste wird noch beschrieben).
+// Läuft über MYDBG_systemAktualisieren() im MYDBG-Task bzw. vor den Wartepausen, also im selben
+// Kontext wie das Anhängen und Löschen von Segmenten.
+inline void MYDBG_segPflegen()
+{
+    if (!MYDBG_ring.bereit)
+        return;
+    if (MYDBG_ring.packNr < MYDBG_ring.ersteNr)
+        MYDBG_ring.packNr = MYDBG_ring.ersteNr;
+    if (MYDBG_ring.packNr >= MYDBG_ring.letzteNr)
+        return;
+    MYDBG_segPacken(MYDBG_ring.packNr++);
+} // Ende der Funktion MYDBG_segPflegen
+#else
+inline void MYDBG_segPflegen() {}
+#endif // MYDBG_OHNE_KOMPRESSION
+
+// Liest gespeicherte Einträge vom neuesten zum ältesten oder aufsteigend, geöffnet ist immer nur ein Segment.
+// Gepackte Segmente werden blockweise entpackt, dafür wird beim ersten Bedarf ein Blockpuffer (4 kB) angelegt.
+struct MYDBG_RingLeser
+{
+    File datei; // geöffnetes Segment
+    uint32_t segErste = 0; // erste Sequenznummer im geöffneten Segment
+    uint32_t segAnzahl = 0;
+    uint32_t ersteNr = 0;
+    uint32_t letzteNr = 0;
+    uint32_t endSeq = 0; // erster Eintrag nach dem Öffnen, später angehängte werden nicht gelesen
+    uint32_t pos = 0;    // 0 = erster gelieferter Eintrag
+    uint32_t anzahl = 0;
+    uint32_t ersteSeq = 0;    // Sequenznummer des ältesten Eintrags beim Öffnen
+    bool aufsteigend = false; // true = ältester Eintrag zuerst
+    bool komprimiert = false; // geöffnetes Segment ist gepackt
+    uint16_t jeBlock = 0;
+    uint32_t tabelle = 0;            // Offset der Blocktabelle im gepackten Segment
+    uint32_t geladen = UINT32_MAX;   // Block im Puffer
+    std::unique_ptr<uint8_t[]> block; // entpackter Block
+
+    void oeffnen(uint32_t maxAnzahl = MYDBG_MAX_LOGFILES, bool vomAeltesten = false)
+    {
+        MYDBG_Sperre sperre; // Stand von MYDBG_ring nicht mitten in einer Rotation übernehmen
+        schliessen();
+        pos = 0;
+        aufsteigend = vomAeltesten;
+        ersteNr = MYDBG_ring.ersteNr;
+        letzteNr = MYDBG_ring.letzteNr;
+        ersteSeq = MYDBG_ring.ersteSeq;
+        endSeq = MYDBG_ring.bereit && MYDBG_ring.segmente() > 0 ? MYDBG_ring.nextSeq : ersteSeq;
+        anzahl = min(endSeq - ersteSeq, maxAnzahl);
+    }
+
+    // Aufsteigend: springt zum ersten Eintrag mit seq >= ab, ohne die älteren zu lesen (Nummern sind lückenlos)
+    void abSeq(uint32_t ab)
+    {
+        uint32_t aeltester = endSeq - anzahl;
+        if (aufsteigend && ab > aeltester)
+            pos = max(pos, min(ab - aeltester, anzahl));
+    }
+
+    // Öffnet das Segment mit dem Eintrag seq: geschätzt über die Segmentgröße, dann schrittweise korrigiert
+    // (kürzere Segmente entstehen nur nach einem halb geschriebenen Eintrag)
+    bool segmentSuchen(uint32_t seq)
+    {
+        uint32_t nr = ersteNr + min((seq - ersteSeq) / MYDBG_SEGMENT_EINTRAEGE, letzteNr - ersteNr);
+        for (uint32_t versuch = 0; versuch <= letzteNr - ersteNr; versuch++)
+        {
+            if (datei)
+                datei.close();
+            segAnzahl = 0;
+            geladen = UINT32_MAX;
+            char pfad[32];
+            MYDBG_segPfad(pfad, sizeof(pfad), nr);
+            if (!LittleFS.exists(pfad))
+                return false; // inzwischen wegen des Budgets gelöscht
+            datei = LittleFS.open(pfad, "r");
+            MYDBG_RingHeader kopf;
+            if (!datei || datei.read((uint8_t *)&kopf, sizeof(kopf)) != sizeof(kopf))
+                return false;
+            segErste = kopf.firstSeq;
+            komprimiert = kopf.magic == MYDBG_SEGZ_MAGIC;
+            if (komprimiert)
+            {
+                MYDBG_SegZKopf z;
+                if (datei.read((uint8_t *)&z, sizeof(z)) != sizeof(z) || z.jeBlock == 0 || z.jeBlock > MYDBG_Z_BLOCK_EINTRAEGE)
+                    return false;
+                segAnzahl = z.anzahl;
+                jeBlock = z.jeBlock;
+                tabelle = datei.size() - z.bloecke * sizeof(uint32_t);
+            }
+            else
+            {
+                segAnzahl = (datei.size() - sizeof(kopf)) / sizeof(MYDBG_LogRecord);
+            }
+            if (seq < segErste && nr > ersteNr)
+                nr--;
+            else if (seq >= segErste + segAnzahl && nr < letzteNr)
+                nr++;
+            else
+                return seq >= segErste && seq < segErste + segAnzahl;
+        }
+        return false;
+    }
+
+    // Entpackt Block b des geöffneten gepackten Segments in den Puffer
+    bool blockLaden(uint32_t b)
+    {
+        geladen = UINT32_MAX;
+        if (!block)
+            block.reset(new (std::nothrow) uint8_t[MYDBG_Z_BLOCK_EINTRAEGE * sizeof(MYDBG_LogRecord)]);
+        if (!block)
+            return false;
+        uint32_t grenzen[2] = {sizeof(MYDBG_RingHeader) + sizeof(MYDBG_SegZKopf), 0};
+        bool ok = b > 0 ? datei.seek(tabelle + (b - 1) * sizeof(uint32_t)) && datei.read((uint8_t *)grenzen, 8) == 8
+                        : datei.seek(tabelle) && datei.read((uint8_t *)&grenzen[1], 4) == 4;
+        if (!ok || grenzen[1] < grenzen[0] || grenzen[1] > tabelle || !datei.seek(grenzen[0]))
+            return false;
+
+        uint32_t rest = grenzen[1] - grenzen[0];
+        uint8_t puffer[64];
+        size_t n = 0, i = 0;
+        size_t soll = min((uint32_t)jeBlock, segAnzahl - b * jeBlock) * sizeof(MYDBG_LogRecord);
+        size_t ist = MYDBG_lzEntpacken([&]() -> int
+                                       {
+                                           if (i == n)
+                                           {
+                                               n = rest ? datei.read(puffer, min(rest, (uint32_t)sizeof(puffer))) : 0;
+                                               if (n == 0 || n > rest)
+                                                   return -1;
+                                               rest -= n;
+                                               i = 0;
+                                           }
+                                           return puffer[i++]; },
+                                       block.get(), soll);
+        if (ist != soll)
+            return false;
+        geladen = b;
+        return true;
+    }
+
+    bool naechster(MYDBG_LogRecord &rec)
+    {
+        if (pos >= anzahl)
+            return false;
+        uint32_t seq = aufsteigend ? endSeq - anzahl + pos : endSeq - 1 - pos;
+        pos++;
+        if ((!datei || seq < segErste || seq >= segErste + segAnzahl) && !segmentSuchen(seq))
+        {
+            pos = anzahl;
+            return false;
+        }
+        if (komprimiert)
+        {
+            uint32_t index = seq - segErste;
+            if (index / jeBlock != geladen && !blockLaden(index / jeBlock))
+                return false;
+            memcpy(&rec, block.get() + (index % jeBlock) * sizeof(MYDBG_LogRecord), sizeof(rec));
+            return true;
+        }
+        return datei.seek(sizeof(MYDBG_RingHeader) + (seq - segErste) * sizeof(MYDBG_LogRecord)) &&
+               datei.read((uint8_t *)&rec, sizeof(rec)) == sizeof(rec);
+    }
+
+    void schliessen()
+    {
+        if (datei)
+            datei.close();
+        segAnzahl = 0;
+        anzahl = 0;
+        geladen = UINT32_MAX;
+    }
+
+    ~MYDBG_RingLeser() { schliessen(); }
+}; // Ende der Struktur MYDBG_RingLeser
+
+// Schreibt einen Text JSON-sicher (ohne Anführungszeichen) in den Puffer, kürzt bei Platzmangel
+inline size_t MYDBG_jsonEscape(char *ziel, size_t groesse, const char *quelle)
+{
+    size_t n = 0;
+    for (; *quelle && n + 1 < groesse; quelle++)
+    {
+        uint8_t c = (uint8_t)*quelle;
+        if (c == '"' || c == '\\')
+        {
+            if (n + 3 > groesse)
+                break;
+            ziel[n++] = '\\';
+            ziel[n++] = c;
+        }
+        else if (c < 0x20)
+        {
+            if (n + 7 > groesse)
+                break;
+            n += snprintf(ziel + n, groesse - n, "\\u%04x", c);
+        }
+        else
+        {
+            ziel[n++] = c;
+        }
+    }
+    ziel[n] = '\0';
+    return n;
+} // Ende der Funktion MYDBG_jsonEscape
+
+// === Formatierung ohne Heap ===
+// Baut Ausgabezeilen in einem festen Puffer auf dem Stack statt durch String-Verkettung.
+// Nach dem Start kostet eine Ausgabe damit keine Heap-Allokation mehr. Zu lange Zeilen werden gekürzt.
+#define MYDBG_ZEILE_MAX 256
+
+struct MYDBG_Puffer
+{
+    char *text;
+    size_t groesse;
+    size_t laenge = 0;
+
+    MYDBG_Puffer(char *ziel, size_t n) : text(ziel), groesse(n) { text[0] = '\0'; }
+
+    size_t frei() const { return groesse - 1 - laenge; }
+
+    MYDBG_Puffer &operator<<(const char *s)
+    {
+        if (!s)
+            return *this;
+        size_t n = min(strlen(s), frei());
+        memcpy(text + laenge, s, n);
+        laenge += n;
+        text[laenge] = '\0';
+        return *this;
+    }
+
+    MYDBG_Puffer &operator<<(const String &s) { return *this << s.c_str(); }
+
+    // Zahlen, bool, char, Aufzählungen – gleiche Darstellung wie im Log (Kommazahlen mit zwei Stellen)
+    template <typename T>
+    MYDBG_Puffer &operator<<(const T &wert)
+    {
+        if constexpr (std::is_convertible<T, const char *>::value)
+        {
+            return *this << (const char *)wert;
+        }
+        else
+        {
+            MYDBG_Wert w = MYDBG_wert(wert);
+            MYDBG_wertText(w.typ, w.daten, text + laenge, groesse - laenge);
+            laenge += strlen(text + laenge);
+            return *this;
+        }
+    }
+
+    // Text JSON-sicher anhängen (ohne Anführungszeichen)
+    MYDBG_Puffer &json(const char *s)
+    {
+        laenge += MYDBG_jsonEscape(text + laenge, groesse - laenge, s ? s : "");
+        return *this;
+    }
+
+    MYDBG_Puffer &printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(text + laenge, groesse - laenge, format, args);
+        va_end(args);
+        if (n > 0)
+            laenge += min((size_t)n, frei());
+        return *this;
+    }
+}; // Ende der Struktur MYDBG_Puffer
+
+// Puffer mit eigenem Speicher, z. B. MYDBG_Zeile<> zeile; zeile << "Wert: " << x;
+template <size_t N = MYDBG_ZEILE_MAX>
+struct MYDBG_Zeile : MYDBG_Puffer
+{
+    char speicher[N];
+    MYDBG_Zeile() : MYDBG_Puffer(speicher, N) {}
+    MYDBG_Zeile(const MYDBG_Zeile &) = delete;
+}; // Ende der Struktur MYDBG_Zeile
+
+// Textfelder eines JSON-Eintrags nach dem Escapen (inkl. '\0'), längere Texte werden gekürzt
+#define MYDBG_JSON_ZEIT 30
+#define MYDBG_JSON_FUNC 64
+#define MYDBG_JSON_MSG 256
+#define MYDBG_JSON_VARNAME 48
+#define MYDBG_JSON_VARWERT 64
+#define MYDBG_JSON_RESETGRUND 24 // längster Text aus MYDBG_interpretResetReason
+
+inline constexpr char MYDBG_JSON_EINTRAG[] =
+    "{\"seq\":%u,\"site\":%u,\"boot\":%u,\"timestamp\":\"%s\",\"millis\":%llu,\"pgmFunc\":\"%s\",\"pgmZeile\":%u,\"level\":%u,"
+    "\"suppressed\":%u,\"msg\":\"%s\",\"varName\":\"%s\",\"varValue\":\"%s\",\"resetReason\":%u,\"ResetGrund\":\"%s\"}";
+inline constexpr char MYDBG_JSON_GESUNDHEIT[] = ",\"heap_free\":%u,\"heap_block\":%u,\"heap_min\":%u,\"stack_free\":%u}";
+
+// Längste mögliche Zeile: Formattexte (Platzhalter zählen mit), volle Textfelder, 11 Zahlen mit 10 und eine mit 20 Stellen
+constexpr size_t MYDBG_JSON_EINTRAG_MAX = sizeof(MYDBG_JSON_EINTRAG) + sizeof(MYDBG_JSON_GESUNDHEIT) + MYDBG_JSON_ZEIT + MYDBG_JSON_FUNC + MYDBG_JSON_MSG +
+                                          MYDBG_JSON_VARNAME + MYDBG_JSON_VARWERT + MYDBG_JSON_RESETGRUND + 11 * 10 + 20;
+static_assert(MYDBG_JSON_EINTRAG_MAX + 1 <= MYDBG_CHUNK_ZEILE, "MYDBG_CHUNK_ZEILE fasst den längsten JSON-Eintrag nicht (plus ',' bzw. Zeilenende)");
+
+// Erzeugt das JSON-Objekt eines Ringeintrags (gleiche Schlüssel wie die frühere /mydbg_data.json).
+// Passt es nicht in den Puffer, wird nichts geliefert (0) statt eines abgeschnittenen Objekts.
+inline size_t MYDBG_recordToJson(const MYDBG_LogRecord &rec, char *buf, size_t groesse)
+{
+    MYDBG_Klartext k;
+    MYDBG_klartext(rec, k);
+    char zeit[MYDBG_JSON_ZEIT], func[MYDBG_JSON_FUNC], msg[MYDBG_JSON_MSG], varName[MYDBG_JSON_VARNAME], varValue[MYDBG_JSON_VARWERT];
+    MYDBG_formatZeit(MYDBG_unixZeit(rec), zeit, sizeof(zeit));
+    MYDBG_jsonEscape(func, sizeof(func), k.func);
+    MYDBG_jsonEscape(msg, sizeof(msg), k.msg);
+    MYDBG_jsonEscape(varName, sizeof(varName), k.varName);
+    MYDBG_jsonEscape(varValue, sizeof(varValue), k.varValue);
+
+    int n = snprintf(buf, groesse, MYDBG_JSON_EINTRAG,
+                     (unsigned)rec.seq, (unsigned)rec.site, (unsigned)rec.boot, zeit, (unsigned long long)(rec.mikros / 1000), func, (unsigned)k.zeile, (unsigned)rec.stufe,
+                     (unsigned)rec.unterdrueckt, msg, varName, varValue, (unsigned)rec.resetReason,
+                     MYDBG_interpretResetReason((esp_reset_reason_t)rec.resetReason).text);
+    MYDBG_GesundheitWert g;
+    if (n > 0 && (size_t)n < groesse && MYDBG_gesundheitAuspacken(rec, g))
+    {
+        int m = snprintf(buf + n - 1, groesse - n + 1, MYDBG_JSON_GESUNDHEIT,
+                         (unsigned)g.heapFrei, (unsigned)g.heapBlock, (unsigned)g.heapMin, (unsigned)g.stackFrei);
+        n = m < 0 ? m : n - 1 + m; // schließende Klammer überschrieben
+    }
+    if (n <= 0 || (size_t)n >= groesse)
+    {
+        if (groesse > 0)
+            buf[0] = '\0';
+        return 0;
+    }
+    return (size_t)n;
+} // Ende der Funktion MYDBG_recordToJson
+
+// Basis für Chunked-HTTP-Antworten: liefert Zeile für Zeile und verteilt sie auf die TCP-Puffer,
+// so wird nie das ganze Dokument im RAM aufgebaut
+struct MYDBG_ChunkQuelle
+{
+    char zeile[MYDBG_CHUNK_ZEILE];
+    size_t laenge = 0;
+    size_t gesendet = 0;
+
+    virtual bool naechsteZeile() = 0; // füllt zeile/laenge, false = Ende der Antwort
+    virtual ~MYDBG_ChunkQuelle() {}
+
+    // Läuft im Task des Webservers; die Sperre hält Schreiber und Löschen fern, solange Zeilen entstehen
+    size_t fuellen(uint8_t *buffer, size_t maxLen)
+    {
+        MYDBG_Sperre sperre;
+        size_t geschrieben = 0;
+        while (geschrieben < maxLen)
+        {
+            if (gesendet >= laenge)
+            {
+                laenge = 0;
+                gesendet = 0;
+                if (!naechsteZeile())
+                    break;
+                continue;
+            }
+            size_t n = min(laenge - gesendet, maxLen - geschrieben);
+            memcpy(buffer + geschrieben, zeile + gesendet, n);
+            gesendet += n;
+            geschrieben += n;
+        }
+        return geschrieben;
+    }
+
+    void setze(const char *text)
+    {
+        MYDBG_kopiere(zeile, sizeof(zeile), text);
+        laenge = strlen(zeile);
+    }
+}; // Ende der Struktur MYDBG_ChunkQuelle
+
+// Sendet eine Chunked-Antwort aus einer Zeilenquelle
+inline void MYDBG_sendeChunked(AsyncWebServerRequest *request, const char *contentType, std::shared_ptr<MYDBG_ChunkQuelle> quelle)
+{
+    request->send(request->beginChunkedResponse(contentType, [quelle](uint8_t *buffer, size_t maxLen, size_t /*index*/) -> size_t
+                                                { return quelle->fuellen(buffer, maxLen); }));
+} // Ende der Funktion MYDBG_sendeChunked
+
+// Erzeugt /mydbg_data.json bei Abruf aus dem Ringpuffer (neuester Eintrag zuerst)
+struct MYDBG_LogJsonQuelle : MYDBG_ChunkQuelle
+{
+    MYDBG_RingLeser leser;
+    uint8_t phase = 0; // 0 = Anfang, 1 = Einträge, 2 = fertig
+    bool erster = true;
+
+    MYDBG_LogJsonQuelle() { leser.oeffnen(); }
+
+    bool naechsteZeile() override
+    {
+        if (phase == 0)
+        {
+            setze("{\"log\":[");
+            phase = 1;
+            return true;
+        }
+        if (phase == 1)
+        {
+            MYDBG_LogRecord rec;
+            while (leser.naechster(rec))
+            {
+                size_t n = erster ? 0 : 1;
+                size_t m = MYDBG_recordToJson(rec, zeile + n, sizeof(zeile) - n);
+                if (m == 0)
+                    continue;
+                if (!erster)
+                    zeile[0] = ',';
+                erster = false;
+                laenge = n + m;
+                return true;
+            }
+            leser.schliessen();
+            setze("]}");
+            phase = 2;
+            return true;
+        }
+        return false;
+    }
+}; // Ende der Struktur MYDBG_LogJsonQuelle
+
+// Binärer Abzug des Ringpuffers für tools/mydbg_decode.py (ältester Eintrag zuerst)
+// Kopf: Kennung (4) | Version (2) | Satzgröße (2) | Anzahl (4), danach die Einträge
+struct MYDBG_LogDumpQuelle : MYDBG_ChunkQuelle
+{
+    MYDBG_RingLeser leser;
+    bool kopfGesendet = false;
+
+    MYDBG_LogDumpQuelle() { leser.oeffnen(UINT32_MAX, true); }
+
+    bool naechsteZeile() override
+    {
+        if (!kopfGesendet)
+        {
+            uint32_t magic = MYDBG_RING_MAGIC, anzahl = leser.anzahl;
+            uint16_t version = MYDBG_RING_VERSION, groesse = sizeof(MYDBG_LogRecord);
+            memcpy(zeile, &magic, 4);
+            memcpy(zeile + 4, &version, 2);
+            memcpy(zeile + 6, &groesse, 2);
+            memcpy(zeile + 8, &anzahl, 4);
+            // danach die Zeitanker der gespeicherten Starts, damit der Dekoder Uhrzeiten berechnen kann
+            if (MYDBG_zeit.anzahl > 0)
+                MYDBG_zeit.anker[MYDBG_zeit.anzahl - 1].offsetUs = MYDBG_zeit.offsetUs.load(std::memory_order_relaxed);
+            uint32_t ankerAnzahl = MYDBG_zeit.anzahl;
+            memcpy(zeile + 12, &ankerAnzahl, 4);
+            memcpy(zeile + 16, MYDBG_zeit.anker, sizeof(MYDBG_ZeitAnker) * ankerAnzahl);
+            laenge = 16 + sizeof(MYDBG_ZeitAnker) * ankerAnzahl;
+            kopfGesendet = true;
+            return true;
+        }
+        MYDBG_LogRecord rec;
+        if (!leser.naechster(rec))
+            return false;
+        memcpy(zeile, &rec, sizeof(rec));
+        laenge = sizeof(rec);
+        return true;
+    }
+}; // Ende der Struktur MYDBG_LogDumpQuelle
+
+// Tabelle aller gespeicherten Aufrufstellen als JSON (für tools/mydbg_decode.py)
+struct MYDBG_SitesJsonQuelle : MYDBG_ChunkQuelle
+{
+    uint16_t pos = 0;
+    bool fertig = false;
+
+    bool naechsteZeile() override
+    {
+        if (fertig)
+            return false;
+        if (pos == 0)
+        {
+            if (!MYDBG_siteIndexGeladen)
+                MYDBG_siteIndexLaden();
+            zeile[0] = '[';
+            laenge = 1;
+        }
+        if (pos >= MYDBG_siteIndexAnzahl)
+        {
+            zeile[laenge++] = ']';
+            fertig = true;
+            return true;
+        }
+        MYDBG_Klartext k;
+        MYDBG_siteLaden(MYDBG_siteIndex[pos].id, k);
+        char func[64], msg[256], varName[64];
+        MYDBG_jsonEscape(func, sizeof(func), k.func);
+        MYDBG_jsonEscape(msg, sizeof(msg), k.msg);
+        MYDBG_jsonEscape(varName, sizeof(varName), k.varName);
+        // Zähler der Drosselung gibt es nur für Stellen, die in diesem Lauf schon aufgerufen wurden
+        MYDBG_Site *site = MYDBG_siteSuchen(MYDBG_siteIndex[pos].id);
+        int n = snprintf(zeile + laenge, sizeof(zeile) - laenge, "%s{\"id\":%u,\"pgmFunc\":\"%s\",\"pgmZeile\":%u,\"msg\":\"%s\",\"varName\":\"%s\","
+                         "\"calls\":%u,\"suppressed\":%u}",
+                         pos > 0 ? "," : "", (unsigned)MYDBG_siteIndex[pos].id, func, (unsigned)k.zeile, msg, varName,
+                         site ? (unsigned)site->drossel.aufrufe : 0u, site ? (unsigned)site->drossel.unterdrueckt : 0u);
+        laenge += n > 0 ? min((size_t)n, sizeof(zeile) - laenge - 1) : 0;
+        pos++;
+        return true;
+    }
+}; // Ende der Struktur MYDBG_SitesJsonQuelle
+
+// === Log-Abfrage ===
+// GET /mydbg_query?since_seq=120&limit=50&func=loop&line=42&level=3&from=1718000000&to=1718003600
+// liefert passende Einträge als NDJSON (ein JSON-Objekt je Zeile, ältester zuerst) direkt aus dem Ringpuffer.
+// Alle Parameter sind optional: since_seq = nur Einträge mit größerer Nummer, level = Mindeststufe,
+// from/to = Unix-Zeit in Sekunden (Einträge ohne Uhrzeit fallen dann heraus).
+struct MYDBG_LogFilter
+{
+    uint32_t sinceSeq = 0;
+    uint32_t limit = MYDBG_QUERY_LIMIT;
+    char func[48] = "";
+    uint16_t zeile = 0; // 0 = alle Zeilen
+    uint8_t stufe = 0;
+    uint32_t von = 0; // Unix-Zeit, 0 = offen
+    uint32_t bis = 0;
+
+    // Übernimmt einen Parameter, false = unbekannt oder ungültig
+    bool setzen(const char *name, const char *wert)
+    {
+        if (strcmp(name, "func") == 0)
+        {
+            if (strlen(wert) >= sizeof(func))
+                return false;
+            MYDBG_kopiere(func, sizeof(func), wert);
+            return true;
+        }
+        char *ende;
+        unsigned long zahl = strtoul(wert, &ende, 10);
+        if (!*wert || *ende || *wert == '-')
+            return false;
+        if (strcmp(name, "since_seq") == 0)
+            sinceSeq = zahl;
+        else if (strcmp(name, "limit") == 0)
+            limit = zahl;
+        else if (strcmp(name, "line") == 0 && zahl <= 0xFFFF)
+            zeile = zahl;
+        else if (strcmp(name, "level") == 0 && zahl <= 9)
+            stufe = zahl;
+        else if (strcmp(name, "from") == 0)
+            von = zahl;
+        else if (strcmp(name, "to") == 0)
+            bis = zahl;
+        else
+            return false;
+        return true;
+    }
+
+    bool nachSite() const { return func[0] || zeile; }
+}; // Ende der Struktur MYDBG_LogFilter
+
+// Streamt die Treffer einer Abfrage; im RAM liegt immer nur ein Eintrag, unabhängig von der Größe des Logs
+struct MYDBG_QueryQuelle : MYDBG_ChunkQuelle
+{
+    MYDBG_LogFilter filter;
+    MYDBG_RingLeser leser;
+    uint32_t treffer = 0;
+    uint32_t siteId[16] = {}; // kleiner Cache: Ergebnis des Site-Vergleichs je Aufrufstelle, spart Lesen von /mydbg_sites.bin
+    bool sitePasstCache[16] = {};
+
+    MYDBG_QueryQuelle(const MYDBG_LogFilter &f) : filter(f)
+    {
+        leser.oeffnen(UINT32_MAX, true);
+        leser.abSeq(filter.sinceSeq + 1);
+    }
+
+    bool sitePasst(const MYDBG_LogRecord &rec)
+    {
+        uint8_t i = rec.site & 15;
+        if (siteId[i] != rec.site)
+        {
+            MYDBG_Klartext k;
+            MYDBG_klartext(rec, k);
+            siteId[i] = rec.site;
+            sitePasstCache[i] = (!filter.func[0] || strcmp(k.func, filter.func) == 0) &&
+                                (!filter.zeile || k.zeile == filter.zeile);
+        }
+        return sitePasstCache[i];
+    }
+
+    bool passt(const MYDBG_LogRecord &rec)
+    {
+        if (rec.seq <= filter.sinceSeq || rec.stufe < filter.stufe)
+            return false;
+        if (filter.von || filter.bis)
+        {
+            uint32_t zeit = MYDBG_unixZeit(rec);
+            if (zeit == 0 || (filter.von && zeit < filter.von) || (filter.bis && zeit > filter.bis))
+                return false;
+        }
+        return !filter.nachSite() || sitePasst(rec);
+    }
+
+    bool naechsteZeile() override
+    {
+        if (treffer >= filter.limit)
+            return false;
+        MYDBG_LogRecord rec;
+        while (leser.naechster(rec))
+        {
+            if (!passt(rec))
+                continue;
+            laenge = MYDBG_recordToJson(rec, zeile, sizeof(zeile) - 1);
+            if (laenge == 0)
+                continue;
+            zeile[laenge++] = '\n';
+            treffer++;
+            return true;
+        }
+        leser.schliessen();
+        return false;
+    }
+}; // Ende der Struktur MYDBG_QueryQuelle
+
+// === Profil ===
+// GET /mydbg_profile.json liefert alle Messstellen von MYDBG_SCOPE/MYDBG_TIC, Zeiten in µs.
+// hist: [Obergrenze, Anzahl] je belegter Klasse, die letzte Klasse hat keine Obergrenze (null).
+// Mit ?reset=1 wird jede Stelle beim Auslesen geleert.
+struct MYDBG_ProfilJsonQuelle : MYDBG_ChunkQuelle
+{
+    MYDBG_ProfilStelle *pos;
+    bool leeren;
+    bool anfang = true;
+    bool fertig = false;
+
+    explicit MYDBG_ProfilJsonQuelle(bool zuruecksetzen) : pos(MYDBG_profilListe.load(std::memory_order_acquire)), leeren(zuruecksetzen) {}
+
+    bool naechsteZeile() override
+    {
+        if (fertig)
+            return false;
+        laenge = 0;
+        if (anfang)
+            laenge = snprintf(zeile, sizeof(zeile), "{\"mhz\":%u,\"sites\":[", (unsigned)MYDBG_profilJeUs());
+        if (!pos)
+        {
+            zeile[laenge++] = ']';
+            zeile[laenge++] = '}';
+            fertig = true;
+            return true;
+        }
+        MYDBG_ProfilWerte s;
+        MYDBG_profilLesen(*pos, s, leeren);
+        pos = pos->naechste;
+
+        const float jeUs = MYDBG_profilJeUs();
+        char name[64], func[64];
+        MYDBG_jsonEscape(name, sizeof(name), s.name);
+        MYDBG_jsonEscape(func, sizeof(func), s.func);
+        int n = snprintf(zeile + laenge, sizeof(zeile) - laenge,
+                         "%s{\"name\":\"%s\",\"func\":\"%s\",\"line\":%u,\"count\":%u,\"min_us\":%.2f,\"max_us\":%.2f,"
+                         "\"avg_us\":%.2f,\"total_us\":%.0f,\"hist\":[",
+                         anfang ? "" : ",", name, func, (unsigned)s.zeile, (unsigned)s.anzahl, s.min / jeUs, s.max / jeUs,
+                         s.anzahl ? (double)s.summe / s.anzahl / jeUs : 0.0, (double)s.summe / jeUs);
+        laenge += n > 0 ? min((size_t)n, sizeof(zeile) - laenge - 1) : 0;
+        bool erste = true;
+        for (uint8_t k = 0; k < MYDBG_PROFIL_KLASSEN; k++)
+        {
+            if (s.klassen[k] == 0)
+                continue;
+            char grenze[16] = "null";
+            if (k + 1 < MYDBG_PROFIL_KLASSEN)
+                snprintf(grenze, sizeof(grenze), "%.2f", MYDBG_profilGrenzeUs(k));
+            n = snprintf(zeile + laenge, sizeof(zeile) - laenge, "%s[%s,%u]", erste ? "" : ",", grenze, (unsigned)s.klassen[k]);
+            laenge += n > 0 ? min((size_t)n, sizeof(zeile) - laenge - 1) : 0;
+            erste = false;
+        }
+        n = snprintf(zeile + laenge, sizeof(zeile) - laenge, "]}");
+        laenge += n > 0 ? min((size_t)n, sizeof(zeile) - laenge - 1) : 0;
+        anfang = false;
+        return true;
+    }
+}; // Ende der Struktur MYDBG_ProfilJsonQuelle
+
+// === Metriken im Textformat von Prometheus ===
+// GET /metrics: je Metrik eine "# TYPE"-Zeile und ihr Wert, Verteilungen als kumulierte _bucket{le="…"}, _sum und _count.
+// Am Ende einige Werte von MYDBG selbst. Erzeugt Zeile für Zeile im festen Puffer der Chunk-Quelle.
+
+// Name für Prometheus: nur Buchstaben, Ziffern, _ und :, keine Ziffer am Anfang
+inline void MYDBG_metrikName(char *ziel, size_t groesse, const char *name)
+{
+    size_t i = 0;
+    if (*name >= '0' && *name <= '9' && groesse > 1)
+        ziel[i++] = '_';
+    for (; *name && i + 1 < groesse; name++)
+        ziel[i++] = isalnum((uint8_t)*name) || *name == '_' || *name == ':' ? *name : '_';
+    ziel[i] = '\0';
+} // Ende der Funktion MYDBG_metrikName
+
+// stellen: 7 für float (Pegel), 15 für double (Summen)
+inline void MYDBG_metrikZahl(MYDBG_Puffer &z, double w, int stellen)
+{
+    if (isnan(w))
+        z << "NaN";
+    else if (isinf(w))
+        z << (w > 0 ? "+Inf" : "-Inf");
+    else
+        z.printf("%.*g", stellen, w);
+} // Ende der Funktion MYDBG_metrikZahl
+
+struct MYDBG_MetrikQuelle : MYDBG_ChunkQuelle
+{
+    MYDBG_Metrik *pos = MYDBG_metrikListe;
+    uint8_t schritt = 0; // Verteilung: 0 = Kopf, 1…MYDBG_METRIK_KLASSEN = Klassen, danach _sum und _count
+    uint32_t klassen[MYDBG_METRIK_KLASSEN];
+    uint32_t kumuliert = 0;
+    double summe = 0;
+    char name[64];
+    bool fertig = false;
+
+    bool naechsteZeile() override
+    {
+        if (fertig)
+            return false;
+        MYDBG_Puffer z(zeile, sizeof(zeile));
+        if (!pos)
+        {
+            z.printf("# TYPE mydbg_uptime_seconds gauge\nmydbg_uptime_seconds %llu\n", (unsigned long long)(esp_timer_get_time() / 1000000));
+            z.printf("# TYPE mydbg_heap_free_bytes gauge\nmydbg_heap_free_bytes %u\n", (unsigned)ESP.getFreeHeap());
+            z.printf("# TYPE mydbg_heap_min_free_bytes gauge\nmydbg_heap_min_free_bytes %u\n", (unsigned)ESP.getMinFreeHeap());
+            z.printf("# TYPE mydbg_dropped_total counter\nmydbg_dropped_total %u\n", (unsigned)MYDBG_verworfen);
+            laenge = z.laenge;
+            fertig = true;
+            return true;
+        }
+        if (schritt == 0)
+        {
+            MYDBG_metrikName(name, sizeof(name), pos->name);
+            switch (pos->art)
+            {
+            case MYDBG_METRIK_ZAEHLER:
+                z.printf("# TYPE %s counter\n%s %u\n", name, name, (unsigned)pos->zaehler.load(std::memory_order_relaxed));
+                pos = pos->naechste;
+                break;
+            case MYDBG_METRIK_PEGEL:
+                z.printf("# TYPE %s gauge\n%s ", name, name);
+                MYDBG_metrikZahl(z, pos->wert.load(std::memory_order_relaxed), 7);
+                z << "\n";
+                pos = pos->naechste;
+                break;
+            case MYDBG_METRIK_VERTEILUNG:
+            {
+                // Stand einmal kopieren, damit Klassen, _sum und _count zusammenpassen
+                MYDBG_Verteilung *v = static_cast<MYDBG_Verteilung *>(pos);
+                for (uint8_t k = 0; k < MYDBG_METRIK_KLASSEN; k++)
+                    klassen[k] = v->klassen[k].load(std::memory_order_relaxed);
+                summe = v->summe.load(std::memory_order_relaxed);
+                kumuliert = 0;
+                z.printf("# TYPE %s histogram\n", name);
+                schritt = 1;
+                break;
+            }
+            }
+        }
+        else if (schritt <= MYDBG_METRIK_KLASSEN)
+        {
+            kumuliert += klassen[schritt - 1];
+            if (schritt < MYDBG_METRIK_KLASSEN)
+                z.printf("%s_bucket{le=\"%lu\"} %u\n", name, 1ul << (schritt - 1), (unsigned)kumuliert);
+            else
+                z.printf("%s_bucket{le=\"+Inf\"} %u\n", name, (unsigned)kumuliert);
+            schritt++;
+        }
+        else
+        {
+            z.printf("%s_sum ", name);
+            MYDBG_metrikZahl(z, summe, 15);
+            z.printf("\n%s_count %u\n", name, (unsigned)kumuliert);
+            schritt = 0;
+            pos = pos->naechste;
+        }
+        laenge = z.laenge;
+        return true;
+    }
+}; // Ende der Struktur MYDBG_MetrikQuelle
+
+// === Trace im Chrome-Trace-Format ===
+// GET /mydbg_trace.json: {"traceEvents":[…]} mit einem Namen je Task ("M"-Ereignisse) und danach den Ereignissen
+// des Rings (ältestes zuerst), ts in µs seit Start, pid 1, tid = Task, Kern in args. Der Ring wird beim Streamen
+// nicht angehalten: was währenddessen überschrieben wird, fehlt in der Antwort. ?reset=1 leert den Ring danach.
+struct MYDBG_TraceQuelle : MYDBG_ChunkQuelle
+{
+    uint32_t pos;
+    uint32_t ende;
+    uint8_t task = 0;           // nächster Task-Name, danach ISR und "andere"
+    uint8_t teil = 0;           // 0 = Kopf und Namen, 1 = Ereignisse, 2 = Abschluss
+    bool erstes = true;
+    bool leeren;
+    uint32_t jetzt32;
+    int64_t jetzt;
+
+    explicit MYDBG_TraceQuelle(bool zuruecksetzen) : leeren(zuruecksetzen)
+    {
+        ende = MYDBG_traceKopf.load(std::memory_order_acquire);
+        pos = ende - MYDBG_traceAb > MYDBG_TRACE_EINTRAEGE ? ende - MYDBG_TRACE_EINTRAEGE : MYDBG_traceAb;
+        jetzt = esp_timer_get_time();
+        jetzt32 = (uint32_t)jetzt;
+    }
+
+    void komma(MYDBG_Puffer &z)
+    {
+        if (!erstes)
+            z << ",";
+        erstes = false;
+    }
+
+    bool naechsteZeile() override
+    {
+        MYDBG_Puffer z(zeile, sizeof(zeile));
+        if (teil == 0)
+        {
+            if (task == 0)
+                z << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"ESP32\"}}";
+            erstes = false;
+            uint8_t anzahl = MYDBG_traceTaskAnzahl.load(std::memory_order_acquire);
+            while (task < anzahl && z.frei() > 120)
+            {
+                z.printf(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", (unsigned)task + 1);
+                z.json(MYDBG_traceTasks[task].name) << "\"}}";
+                task++;
+            }
+            if (task >= anzahl)
+            {
+                z.printf(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"ISR\"}}", (unsigned)MYDBG_TRACE_ISR + 1);
+                z.printf(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"andere\"}}", (unsigned)MYDBG_TRACE_TASKS + 1);
+                teil = 1;
+            }
+        }
+        else if (teil == 1)
+        {
+            // Mehrere Ereignisse je Zeile, solange Platz ist
+            while (pos != ende && z.frei() > 160)
+            {
+                MYDBG_TraceEreignis e;
+                if (MYDBG_traceLesen(pos++, e))
+                {
+                    int64_t ts = jetzt - (uint32_t)(jetzt32 - e.mikros); // 32 Bit reichen für gut 71 Minuten zurück
+                    z.printf(",{\"name\":\"");
+                    z.json(e.name).printf("\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%u,\"args\":{\"core\":%u}}",
+                                          e.art, (long long)ts, (unsigned)e.task + 1, (unsigned)e.kern);
+                }
+            }
+            if (pos == ende)
+                teil = 2;
+        }
+        else if (teil == 2)
+        {
+            z << "]}";
+            teil = 3;
+            if (leeren)
+                MYDBG_traceAb = ende;
+        }
+        else
+        {
+            return false;
+        }
+        laenge = z.laenge;
+        return true;
+    }
+}; // Ende der Struktur MYDBG_TraceQuelle
+
+// Profil als Tabelle auf der Konsole, p50/p99 als Obergrenze der Histogrammklasse
+inline void MYDBG_profilAnzeigen()
+{
+    MYDBG_ProfilStelle *liste = MYDBG_profilListe.load(std::memory_order_acquire);
+    if (!liste)
+    {
+        Serial.println("[MYDBG] Noch keine Messungen (MYDBG_SCOPE / MYDBG_TIC / MYDBG_TOC).");
+        return;
+    }
+    const float jeUs = MYDBG_profilJeUs();
+    Serial.println("\n=== Profil (Zeiten in µs) ===");
+    Serial.printf("%-24s %-20s %5s %9s %9s %9s %9s %9s %9s\n", "Name", "Funktion", "Zeile", "Anzahl", "Min", "Mittel", "p50<", "p99<", "Max");
+    for (MYDBG_ProfilStelle *stelle = liste; stelle; stelle = stelle->naechste)
+    {
+        MYDBG_ProfilWerte s;
+        MYDBG_profilLesen(*stelle, s);
+        if (s.anzahl == 0)
+        {
+            Serial.printf("%-24.24s %-20.20s %5u %9u\n", s.name, s.func, (unsigned)s.zeile, 0u);
+            continue;
+        }
+        Serial.printf("%-24.24s %-20.20s %5u %9u %9.2f %9.2f %9.2f %9.2f %9.2f\n", s.name, s.func, (unsigned)s.zeile, (unsigned)s.anzahl,
+                      s.min / jeUs, (double)s.summe / s.anzahl / jeUs, MYDBG_profilGrenzeUs(MYDBG_profilPerzentil(s, 0.5f)),
+                      MYDBG_profilGrenzeUs(MYDBG_profilPerzentil(s, 0.99f)), s.max / jeUs);
+    }
+} // Ende der Funktion MYDBG_profilAnzeigen
+
+// === Flugschreiber ===
+// Die letzten MYDBG_FLUG_ANZAHL Aufrufe – auch MYDBG(0, ...) und Aufrufe ohne Ausgabe – liegen als kompakte
+// Einträge in RAM, der beim Neustart nicht gelöscht wird. Nach Watchdog, Panic oder Brownout stehen sie so in
+// /mydbg_watchdog.json, auch wenn sie nie ins Dateisystem geschrieben wurden.
+// Jeder Platz trägt eine laufende Nummer und eine CRC; halb geschriebene oder zerstörte Plätze werden verworfen.
+#ifndef MYDBG_OHNE_FLUGSCHREIBER
+#define MYDBG_FLUG_MAGIC 0x464C5547u // "FLUG"
+#define MYDBG_FLUG_VERSION 1
+
+// Speicherbereich des Flugschreibers
+struct MYDBG_MemRegion
+{
+    void *daten;
+    size_t groesse;
+}; // Ende der Struktur MYDBG_MemRegion
+
+struct MYDBG_FlugPlatz
+{
+    MYDBG_LogRecord rec;
+    uint32_t nr;  // laufende Nummer, 1 = erster Eintrag seit dem Anlegen
+    uint32_t crc; // über rec und nr
+}; // Ende der Struktur MYDBG_FlugPlatz
+
+struct MYDBG_FlugSpeicher
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t plaetze;
+    volatile uint32_t kopf; // Nummer des zuletzt geschriebenen Eintrags
+    uint32_t exportiert;    // Einträge bis zu dieser Nummer stehen schon in /mydbg_watchdog.json
+    MYDBG_FlugPlatz platz[MYDBG_FLUG_ANZAHL];
+}; // Ende der Struktur MYDBG_FlugSpeicher
+
+#ifdef MYDBG_FLUG_EIGENE_REGION
+// Vom Projekt bereitgestellt, mindestens sizeof(MYDBG_FlugSpeicher) Byte, z. B. eine per mmap eingeblendete Datei
+MYDBG_MemRegion MYDBG_flugRegion();
+#else
+RTC_NOINIT_ATTR MYDBG_FlugSpeicher MYDBG_flugRtc; // RTC-RAM, übersteht Software-, Watchdog- und Panic-Resets
+
+inline MYDBG_MemRegion MYDBG_flugRegion()
+{
+    return {&MYDBG_flugRtc, sizeof(MYDBG_flugRtc)};
+} // Ende der Funktion MYDBG_flugRegion
+#endif
+
+inline portMUX_TYPE MYDBG_flugMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Ringlogik des Flugschreibers, kennt nur den Speicherbereich
+// Gesperrt wird mit einem kritischen Abschnitt statt mit atomaren Befehlen, die im RTC-RAM nicht funktionieren
+struct MYDBG_Flugschreiber
+{
+    MYDBG_FlugSpeicher *s = nullptr;
+    uint32_t startKopf = 0; // Stand beim ersten Zugriff in diesem Start, ältere Nummern stammen aus früheren Starts
+    uint32_t startExportiert = 0;
+    std::atomic<bool> geprueft{false}; // nach s gesetzt: wer true liest, sieht s und die Startwerte
+
+    static uint32_t pruefsumme(const MYDBG_FlugPlatz &p)
+    {
+        return esp_rom_crc32_le(0, (const uint8_t *)&p, offsetof(MYDBG_FlugPlatz, crc));
+    }
+
+    // Übernimmt den Inhalt aus dem letzten Start oder legt den Speicher neu an (Kaltstart, andere Version)
+    bool oeffnen()
+    {
+        if (geprueft.load(std::memory_order_acquire))
+            return s != nullptr;
+        MYDBG_MemRegion region = MYDBG_flugRegion();
+        portENTER_CRITICAL(&MYDBG_flugMux);
+        if (!geprueft.load(std::memory_order_relaxed) && region.daten && region.groesse >= sizeof(MYDBG_FlugSpeicher))
+        {
+            MYDBG_FlugSpeicher *f = (MYDBG_FlugSpeicher *)region.daten;
+            if (f->magic != MYDBG_FLUG_MAGIC || f->version != MYDBG_FLUG_VERSION ||
+                f->plaetze != MYDBG_FLUG_ANZAHL || f->exportiert > f->kopf)
+            {
+                memset(f, 0, sizeof(MYDBG_FlugSpeicher));
+                f->magic = MYDBG_FLUG_MAGIC;
+                f->version = MYDBG_FLUG_VERSION;
+                f->plaetze = MYDBG_FLUG_ANZAHL;
+            }
+            startKopf = f->kopf;
+            startExportiert = f->exportiert;
+            s = f;
+        }
+        geprueft.store(true, std::memory_order_release);
+        portEXIT_CRITICAL(&MYDBG_flugMux);
+        return s != nullptr;
+    }
+
+    // Kopie eines Eintrags, der Kopf rückt erst nach, wenn der Platz vollständig ist
+    void schreiben(const MYDBG_LogRecord &rec)
+    {
+        if (!oeffnen())
+            return;
+        portENTER_CRITICAL(&MYDBG_flugMux);
+        uint32_t nr = s->kopf + 1;
+        MYDBG_FlugPlatz &p = s->platz[(nr - 1) % MYDBG_FLUG_ANZAHL];
+        p.rec = rec;
+        p.nr = nr;
+        p.crc = pruefsumme(p);
+        s->kopf = nr;
+        portEXIT_CRITICAL(&MYDBG_flugMux);
+    }
+
+    // Ruft f für jeden gültigen, noch nicht exportierten Eintrag früherer Starts auf (älteste zuerst),
+    // höchstens für die ersten hoechstens
+    template <typename F>
+    uint32_t vorherige(F f, uint32_t hoechstens = UINT32_MAX)
+    {
+        if (!oeffnen())
+            return 0;
+        uint32_t kopf = s->kopf;
+        uint32_t ab = kopf > MYDBG_FLUG_ANZAHL ? kopf - MYDBG_FLUG_ANZAHL : 0; // ältere Plätze sind überschrieben
+        if (ab < startExportiert)
+            ab = startExportiert;
+        uint32_t anzahl = 0;
+        for (uint32_t nr = ab + 1; nr <= startKopf && anzahl < hoechstens; nr++)
+        {
+            MYDBG_FlugPlatz p;
+            portENTER_CRITICAL(&MYDBG_flugMux);
+            p = s->platz[(nr - 1) % MYDBG_FLUG_ANZAHL];
+            portEXIT_CRITICAL(&MYDBG_flugMux);
+            if (p.nr != nr || p.crc != pruefsumme(p))
+                continue;
+            f(p.rec);
+            anzahl++;
+        }
+        return anzahl;
+    }
+
+    // Einträge früherer Starts beim nächsten Start nicht erneut melden
+    void vergessen()
+    {
+        if (oeffnen())
+            s->exportiert = startKopf;
+    }
+}; // Ende der Struktur MYDBG_Flugschreiber
+
+inline MYDBG_Flugschreiber MYDBG_flug;
+#endif // MYDBG_OHNE_FLUGSCHREIBER
+
+// Resetarten, nach denen der Zustand vor dem Reset interessiert
+inline bool MYDBG_resetKritisch(esp_reset_reason_t rsn)
+{
+    switch (rsn)
+    {
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+    case ESP_RST_BROWNOUT:
+        return true;
+    default:
+        return false;
+    }
+} // Ende der Funktion MYDBG_resetKritisch
+
+// Schreibt einen Eintrag mit Klartext in ein JSON-Objekt für /mydbg_watchdog.json
+inline void MYDBG_eintragNachJson(const MYDBG_LogRecord &rec, JsonObject obj)
+{
+    char zeit[30];
+    MYDBG_formatZeit(MYDBG_unixZeit(rec), zeit, sizeof(zeit));
+    MYDBG_Klartext k;
+    MYDBG_klartext(rec, k);
+    obj["timestamp"] = zeit;
+    obj["millis"] = rec.mikros / 1000;
+    obj["site"] = rec.site;
+    obj["pgmFunc"] = k.func;
+    obj["pgmZeile"] = k.zeile;
+    obj["level"] = rec.stufe;
+    obj["suppressed"] = rec.unterdrueckt;
+    obj["msg"] = k.msg;
+    obj["varName"] = k.varName;
+    obj["varValue"] = k.varValue;
+} // Ende der Funktion MYDBG_eintragNachJson
+
+// Speichert den Watchdog mit dem MYDBUG(x, ...) vor dem Watchdog-Reset
+// Nach einem kritischen Reset stammt der letzte Eintrag aus dem Flugschreiber, die Einträge davor stehen unter "flug"
+inline void MYDBG_writeWatchdogRestartFromLastLog()
+{
+    
+    if (alreadyWritten)
+        return;
+    alreadyWritten = true;
+
+    if (!MYDBG_ring.bereit)
+        MYDBG_ringInit();
+
+    esp_reset_reason_t rsn = MYDBG_resetGrund();
+    bool kritisch = MYDBG_resetKritisch(rsn);
+
+    // neuester Eintrag: aus dem Flugschreiber, sonst aus dem Ringpuffer
+    MYDBG_LogRecord lastEntry;
+    bool gefunden = false;
+    uint32_t flugAnzahl = 0;
+#ifndef MYDBG_OHNE_FLUGSCHREIBER
+    if (kritisch)
+    {
+        flugAnzahl = MYDBG_flug.vorherige([&](const MYDBG_LogRecord &rec)
+                                          { lastEntry = rec; });
+        gefunden = flugAnzahl > 0;
+    }
+    MYDBG_flug.vergessen();
+#endif
+    if (!gefunden)
+    {
+        MYDBG_RingLeser leser;
+        leser.oeffnen(1);
+        gefunden = leser.naechster(lastEntry);
+        leser.schliessen();
+    }
+    if (!gefunden)
+        return;
+
+    // Watchdog-Log vorbereiten
+    JsonDocument wdDoc; // höchstens MYDBG_MAX_WATCHDOGS Einträge, nur der jüngste mit "flug"
+    if (LittleFS.exists("/mydbg_watchdog.json"))
+    {
+        File f = LittleFS.open("/mydbg_watchdog.json", "r");
+        if (f)
+        {
+            deserializeJson(wdDoc, f);
+            f.close();
+        }
+    }
+
+    JsonArray wdArr = wdDoc["watchdogs"].is<JsonArray>() ? wdDoc["watchdogs"].as<JsonArray>() : wdDoc["watchdogs"].to<JsonArray>();
+    for (JsonObject alt : wdArr)
+        alt.remove("flug"); // nur der jüngste Reset behält seine Vorgeschichte
+    while (wdArr.size() >= MYDBG_MAX_WATCHDOGS)
+        wdArr.remove(0); // älteste Resets zuerst verwerfen
+
+    JsonObject copy = wdArr.add<JsonObject>();
+    MYDBG_eintragNachJson(lastEntry, copy);
+    copy["resetReason"] = lastEntry.resetReason;
+
+    MYDBG_ResetInfo info = MYDBG_interpretResetReason(rsn);
+    copy["ResetGrund"] = info.text;
+    copy["reason"] = (int)rsn;
+    copy["kritisch"] = kritisch; // Markiere kritische Resetarten
+
+#ifndef MYDBG_OHNE_FLUGSCHREIBER
+    if (flugAnzahl > 1)
+    {
+        JsonArray flug = copy["flug"].to<JsonArray>(); // ohne den neuesten, der steht schon oben
+        MYDBG_flug.vorherige([&](const MYDBG_LogRecord &rec)
+                             { MYDBG_eintragNachJson(rec, flug.add<JsonObject>()); },
+                             flugAnzahl - 1);
+    }
+#endif
+
+    File out = LittleFS.open("/mydbg_watchdog.json", "w");
+    if (out)
+    {
+        serializeJson(wdDoc, out);
+        out.close();
+    }
+} // Ende der Funktion MYDBG_writeWatchdogRestartFromLastLog
+
+// === WebSocket-Bündelung ===
+// Ein Frame enthält ein JSON-Array mit mehreren Einträgen. Ist die Sendewarteschlange eines Clients voll,
+// bekommt er das Bündel nicht; die Anzahl übersprungener Einträge erhält er danach als eigenen Frame {"skipped":n}.
+//
+// Ein Client kann mit dem Kommando FORMAT_MSGPACK auf Binär-Frames umschalten (FORMAT_JSON schaltet zurück).
+// Er bekommt dann dasselbe Bündel als MessagePack-Array von Tabellen mit Zahlen als Schlüsseln (MYDBG_MP_...).
+// Ohne Feld MYDBG_MP_ART ist eine Tabelle ein Eintrag. Texte der Aufrufstelle gehen einmal je Client als
+// eigene Tabelle (Art 1) voraus; Resetgrund, Farbe und Größe des Dateisystems kommen einmal nach dem Umschalten
+// (Art 2). Zustandswerte (verworfen, Dateisystem frei, Heap-Minimum, WLAN-Pegel) fehlen, wenn sie sich seit dem
+// vorigen Eintrag im selben Bündel nicht geändert haben. Gebaut wird jede Form nur, solange ein Client sie will.
+//
+// Jeder Client hat ein Abo (MYDBG_WsAbo), das er mit ABO level=..&func=..&exclude=..&every=.. setzt. Geprüft wird,
+// bevor ein Eintrag kodiert wird: Einträge, die kein Client will, kosten weder JSON noch MessagePack noch Platz in
+// einer Sendewarteschlange. Im Bündel trägt jeder Eintrag die Bits seiner Empfänger; wer nur einen Teil bekommt,
+// erhält einen eigenen Frame mit genau seinen Einträgen. PROTOKOLL_AUS/PROTOKOLL_EIN gelten nur für den Client,
+// der sie sendet; Konsole, Ringpuffer und andere Clients laufen weiter.
+#define MYDBG_WS_JSON 0
+#define MYDBG_WS_MSGPACK 1
+
+#define MYDBG_MP_ART 0 // 1 = Aufrufstelle, 2 = Verbindung; fehlt bei Einträgen
+// Eintrag
+#define MYDBG_MP_SITE 1     // ID der Aufrufstelle
+#define MYDBG_MP_MILLIS 2   // ms seit Start
+#define MYDBG_MP_ZEIT 3     // Ortszeit als Sekunden seit 1970 (wie UTC formatieren), 0 = keine Zeit
+#define MYDBG_MP_WERT 4     // Wert mit seinem Typ: Zahl, Wahrheitswert, Text oder nil
+#define MYDBG_MP_GEDROSSELT 5
+#define MYDBG_MP_VERWORFEN 6
+#define MYDBG_MP_FS_FREI_KB 7 // -1 = Dateisystem nicht bereit
+#define MYDBG_MP_HEAP_FREI 8
+#define MYDBG_MP_HEAP_MIN 9
+#define MYDBG_MP_HEAP_BLOCK 10
+#define MYDBG_MP_STACK_FREI 11
+#define MYDBG_MP_RSSI 12
+// Aufrufstelle (Art 1): MYDBG_MP_SITE und
+#define MYDBG_MP_ZEILE 2
+#define MYDBG_MP_FUNC 3
+#define MYDBG_MP_MSG 4
+#define MYDBG_MP_VARNAME 5
+#define MYDBG_MP_TYP 6 // MYDBG_Typ, die Seite formatiert danach den Wert
+// Verbindung (Art 2)
+#define MYDBG_MP_RESET 1
+#define MYDBG_MP_RESET_TEXT 2
+#define MYDBG_MP_RESET_FARBE 3
+#define MYDBG_MP_FS_GESAMT_KB 4
+
+#define MYDBG_MP_EINTRAG_MAX 160 // größter kodierter Eintrag
+#define MYDBG_MP_KOPF 3          // Platz für den Kopf des Arrays vor dem ersten Eintrag
+
+// MessagePack direkt in einen Puffer, ohne Heap (nur die Formen, die MYDBG sendet; Zahlen so kurz wie möglich).
+// Passt etwas nicht mehr, wird voll gesetzt und nichts mehr geschrieben.
+struct MYDBG_MsgPack
+{
+    uint8_t *daten;
+    size_t groesse;
+    size_t laenge;
+    bool voll = false;
+
+    MYDBG_MsgPack(uint8_t *ziel, size_t n, size_t start = 0) : daten(ziel), groesse(n), laenge(start) {}
+
+    // Typbyte und wert mit bytes Byte, höchstwertiges zuerst
+    MYDBG_MsgPack &kopf(uint8_t typ, uint64_t wert = 0, uint8_t bytes = 0)
+    {
+        if (voll || laenge + 1 + bytes > groesse)
+        {
+            voll = true;
+            return *this;
+        }
+        daten[laenge++] = typ;
+        while (bytes--)
+            daten[laenge++] = (uint8_t)(wert >> (8 * bytes));
+        return *this;
+    }
+
+    MYDBG_MsgPack &zahl(uint64_t w)
+    {
+        if (w < 0x80)
+            return kopf((uint8_t)w);
+        if (w <= 0xFF)
+            return kopf(0xcc, w, 1);
+        if (w <= 0xFFFF)
+            return kopf(0xcd, w, 2);
+        if (w <= 0xFFFFFFFF)
+            return kopf(0xce, w, 4);
+        return kopf(0xcf, w, 8);
+    }
+
+    MYDBG_MsgPack &zahlMitVorzeichen(int64_t w)
+    {
+        if (w >= 0)
+            return zahl((uint64_t)w);
+        if (w >= -32)
+            return kopf((uint8_t)w);
+        if (w >= INT8_MIN)
+            return kopf(0xd0, (uint8_t)w, 1);
+        if (w >= INT16_MIN)
+            return kopf(0xd1, (uint16_t)w, 2);
+        if (w >= INT32_MIN)
+            return kopf(0xd2, (uint32_t)w, 4);
+        return kopf(0xd3, (uint64_t)w, 8);
+    }
+
+    // float32, wenn der Wert dabei erhalten bleibt, sonst float64
+    MYDBG_MsgPack &komma(double w)
+    {
+        float f = (float)w;
+        if ((double)f == w)
+        {
+            uint32_t bits;
+            memcpy(&bits, &f, 4);
+            return kopf(0xca, bits, 4);
+        }
+        uint64_t bits;
+        memcpy(&bits, &w, 8);
+        return kopf(0xcb, bits, 8);
+    }
+
+    MYDBG_MsgPack &wahrheit(bool w) { return kopf(w ? 0xc3 : 0xc2); }
+    MYDBG_MsgPack &nil() { return kopf(0xc0); }
+
+    MYDBG_MsgPack &text(const char *s, size_t max = 0xFFFF)
+    {
+        size_t n = min(strlen(s ? s : ""), max);
+        if (n < 32)
+            kopf(0xa0 | n);
+        else if (n <= 0xFF)
+            kopf(0xd9, n, 1);
+        else
+            kopf(0xda, n, 2);
+        if (!voll && laenge + n > groesse)
+            voll = true;
+        if (!voll)
+        {
+            memcpy(daten + laenge, s, n);
+            laenge += n;
+        }
+        return *this;
+    }
+
+    // Tabelle mit bis zu 15 Feldern; die Anzahl kann mit felder() nachgetragen werden
+    MYDBG_MsgPack &tabelle(uint8_t n = 0) { return kopf(0x80 | n); }
+    void felder(size_t tabellePos, uint8_t n)
+    {
+        if (!voll)
+            daten[tabellePos] = 0x80 | n;
+    }
+}; // Ende der Struktur MYDBG_MsgPack
+
+// Abo eines Clients, z. B. ABO level=3&func=loop,messen&exclude=wlanTask&every=10
+// level = Mindeststufe, func = nur diese Funktionen, exclude = diese Funktionen nie (Namen durch Komma getrennt),
+// every = nur jeder n-te passende Eintrag. Fehlende Parameter lassen alles durch, ABO ohne Parameter hebt den Filter auf.
+struct MYDBG_WsAbo
+{
+    bool aus = false;   // PROTOKOLL_AUS: keine Einträge an diesen Client
+    uint8_t stufe = 0;  // Mindeststufe (wait-Stufe des Aufrufs)
+    uint16_t jeder = 1; // jeder n-te passende Eintrag
+    char func[MYDBG_WS_ABO_TEXT] = "";
+    char ohne[MYDBG_WS_ABO_TEXT] = "";
+
+    // Übernimmt einen Parameter, false = unbekannt oder ungültig
+    bool setzen(const char *name, const char *wert)
+    {
+        if (strcmp(name, "func") == 0 || strcmp(name, "exclude") == 0)
+        {
+            if (strlen(wert) >= MYDBG_WS_ABO_TEXT)
+                return false;
+            MYDBG_kopiere(name[0] == 'f' ? func : ohne, MYDBG_WS_ABO_TEXT, wert);
+            return true;
+        }
+        char *ende;
+        unsigned long zahl = strtoul(wert, &ende, 10);
+        if (!*wert || *ende || *wert == '-')
+            return false;
+        if (strcmp(name, "level") == 0 && zahl <= 9)
+            stufe = zahl;
+        else if (strcmp(name, "every") == 0 && zahl >= 1 && zahl <= 0xFFFF)
+            jeder = zahl;
+        else
+            return false;
+        return true;
+    }
+
+    // Liest "level=3&func=loop&..." in ein neues Abo (aus bleibt); bei einem Fehler bleibt alles, wie es war
+    bool lesen(const char *text)
+    {
+        MYDBG_WsAbo neu;
+        neu.aus = aus;
+        char buf[2 * MYDBG_WS_ABO_TEXT + 48];
+        if (strlen(text) >= sizeof(buf))
+            return false;
+        MYDBG_kopiere(buf, sizeof(buf), text);
+        char *rest = buf;
+        while (*rest)
+        {
+            char *name = rest;
+            rest += strcspn(rest, "&");
+            if (*rest)
+                *rest++ = '\0';
+            char *wert = strchr(name, '=');
+            if (!wert)
+                return false;
+            *wert++ = '\0';
+            if (!neu.setzen(name, wert))
+                return false;
+        }
+        *this = neu;
+        return true;
+    }
+
+    // Steht name in der Liste "a,b,c"?
+    static bool inListe(const char *liste, const char *name)
+    {
+        size_t n = strlen(name);
+        for (const char *p = liste; *p;)
+        {
+            size_t laenge = strcspn(p, ",");
+            if (laenge == n && strncmp(p, name, n) == 0)
+                return true;
+            p += laenge;
+            if (*p)
+                p++;
+        }
+        return false;
+    }
+
+    bool funcPasst(const char *name) const { return (!func[0] || inListe(func, name)) && !inListe(ohne, name); }
+    bool nachSite() const { return func[0] || ohne[0]; }
+}; // Ende der Struktur MYDBG_WsAbo
+
+struct MYDBG_WsClient
+{
+    uint32_t id;
+    uint32_t uebersprungen;
+    uint8_t format; // MYDBG_WS_JSON oder MYDBG_WS_MSGPACK
+}; // Ende der Struktur MYDBG_WsClient
+
+// Kopie eines Clients für den Ausgabe-Kontext (unter MYDBG_Sperre, ohne MYDBG_wsMux). Wird erneuert, sobald sich
+// Clients, Format oder Abo ändern; die Bits der Einträge im Bündel beziehen sich auf die Plätze dieser Liste.
+struct MYDBG_WsEmpfaenger
+{
+    uint32_t id;
+    uint8_t format;
+    MYDBG_WsAbo abo;
+    uint16_t zaehler;    // passende Einträge seit dem letzten, den er bekommen hat (every)
+    uint32_t siteId[16]; // kleiner Cache wie bei /mydbg_query: Ergebnis des Funktionsvergleichs je Aufrufstelle
+    bool sitePasst[16];
+}; // Ende der Struktur MYDBG_WsEmpfaenger
+
+// Ein Eintrag im Bündel: Lage in beiden Formen (Länge 0 = in dieser Form nicht gebaut) und seine Empfänger
+struct MYDBG_WsTeil
+{
+    uint32_t site;
+    uint16_t text, textLaenge;
+    uint16_t mp, mpLaenge;
+    uint8_t empfaenger; // Bit i = MYDBG_wsBuendel.empfaenger[i]
+}; // Ende der Struktur MYDBG_WsTeil
+static_assert(MYDBG_WS_MAX_CLIENTS <= 8, "MYDBG_WS_MAX_CLIENTS: höchstens 8 (ein Bit je Client)");
+static_assert(MYDBG_WS_BUENDEL_BYTES <= 0xFFFF && MYDBG_WS_MP_BYTES <= 0xFFFF, "WebSocket-Bündel: höchstens 64 kB");
+
+// Zustandswerte des vorigen MessagePack-Eintrags im Bündel
+struct MYDBG_MpStand
+{
+    bool gueltig;
+    uint32_t verworfen;
+    int32_t fsFreiKb;
+    uint32_t heapMin;
+    int32_t rssi;
+}; // Ende der Struktur MYDBG_MpStand
+
+struct MYDBG_WsBuendel
+{
+    char text[MYDBG_WS_BUENDEL_BYTES];
+    size_t laenge = 0;
+    uint16_t anzahl = 0; // Einträge im Bündel
+    uint8_t mp[MYDBG_WS_MP_BYTES];
+    size_t mpLaenge = 0;
+    MYDBG_MpStand mpStand = {};
+    uint8_t mpEmpfaenger = 0; // Empfänger des vorigen MessagePack-Eintrags
+    MYDBG_WsTeil teile[MYDBG_WS_BUENDEL];
+    uint32_t startMs = 0;
+    MYDBG_WsEmpfaenger empfaenger[MYDBG_WS_MAX_CLIENTS]; // nur im Ausgabe-Kontext
+    uint8_t empfaengerAnzahl = 0;
+    uint32_t empfaengerStand = 0; // Stand von clientStand, aus dem die Empfänger stammen
+    MYDBG_WsClient clients[MYDBG_WS_MAX_CLIENTS];
+    uint32_t bekannt[MYDBG_WS_MAX_CLIENTS][MYDBG_WS_STELLEN]; // je Client: Stellen mit gesendeten Texten, Platz id % MYDBG_WS_STELLEN
+    MYDBG_WsAbo abos[MYDBG_WS_MAX_CLIENTS];                   // je Client sein Abo
+    uint8_t clientAnzahl = 0;
+    volatile uint32_t clientStand = 0; // zählt jede Änderung an clients (Verbinden, Trennen, Format, Abo)
+    uint32_t uebersprungen = 0;        // Summe über alle Clients (Statistik)
+}; // Ende der Struktur MYDBG_WsBuendel
+
+inline MYDBG_WsBuendel MYDBG_wsBuendel;
+inline portMUX_TYPE MYDBG_wsMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Client beim Verbinden/Trennen in der Liste führen (läuft im Kontext des WebSocket-Servers)
+// false: schon MYDBG_WS_MAX_CLIENTS verbunden, der Client ist nicht aufgenommen
+inline bool MYDBG_wsClientNeu(uint32_t id)
+{
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    bool aufgenommen = b.clientAnzahl < MYDBG_WS_MAX_CLIENTS;
+    if (aufgenommen)
+    {
+        b.clients[b.clientAnzahl] = {id, 0, MYDBG_WS_JSON};
+        b.abos[b.clientAnzahl] = MYDBG_WsAbo();
+        b.clientAnzahl++;
+        b.clientStand++;
+        MYDBG_webClientActive = true;
+    }
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+    return aufgenommen;
+} // Ende der Funktion MYDBG_wsClientNeu
+
+inline void MYDBG_wsClientWeg(uint32_t id)
+{
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    for (uint8_t i = 0; i < b.clientAnzahl; i++)
+    {
+        if (b.clients[i].id == id)
+        {
+            b.clientAnzahl--;
+            b.clients[i] = b.clients[b.clientAnzahl];
+            memcpy(b.bekannt[i], b.bekannt[b.clientAnzahl], sizeof(b.bekannt[i]));
+            b.abos[i] = b.abos[b.clientAnzahl];
+            b.clientStand++;
+            break;
+        }
+    }
+    MYDBG_webClientActive = b.clientAnzahl > 0;
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+} // Ende der Funktion MYDBG_wsClientWeg
+
+// FORMAT_JSON / FORMAT_MSGPACK: Format eines Clients umschalten. Ein MessagePack-Client bekommt sofort die
+// Angaben zur Verbindung, die Texte der Aufrufstellen folgen mit den Einträgen.
+inline void MYDBG_wsFormat(AsyncWebSocketClient *client, uint8_t format)
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    for (uint8_t i = 0; i < b.clientAnzahl; i++)
+    {
+        if (b.clients[i].id == client->id())
+        {
+            b.clients[i].format = format;
+            memset(b.bekannt[i], 0, sizeof(b.bekannt[i]));
+            b.clientStand++;
+        }
+    }
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+    if (format != MYDBG_WS_MSGPACK)
+        return;
+
+    MYDBG_ResetInfo info = MYDBG_interpretResetReason(MYDBG_resetGrund());
+    uint8_t buf[96];
+    MYDBG_MsgPack mp(buf, sizeof(buf));
+    mp.kopf(0x91).tabelle(5);
+    mp.zahl(MYDBG_MP_ART).zahl(2);
+    mp.zahl(MYDBG_MP_RESET).zahl((int)MYDBG_resetGrund());
+    mp.zahl(MYDBG_MP_RESET_TEXT).text(info.text);
+    mp.zahl(MYDBG_MP_RESET_FARBE).text(info.farbe);
+    mp.zahl(MYDBG_MP_FS_GESAMT_KB).zahl(MYDBG_system.fsGesamt / 1024);
+    if (!mp.voll)
+        client->binary(buf, mp.laenge);
+} // Ende der Funktion MYDBG_wsFormat
+
+// ABO <parameter> (parameter != nullptr): Filter des Clients ersetzen; sonst PROTOKOLL_AUS/EIN (aus) für diesen Client.
+// Gilt ab dem nächsten Bündel; false, wenn die Parameter ungültig sind oder der Client unbekannt ist.
+inline bool MYDBG_wsAboAendern(uint32_t id, const char *parameter, bool aus = false)
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    MYDBG_WsAbo abo;
+    bool gefunden = false;
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    for (uint8_t i = 0; i < b.clientAnzahl; i++)
+    {
+        if (b.clients[i].id == id)
+        {
+            abo = b.abos[i];
+            gefunden = true;
+        }
+    }
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+    if (!gefunden)
+        return false;
+    if (parameter)
+    {
+        if (!abo.lesen(parameter)) // Texte außerhalb der Sperre zerlegen
+            return false;
+    }
+    else
+    {
+        abo.aus = aus;
+    }
+
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    for (uint8_t i = 0; i < b.clientAnzahl; i++)
+    {
+        if (b.clients[i].id == id)
+        {
+            b.abos[i] = abo;
+            b.clientStand++;
+        }
+    }
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+    return true;
+} // Ende der Funktion MYDBG_wsAboAendern
+
+// Übernimmt Clients, Formate und Abos in die Empfängerliste des Ausgabe-Kontexts. Nur bei leerem Bündel aufrufen.
+// Der Zähler für every bleibt je Client erhalten.
+inline void MYDBG_wsEmpfaengerAbgleichen()
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    uint32_t altId[MYDBG_WS_MAX_CLIENTS];
+    uint16_t altZaehler[MYDBG_WS_MAX_CLIENTS];
+    uint8_t altAnzahl = b.empfaengerAnzahl;
+    for (uint8_t i = 0; i < altAnzahl; i++)
+    {
+        altId[i] = b.empfaenger[i].id;
+        altZaehler[i] = b.empfaenger[i].zaehler;
+    }
+
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    for (uint8_t i = 0; i < b.clientAnzahl; i++)
+    {
+        b.empfaenger[i].id = b.clients[i].id;
+        b.empfaenger[i].format = b.clients[i].format;
+        b.empfaenger[i].abo = b.abos[i];
+    }
+    b.empfaengerAnzahl = b.clientAnzahl;
+    b.empfaengerStand = b.clientStand;
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+
+    for (uint8_t i = 0; i < b.empfaengerAnzahl; i++)
+    {
+        MYDBG_WsEmpfaenger &e = b.empfaenger[i];
+        e.zaehler = 0;
+        for (uint8_t j = 0; j < altAnzahl; j++)
+        {
+            if (altId[j] == e.id)
+                e.zaehler = altZaehler[j];
+        }
+        memset(e.siteId, 0, sizeof(e.siteId)); // Abo kann sich geändert haben
+    }
+} // Ende der Funktion MYDBG_wsEmpfaengerAbgleichen
+
+// Bits der Empfänger, deren Abo den Eintrag will – vor dem Kodieren. Je Client ein paar Vergleiche, die Funktion
+// wird nur beim ersten Eintrag einer Aufrufstelle (oder nach einer Kollision im Cache) mit den Listen verglichen.
+inline uint8_t MYDBG_wsEmpfaengerFuer(const MYDBG_LogRecord &rec)
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    uint8_t bits = 0;
+    for (uint8_t i = 0; i < b.empfaengerAnzahl; i++)
+    {
+        MYDBG_WsEmpfaenger &e = b.empfaenger[i];
+        if (e.abo.aus || rec.stufe < e.abo.stufe)
+            continue;
+        if (e.abo.nachSite())
+        {
+            uint8_t platz = rec.site & 15;
+            if (e.siteId[platz] != rec.site)
+            {
+                MYDBG_Klartext k;
+                MYDBG_siteTexte(rec.site, k);
+                e.siteId[platz] = rec.site;
+                e.sitePasst[platz] = e.abo.funcPasst(k.func);
+            }
+            if (!e.sitePasst[platz])
+                continue;
+        }
+        if (++e.zaehler < e.abo.jeder)
+            continue;
+        e.zaehler = 0;
+        bits |= 1 << i;
+    }
+    return bits;
+} // Ende der Funktion MYDBG_wsEmpfaengerFuer
+
+// Texte der Aufrufstellen seiner Einträge (Bit im Bündel), die der Client noch nicht hat, je Stelle als eigener Frame.
+// Merkt sie als bekannt; teilen sich zwei Stellen den Platz id % MYDBG_WS_STELLEN, wird eine später erneut gesendet.
+inline void MYDBG_wsStellenSenden(AsyncWebSocketClient *client, uint8_t bit)
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    uint32_t neu[MYDBG_WS_BUENDEL];
+    uint8_t neuAnzahl = 0;
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    for (uint8_t i = 0; i < b.clientAnzahl; i++)
+    {
+        if (b.clients[i].id != client->id())
+            continue;
+        for (uint16_t t = 0; t < b.anzahl; t++)
+        {
+            uint32_t site = b.teile[t].site;
+            uint32_t &platz = b.bekannt[i][site % MYDBG_WS_STELLEN];
+            if ((b.teile[t].empfaenger & bit) && platz != site)
+            {
+                platz = site;
+                neu[neuAnzahl++] = site;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+
+    for (uint8_t s = 0; s < neuAnzahl; s++)
+    {
+        MYDBG_Klartext k;
+        MYDBG_siteTexte(neu[s], k);
+        uint8_t buf[24 + 3 * MYDBG_SITE_TEXT_MAX];
+        MYDBG_MsgPack mp(buf, sizeof(buf));
+        mp.kopf(0x91).tabelle(7);
+        mp.zahl(MYDBG_MP_ART).zahl(1);
+        mp.zahl(MYDBG_MP_SITE).zahl(neu[s]);
+        mp.zahl(MYDBG_MP_ZEILE).zahl(k.zeile);
+        mp.zahl(MYDBG_MP_FUNC).text(k.func, MYDBG_SITE_TEXT_MAX); // wie in /mydbg_sites.bin gekürzt
+        mp.zahl(MYDBG_MP_MSG).text(k.msg, MYDBG_SITE_TEXT_MAX);
+        mp.zahl(MYDBG_MP_VARNAME).text(k.varName, MYDBG_SITE_TEXT_MAX);
+        mp.zahl(MYDBG_MP_TYP).zahl(k.typ);
+        if (!mp.voll)
+            client->binary(buf, mp.laenge);
+    }
+} // Ende der Funktion MYDBG_wsStellenSenden
+
+// Frame mit den Einträgen eines Clients, der nur einen Teil des Bündels bekommt (Bit im Bündel), in einer Form.
+// Wird direkt im Puffer der Bibliothek zusammengesetzt: eine Anforderung und eine Kopie wie beim ganzen Bündel.
+inline bool MYDBG_wsAuszugSenden(AsyncWebSocketClient *client, uint8_t bit, uint16_t anzahl, bool mp)
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    size_t laenge = mp ? (anzahl <= 15 ? 1 : 3) : 1 + anzahl; // Kopf bzw. '[', Kommas und ']'
+    for (uint16_t t = 0; t < b.anzahl; t++)
+    {
+        if (b.teile[t].empfaenger & bit)
+            laenge += mp ? b.teile[t].mpLaenge : b.teile[t].textLaenge;
+    }
+    AsyncWebSocketMessageBuffer *puffer = MYDBG_ws.makeBuffer(laenge);
+    if (!puffer || !puffer->get())
+        return false;
+    uint8_t *p = puffer->get();
+    if (!mp)
+        *p++ = '[';
+    else if (anzahl <= 15)
+        *p++ = 0x90 | anzahl;
+    else
+        *p++ = 0xdc, *p++ = (uint8_t)(anzahl >> 8), *p++ = (uint8_t)anzahl;
+    for (uint16_t t = 0, n = 0; t < b.anzahl; t++)
+    {
+        const MYDBG_WsTeil &teil = b.teile[t];
+        if (!(teil.empfaenger & bit))
+            continue;
+        if (mp)
+        {
+            memcpy(p, b.mp + teil.mp, teil.mpLaenge);
+            p += teil.mpLaenge;
+            continue;
+        }
+        if (n++ > 0)
+            *p++ = ',';
+        memcpy(p, b.text + teil.text, teil.textLaenge);
+        p += teil.textLaenge;
+    }
+    if (mp)
+    {
+        client->binary(puffer);
+    }
+    else
+    {
+        *p = ']';
+        client->text(puffer);
+    }
+    return true;
+} // Ende der Funktion MYDBG_wsAuszugSenden
+
+// Sendet das gesammelte Bündel an alle Clients, die noch Platz in ihrer Warteschlange haben. Jeder bekommt seine
+// Einträge in seinem Format; fehlen darin Einträge (Format gerade umgeschaltet), in der anderen Form, sonst gar nicht.
+// Wer alle Einträge bekommt, erhält das Bündel unverändert, die anderen einen Auszug (MYDBG_wsAuszugSenden).
+inline void MYDBG_wsSenden()
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    if (b.anzahl == 0)
+        return;
+    b.text[b.laenge++] = ']';
+    // Kopf des Arrays direkt vor den ersten Eintrag
+    size_t mpStart = MYDBG_MP_KOPF - 1;
+    if (b.anzahl <= 15)
+    {
+        b.mp[mpStart] = 0x90 | b.anzahl;
+    }
+    else
+    {
+        mpStart = 0;
+        b.mp[0] = 0xdc;
+        b.mp[1] = (uint8_t)(b.anzahl >> 8);
+        b.mp[2] = (uint8_t)b.anzahl;
+    }
+
+    MYDBG_WsClient clients[MYDBG_WS_MAX_CLIENTS];
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    uint8_t clientAnzahl = b.clientAnzahl;
+    memcpy(clients, b.clients, sizeof(clients[0]) * clientAnzahl);
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+
+    for (uint8_t i = 0; i < clientAnzahl; i++)
+    {
+        MYDBG_WsClient &c = clients[i];
+        AsyncWebSocketClient *client = MYDBG_ws.client(c.id);
+        if (!client || client->status() != WS_CONNECTED)
+            continue;
+        if (c.uebersprungen > 0 && !client->queueIsFull())
+        {
+            char info[48];
+            int n = snprintf(info, sizeof(info), "{\"skipped\":%u}", (unsigned)c.uebersprungen);
+            client->text(info, n);
+            c.uebersprungen = 0;
+        }
+        // Einträge dieses Clients; ein erst nach dem Bündeln verbundener Client steht nicht in der Empfängerliste
+        uint8_t bit = 0;
+        for (uint8_t j = 0; j < b.empfaengerAnzahl; j++)
+        {
+            if (b.empfaenger[j].id == c.id)
+                bit = 1 << j;
+        }
+        uint16_t anzahl = 0, textAnzahl = 0, mpAnzahl = 0;
+        for (uint16_t t = 0; t < b.anzahl; t++)
+        {
+            if (!(b.teile[t].empfaenger & bit))
+                continue;
+            anzahl++;
+            textAnzahl += b.teile[t].textLaenge > 0;
+            mpAnzahl += b.teile[t].mpLaenge > 0;
+        }
+        if (anzahl == 0)
+            continue;
+        bool mpVoll = mpAnzahl == anzahl, textVoll = textAnzahl == anzahl;
+        if (client->queueIsFull() || (!mpVoll && !textVoll))
+        {
+            c.uebersprungen += anzahl;
+            b.uebersprungen += anzahl;
+            continue;
+        }
+        bool mp = mpVoll && (c.format == MYDBG_WS_MSGPACK || !textVoll);
+        if (mp)
+            MYDBG_wsStellenSenden(client, bit);
+        if (anzahl == b.anzahl && mp)
+        {
+            client->binary(b.mp + mpStart, b.mpLaenge - mpStart);
+        }
+        else if (anzahl == b.anzahl)
+        {
+            client->text(b.text, b.laenge);
+        }
+        else if (!MYDBG_wsAuszugSenden(client, bit, anzahl, mp))
+        {
+            c.uebersprungen += anzahl; // kein Speicher für den Auszug
+            b.uebersprungen += anzahl;
+        }
+    }
+
+    // Zähler zurückschreiben (Clients können sich inzwischen getrennt haben)
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    for (uint8_t i = 0; i < clientAnzahl; i++)
+    {
+        for (uint8_t j = 0; j < b.clientAnzahl; j++)
+        {
+            if (b.clients[j].id == clients[i].id)
+                b.clients[j].uebersprungen = clients[i].uebersprungen;
+        }
+    }
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+
+    b.laenge = 0;
+    b.anzahl = 0;
+} // Ende der Funktion MYDBG_wsSenden
+
+// Sendet das Bündel, wenn sein Zeitfenster abgelaufen ist
+inline void MYDBG_wsPruefen()
+{
+    if (MYDBG_wsBuendel.anzahl > 0 && millis() - MYDBG_wsBuendel.startMs >= MYDBG_WS_FENSTER_MS)
+        MYDBG_wsSenden();
+} // Ende der Funktion MYDBG_wsPruefen
+
+// Ortszeit als Sekunden seit 1970: im Browser wie UTC formatiert ergibt sie dieselbe Anzeige wie MYDBG_formatZeit
+inline uint32_t MYDBG_ortszeit(uint32_t zeit)
+{
+    if (zeit == 0)
+        return 0;
+    time_t t = (time_t)zeit;
+    struct tm tm;
+    localtime_r(&t, &tm);
+    // Tage seit 1970-01-01 aus dem Kalenderdatum (proleptischer gregorianischer Kalender)
+    int32_t jahr = tm.tm_year + 1900 - (tm.tm_mon < 2);
+    int32_t era = (jahr >= 0 ? jahr : jahr - 399) / 400;
+    uint32_t jahrInEra = (uint32_t)(jahr - era * 400);
+    uint32_t tagImJahr = (153 * (tm.tm_mon + (tm.tm_mon < 2 ? 10 : -2)) + 2) / 5 + tm.tm_mday - 1;
+    uint32_t tagInEra = jahrInEra * 365 + jahrInEra / 4 - jahrInEra / 100 + tagImJahr;
+    int64_t tage = (int64_t)era * 146097 + tagInEra - 719468;
+    return (uint32_t)(tage * 86400 + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec);
+} // Ende der Funktion MYDBG_ortszeit
+
+// Eintrag als JSON-Objekt (ein Element des Bündels)
+inline void MYDBG_wsJsonZeile(const MYDBG_LogRecord &rec, MYDBG_Puffer &json)
+{
+    char zeit[30];
+    MYDBG_formatZeit(MYDBG_unixZeit(rec), zeit, sizeof(zeit));
+    MYDBG_Klartext k;
+    MYDBG_klartext(rec, k);
+    const MYDBG_SystemZustand &z = MYDBG_system; // nur zwischengespeicherte Werte, keine Abfragen pro Eintrag
+    MYDBG_ResetInfo info = MYDBG_interpretResetReason(MYDBG_resetGrund());
+
+    json << "{\"timestamp\":\"" << zeit << "\",\"pgmFunc\":\"";
+    json.json(k.func) << "\",\"pgmZeile\":" << k.zeile << ",\"msg\":\"";
+    json.json(k.msg) << "\",\"varName\":\"";
+    json.json(k.varName) << "\",\"varValue\":\"";
+    json.json(k.varValue) << "\",\"millis\":" << rec.mikros / 1000 << ",\"dropped\":" << (uint32_t)MYDBG_verworfen
+                          << ",\"suppressed\":" << rec.unterdrueckt
+                          << ",\"resetReason\":" << (int)MYDBG_resetGrund() << ",\"ResetGrund\":\"" << info.text
+                          << "\",\"ResetColor\":\"" << info.farbe << "\""; // Farbe nur fürs Web nötig
+
+    if (z.fsGesamt > 0)
+    {
+        float freiProzent = 100.0 - (z.fsBelegt * 100.0) / z.fsGesamt;
+        json << ",\"fs_free_kb\":" << (z.fsGesamt - z.fsBelegt) / 1024 << ",\"fs_free_percent\":" << freiProzent;
+    }
+    else
+    {
+        json << ",\"fs_free_kb\":-1,\"fs_free_percent\":-1";
+    }
+    MYDBG_GesundheitWert g;
+    if (MYDBG_gesundheitAuspacken(rec, g)) // beim Aufruf erfasst
+        json << ",\"heap_free\":" << g.heapFrei << ",\"heap_block\":" << g.heapBlock << ",\"heap_min\":" << g.heapMin
+             << ",\"stack_free\":" << g.stackFrei;
+    else
+        json << ",\"heap_free\":" << z.heapFrei << ",\"heap_min\":" << z.heapMin;
+    json << ",\"rssi\":" << z.rssi << "}";
+} // Ende der Funktion MYDBG_wsJsonZeile
+
+// Hängt einen Eintrag für die Empfänger (Bits) als MessagePack-Tabelle an b.mp an; false, wenn er nicht passt
+inline bool MYDBG_wsMpEintrag(const MYDBG_LogRecord &rec, uint8_t empfaenger)
+{
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    const MYDBG_SystemZustand &z = MYDBG_system;
+    MYDBG_MpStand neu = {true, (uint32_t)MYDBG_verworfen,
+                         z.fsGesamt > 0 ? (int32_t)((z.fsGesamt - z.fsBelegt) / 1024) : -1, z.heapMin, (int32_t)z.rssi};
+    MYDBG_GesundheitWert g;
+    bool gesundheit = MYDBG_gesundheitAuspacken(rec, g);
+    if (gesundheit)
+        neu.heapMin = g.heapMin;
+
+    MYDBG_MsgPack mp(b.mp, sizeof(b.mp), b.mpLaenge);
+    size_t tabelle = mp.laenge;
+    uint8_t felder = 4;
+    mp.tabelle();
+    mp.zahl(MYDBG_MP_SITE).zahl(rec.site);
+    mp.zahl(MYDBG_MP_MILLIS).zahl(rec.mikros / 1000);
+    mp.zahl(MYDBG_MP_ZEIT).zahl(MYDBG_ortszeit(MYDBG_unixZeit(rec)));
+    mp.zahl(MYDBG_MP_WERT);
+    switch (rec.typ)
+    {
+    case MYDBG_TYP_INT:
+        mp.zahlMitVorzeichen(rec.wert.i);
+        break;
+    case MYDBG_TYP_UINT:
+        mp.zahl(rec.wert.u);
+        break;
+    case MYDBG_TYP_FLOAT:
+        mp.komma(rec.wert.f);
+        break;
+    case MYDBG_TYP_BOOL:
+        mp.wahrheit(rec.wert.u != 0);
+        break;
+    case MYDBG_TYP_TEXT:
+        mp.text(rec.wert.text);
+        break;
+    default:
+        mp.nil();
+        break;
+    }
+    if (rec.unterdrueckt)
+        mp.zahl(MYDBG_MP_GEDROSSELT).zahl(rec.unterdrueckt), felder++;
+    MYDBG_MpStand alt = b.mpStand;
+    if (empfaenger & ~b.mpEmpfaenger)
+        alt.gueltig = false; // ein Empfänger hat den vorigen Eintrag nicht bekommen: alle Zustandswerte mitsenden
+    if (!alt.gueltig || alt.verworfen != neu.verworfen)
+        mp.zahl(MYDBG_MP_VERWORFEN).zahl(neu.verworfen), felder++;
+    if (!alt.gueltig || alt.fsFreiKb != neu.fsFreiKb)
+        mp.zahl(MYDBG_MP_FS_FREI_KB).zahlMitVorzeichen(neu.fsFreiKb), felder++;
+    mp.zahl(MYDBG_MP_HEAP_FREI).zahl(gesundheit ? g.heapFrei : z.heapFrei), felder++;
+    if (!alt.gueltig || alt.heapMin != neu.heapMin)
+        mp.zahl(MYDBG_MP_HEAP_MIN).zahl(neu.heapMin), felder++;
+    if (gesundheit)
+    {
+        mp.zahl(MYDBG_MP_HEAP_BLOCK).zahl(g.heapBlock);
+        mp.zahl(MYDBG_MP_STACK_FREI).zahl(g.stackFrei);
+        felder += 2;
+    }
+    if (!alt.gueltig || alt.rssi != neu.rssi)
+        mp.zahl(MYDBG_MP_RSSI).zahlMitVorzeichen(neu.rssi), felder++;
+    mp.felder(tabelle, felder);
+    if (mp.voll)
+        return false;
+    b.mpLaenge = mp.laenge;
+    b.mpStand = neu;
+    b.mpEmpfaenger = empfaenger;
+    return true;
+} // Ende der Funktion MYDBG_wsMpEintrag
+
+// Eintrag an die WebSocket-Clients, deren Abo ihn will: gesammelt als JSON und/oder MessagePack, je nachdem,
+// welche Formen diese Clients wollen. Will ihn keiner, wird er gar nicht kodiert.
+inline void MYDBG_streamWebLineJSON(const MYDBG_LogRecord &rec)
+{
+    if (!MYDBG_webClientActive)
+        return;
+    MYDBG_WsBuendel &b = MYDBG_wsBuendel;
+    if (b.empfaengerStand != b.clientStand)
+    {
+        MYDBG_wsSenden(); // die Bits im Bündel gelten für die bisherige Empfängerliste
+        MYDBG_wsEmpfaengerAbgleichen();
+    }
+    uint8_t empfaenger = MYDBG_wsEmpfaengerFuer(rec);
+    if (!empfaenger)
+        return;
+    bool json = false, mp = false;
+    for (uint8_t i = 0; i < b.empfaengerAnzahl; i++)
+    {
+        if (empfaenger & (1 << i))
+            (b.empfaenger[i].format == MYDBG_WS_MSGPACK ? mp : json) = true;
+    }
+
+    // JSON direkt im Stack-Puffer aufbauen (kein JsonDocument, kein String)
+    MYDBG_Zeile<MYDBG_CHUNK_ZEILE> zeile;
+    if (json)
+        MYDBG_wsJsonZeile(rec, zeile);
+    if (zeile.laenge + 2 > sizeof(b.text))
+        json = false;
+
+    // Passt der Eintrag in einer der Formen nicht mehr, erst das bisherige Bündel senden
+    if (b.anzahl > 0 && ((json && b.laenge + zeile.laenge + 2 > sizeof(b.text)) || // Platz für ',' und ']'
+                         (mp && b.mpLaenge + MYDBG_MP_EINTRAG_MAX > sizeof(b.mp))))
+        MYDBG_wsSenden();
+    if (b.anzahl == 0)
+    {
+        b.text[0] = '[';
+        b.laenge = 1;
+        b.mpLaenge = MYDBG_MP_KOPF;
+        b.mpStand = {};
+        b.mpEmpfaenger = 0;
+        b.startMs = millis();
+    }
+    MYDBG_WsTeil &teil = b.teile[b.anzahl];
+    teil = {rec.site, 0, 0, 0, 0, empfaenger};
+    if (json)
+    {
+        if (b.laenge > 1)
+            b.text[b.laenge++] = ',';
+        memcpy(b.text + b.laenge, zeile.text, zeile.laenge);
+        teil.text = b.laenge;
+        teil.textLaenge = zeile.laenge;
+        b.laenge += zeile.laenge;
+    }
+    size_t mpVorher = b.mpLaenge;
+    if (mp && MYDBG_wsMpEintrag(rec, empfaenger))
+    {
+        teil.mp = mpVorher;
+        teil.mpLaenge = b.mpLaenge - mpVorher;
+    }
+    b.anzahl++;
+    if (b.anzahl >= MYDBG_WS_BUENDEL)
+        MYDBG_wsSenden();
+    else
+        MYDBG_wsPruefen();
+} // Ende der Funktion MYDBG_streamWebLineJSON
+
+// === Variablen beobachten ===
+// MYDBG_WATCH(var) trägt Adresse und Typ einer langlebigen Variable ein (global oder static, nie eine lokale).
+// Ein esp_timer liest alle MYDBG_watchIntervallMs jede eingetragene Variable und hängt den Wert delta-kodiert an
+// den festen Ring der Variable an: Differenz zum vorigen Wert im Zickzack-Code als Varint, float/double als
+// Bitmuster. Ein unveränderter oder um wenige Schritte geänderter Wert braucht so 1 Byte. Der Ring besteht aus
+// Blöcken zu MYDBG_WATCH_BLOCK Byte; jeder Block beginnt mit dem vollen Wert, Startzeit und Abstand, damit
+// nach dem Überschreiben des ältesten Blocks der Rest lesbar bleibt. Der Abtaster liest nur und kopiert ein paar
+// Bytes, die Hauptschleife hält er nicht an. Neue Werte schickt der Task "MYDBG_watch" höchstens alle
+// MYDBG_WATCH_FRAME_MS als ein Frame über /dbgws, den ganzen Verlauf liefert GET /mydbg_watch.json.
+// Speicher: sizeof(MYDBG_Watch) je Stelle, statisch und fest (wird beim Eintragen gemeldet).
+#define MYDBG_WATCH_BLOCK 64 // Datenbytes je Block (1 bis 10 Byte je Wert)
+#define MYDBG_WATCH_BLOECKE (MYDBG_WATCH_BYTES / MYDBG_WATCH_BLOCK)
+#define MYDBG_WATCH_TASK_STACK 4096
+static_assert(MYDBG_WATCH_BLOECKE >= 2 && MYDBG_WATCH_BLOECKE <= 255, "MYDBG_WATCH_BYTES muss zwischen 128 und 16320 liegen");
+
+enum MYDBG_WatchTyp : uint8_t
+{
+    MYDBG_WATCH_I8,
+    MYDBG_WATCH_U8,
+    MYDBG_WATCH_I16,
+    MYDBG_WATCH_U16,
+    MYDBG_WATCH_I32,
+    MYDBG_WATCH_U32,
+    MYDBG_WATCH_I64,
+    MYDBG_WATCH_U64,
+    MYDBG_WATCH_F32,
+    MYDBG_WATCH_F64,
+    MYDBG_WATCH_BOOL
+};
+
+inline const char *MYDBG_watchTypName(MYDBG_WatchTyp typ)
+{
+    static const char *const namen[] = {"i8", "u8", "i16", "u16", "i32", "u32", "i64", "u64", "f32", "f64", "bool"};
+    return typ <= MYDBG_WATCH_BOOL ? namen[typ] : "?";
+} // Ende der Funktion MYDBG_watchTypName
+
+// Typ zur Übersetzungszeit: Ganzzahlen bis 64 Bit, float, double, bool und Aufzählungen
+template <typename T>
+constexpr MYDBG_WatchTyp MYDBG_watchTyp()
+{
+    if constexpr (std::is_enum<T>::value)
+    {
+        return MYDBG_watchTyp<typename std::underlying_type<T>::type>();
+    }
+    else
+    {
+        static_assert(std::is_arithmetic<T>::value && sizeof(T) <= 8, "MYDBG_WATCH: nur Zahlen, bool und enum");
+        if constexpr (std::is_same<T, bool>::value)
+            return MYDBG_WATCH_BOOL;
+        else if constexpr (std::is_floating_point<T>::value)
+            return sizeof(T) == 4 ? MYDBG_WATCH_F32 : MYDBG_WATCH_F64;
+        else
+            return (MYDBG_WatchTyp)((sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 2 : sizeof(T) == 4 ? 4 : 6) + (std::is_signed<T>::value ? 0 : 1));
+    }
+} // Ende der Funktion MYDBG_watchTyp
+
+struct MYDBG_WatchBlock
+{
+    uint32_t nr;          // Nummer der ersten Probe
+    uint32_t startMs;     // Zeitpunkt der ersten Probe (ms seit Start)
+    uint16_t intervallMs; // Abstand der Proben
+    uint8_t anzahl;       // Proben im Block
+    uint8_t laenge;       // belegte Datenbytes
+    uint8_t daten[MYDBG_WATCH_BLOCK];
+}; // Ende der Struktur MYDBG_WatchBlock
+
+struct MYDBG_Watch
+{
+    const char *name;
+    const volatile void *adresse;
+    MYDBG_WatchTyp typ;
+    bool eingetragen = false;
+    uint8_t block = 0;     // Block, in den geschrieben wird
+    uint32_t nr = 0;       // Anzahl bisheriger Proben
+    uint32_t gesendet = 0; // erste noch nicht über /dbgws gesendete Probe
+    int64_t letzter = 0;   // Rohwert der letzten Probe, Basis des nächsten Deltas
+    MYDBG_Watch *naechste = nullptr;
+    MYDBG_WatchBlock bloecke[MYDBG_WATCH_BLOECKE] = {};
+}; // Ende der Struktur MYDBG_Watch
+
+inline MYDBG_Watch *MYDBG_watchListe = nullptr;
+inline portMUX_TYPE MYDBG_watchMux = portMUX_INITIALIZER_UNLOCKED;
+inline uint16_t MYDBG_watchIntervallMs = MYDBG_WATCH_INTERVALL_MS; // mit MYDBG_setzeWatchIntervall() ändern
+inline esp_timer_handle_t MYDBG_watchTimer = nullptr;
+
+// Aktueller Wert als Rohwert: Ganzzahlen vorzeichenrichtig, float/double als Bitmuster.
+// 64-Bit-Werte liest die CPU in zwei Schritten; ändert sie der Besitzer genau dazwischen, stimmt eine Probe nicht.
+inline int64_t MYDBG_watchRoh(const MYDBG_Watch &w)
+{
+    const volatile void *a = w.adresse;
+    switch (w.typ)
+    {
+    case MYDBG_WATCH_I8:
+        return *(const volatile int8_t *)a;
+    case MYDBG_WATCH_U8:
+        return *(const volatile uint8_t *)a;
+    case MYDBG_WATCH_BOOL:
+        return *(const volatile uint8_t *)a != 0;
+    case MYDBG_WATCH_I16:
+        return *(const volatile int16_t *)a;
+    case MYDBG_WATCH_U16:
+        return *(const volatile uint16_t *)a;
+    case MYDBG_WATCH_I32:
+        return *(const volatile int32_t *)a;
+    case MYDBG_WATCH_U32:
+        return *(const volatile uint32_t *)a;
+    case MYDBG_WATCH_F32:
+    {
+        float f = *(const volatile float *)a;
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+    case MYDBG_WATCH_F64:
+    {
+        double d = *(const volatile double *)a;
+        int64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        return bits;
+    }
+    default:
+        return *(const volatile int64_t *)a;
+    }
+} // Ende der Funktion MYDBG_watchRoh
+
+// Zickzack: kleine Differenzen in beide Richtungen werden kleine vorzeichenlose Zahlen (0, -1, 1, -2 … → 0, 1, 2, 3 …)
+inline uint64_t MYDBG_zickzack(int64_t v)
+{
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+} // Ende der Funktion MYDBG_zickzack
+
+// Varint: 7 Bit je Byte, oberstes Bit = es folgt noch ein Byte; Rückgabe: Anzahl Bytes (1…10)
+inline uint8_t MYDBG_varintSchreiben(uint8_t *ziel, uint64_t v)
+{
+    uint8_t n = 0;
+    while (v >= 0x80)
+    {
+        ziel[n++] = (uint8_t)v | 0x80;
+        v >>= 7;
+    }
+    ziel[n++] = (uint8_t)v;
+    return n;
+} // Ende der Funktion MYDBG_varintSchreiben
+
+// Hängt eine Probe an. Passt sie nicht mehr in den Block, hat sich das Intervall geändert oder kam der Timer
+// verspätet, beginnt der nächste Block (der älteste wird überschrieben) mit dem vollen Wert.
+inline void MYDBG_watchSpeichern(MYDBG_Watch &w, int64_t roh, uint32_t jetztMs, uint16_t intervallMs)
+{
+    MYDBG_WatchBlock *b = &w.bloecke[w.block];
+    uint8_t kodiert[10];
+    uint8_t n = MYDBG_varintSchreiben(kodiert, MYDBG_zickzack((int64_t)((uint64_t)roh - (uint64_t)w.letzter)));
+    uint32_t erwartet = b->startMs + (uint32_t)b->anzahl * b->intervallMs;
+    if (b->anzahl == 0 || b->intervallMs != intervallMs || b->laenge + n > MYDBG_WATCH_BLOCK ||
+        (int32_t)(jetztMs - erwartet) > (int32_t)intervallMs)
+    {
+        if (b->anzahl > 0)
+        {
+            w.block = (w.block + 1) % MYDBG_WATCH_BLOECKE;
+            b = &w.bloecke[w.block];
+        }
+        b->nr = w.nr;
+        b->startMs = jetztMs;
+        b->intervallMs = intervallMs;
+        b->anzahl = 0;
+        b->laenge = 0;
+        n = MYDBG_varintSchreiben(kodiert, MYDBG_zickzack(roh)); // erster Wert im Block: Differenz zu 0
+    }
+    memcpy(b->daten + b->laenge, kodiert, n);
+    b->laenge += n;
+    b->anzahl++;
+    w.letzter = roh;
+    w.nr++;
+} // Ende der Funktion MYDBG_watchSpeichern
+
+// Callback des Abtast-Timers (Task esp_timer): liest alle Variablen, kurz unter MYDBG_watchMux
+inline void MYDBG_watchAbtasten(void *)
+{
+    uint32_t jetztMs = (uint32_t)(esp_timer_get_time() / 1000);
+    uint16_t intervallMs = MYDBG_watchIntervallMs;
+    portENTER_CRITICAL(&MYDBG_watchMux);
+    for (MYDBG_Watch *w = MYDBG_watchListe; w; w = w->naechste)
+        MYDBG_watchSpeichern(*w, MYDBG_watchRoh(*w), jetztMs, intervallMs);
+    portEXIT_CRITICAL(&MYDBG_watchMux);
+} // Ende der Funktion MYDBG_watchAbtasten
+
+// Liest einen kopierten Block Probe für Probe
+struct MYDBG_WatchLeser
+{
+    MYDBG_WatchBlock b;
+    uint8_t pos = 0; // nächstes Datenbyte
+    uint8_t i = 0;   // gelesene Proben
+    int64_t roh = 0; // Rohwert der zuletzt gelesenen Probe
+
+    // Kopiert Block k unter MYDBG_watchMux, damit der Abtaster ihn nicht halb beschrieben übergibt
+    void laden(const MYDBG_Watch &w, uint8_t k)
+    {
+        portENTER_CRITICAL(&MYDBG_watchMux);
+        b = w.bloecke[k];
+        portEXIT_CRITICAL(&MYDBG_watchMux);
+        pos = 0;
+        i = 0;
+        roh = 0;
+    }
+
+    bool naechste()
+    {
+        uint64_t v = 0;
+        for (uint8_t shift = 0; i < b.anzahl && pos < b.laenge && shift < 64; shift += 7)
+        {
+            uint8_t c = b.daten[pos++];
+            v |= (uint64_t)(c & 0x7F) << shift;
+            if (!(c & 0x80))
+            {
+                roh = (int64_t)((uint64_t)roh + ((v >> 1) ^ (~(v & 1) + 1)));
+                i++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t nr() const { return b.nr + i - 1; }
+    uint32_t zeitMs() const { return b.startMs + (uint32_t)(i - 1) * b.intervallMs; }
+}; // Ende der Struktur MYDBG_WatchLeser
+
+// Rohwert als JSON-Zahl (nicht endliche Gleitkommawerte als null)
+inline void MYDBG_watchWert(MYDBG_Puffer &z, MYDBG_WatchTyp typ, int64_t roh)
+{
+    if (typ == MYDBG_WATCH_F32 || typ == MYDBG_WATCH_F64)
+    {
+        double d;
+        if (typ == MYDBG_WATCH_F32)
+        {
+            uint32_t bits = (uint32_t)roh;
+            float f;
+            memcpy(&f, &bits, sizeof(f));
+            d = f;
+        }
+        else
+        {
+            memcpy(&d, &roh, sizeof(d));
+        }
+        if (isfinite(d))
+            z.printf("%.*g", typ == MYDBG_WATCH_F32 ? 7 : 15, d);
+        else
+            z << "null";
+    }
+    else if (typ == MYDBG_WATCH_U64)
+    {
+        z.printf("%llu", (unsigned long long)roh);
+    }
+    else
+    {
+        z.printf("%lld", (long long)roh);
+    }
+} // Ende der Funktion MYDBG_watchWert
+
+// Schickt die seit dem letzten Frame neuen Werte aller Variablen als ein Frame an alle Clients:
+// {"watch":[{"name":"zyklus","segments":[[t0,dt,[w1,w2,…]]]}]} mit t0 in ms seit Start und dt in ms.
+// Passt nicht alles in den Frame, folgt der Rest mit dem nächsten. Ohne Client wird nichts aufgehoben.
+inline void MYDBG_watchSenden()
+{
+    bool aktiv = MYDBG_webClientActive;
+    MYDBG_Zeile<1536> frame; // Stack der Watch-Task ist knapp
+    frame << "{\"watch\":[";
+    size_t leer = frame.laenge;
+    for (MYDBG_Watch *w = MYDBG_watchListe; w; w = w->naechste)
+    {
+        if (!aktiv)
+        {
+            w->gesendet = w->nr;
+            continue;
+        }
+        if (frame.frei() < 160)
+            break;
+        size_t anfang = frame.laenge;
+        if (anfang > leer)
+            frame << ",";
+        frame << "{\"name\":\"";
+        frame.json(w->name) << "\",\"segments\":[";
+        size_t ohneWerte = frame.laenge;
+
+        MYDBG_WatchLeser l;
+        uint8_t start = w->block;
+        for (unsigned j = 1; j <= MYDBG_WATCH_BLOECKE && frame.frei() >= 48; j++)
+        {
+            l.laden(*w, (start + j) % MYDBG_WATCH_BLOECKE);
+            if (l.b.anzahl == 0 || (int32_t)(l.b.nr + l.b.anzahl - w->gesendet) <= 0)
+                continue;
+            bool offen = false;
+            while (frame.frei() >= 48 && l.naechste())
+            {
+                if ((int32_t)(l.nr() - w->gesendet) < 0)
+                    continue;
+                if (!offen)
+                    frame.printf("%s[%u,%u,[", frame.laenge > ohneWerte ? "," : "", (unsigned)l.zeitMs(), (unsigned)l.b.intervallMs);
+                else
+                    frame << ",";
+                offen = true;
+                MYDBG_watchWert(frame, w->typ, l.roh);
+                w->gesendet = l.nr() + 1;
+            }
+            if (offen)
+                frame << "]]";
+        }
+        if (frame.laenge == ohneWerte)
+        {
+            frame.laenge = anfang; // nichts Neues: Variable weglassen
+            frame.text[anfang] = '\0';
+        }
+        else
+        {
+            frame << "]}";
+        }
+    }
+    if (frame.laenge == leer)
+        return;
+    frame << "]}";
+
+    MYDBG_WsClient clients[MYDBG_WS_MAX_CLIENTS];
+    portENTER_CRITICAL(&MYDBG_wsMux);
+    uint8_t clientAnzahl = MYDBG_wsBuendel.clientAnzahl;
+    memcpy(clients, MYDBG_wsBuendel.clients, sizeof(clients[0]) * clientAnzahl);
+    portEXIT_CRITICAL(&MYDBG_wsMux);
+    for (uint8_t i = 0; i < clientAnzahl; i++)
+    {
+        AsyncWebSocketClient *client = MYDBG_ws.client(clients[i].id);
+        if (client && client->status() == WS_CONNECTED && !client->queueIsFull())
+            client->text(frame.text, frame.laenge); // volle Warteschlange: Frame fällt weg, die Kurve bekommt eine Lücke
+    }
+} // Ende der Funktion MYDBG_watchSenden
+
+// Task "MYDBG_watch": begrenzt die Frame-Rate auf einen Frame je MYDBG_WATCH_FRAME_MS
+inline void MYDBG_watchTask(void *)
+{
+    for (;;)
+    {
+        vTaskDelay(pdMS_TO_TICKS(MYDBG_WATCH_FRAME_MS));
+        MYDBG_watchSenden();
+    }
+} // Ende der Funktion MYDBG_watchTask
+
+// Startet Abtast-Timer und Sende-Task (einmalig, beim ersten MYDBG_WATCH)
+inline void MYDBG_watchStart()
+{
+    static std::atomic<bool> gestartet{false};
+    if (gestartet.exchange(true))
+        return;
+    esp_timer_create_args_t args = {};
+    args.callback = MYDBG_watchAbtasten;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "mydbg_watch";
+    args.skip_unhandled_events = true; // verpasste Termine nicht nachholen, MYDBG_watchSpeichern beginnt dann einen neuen Block
+    if (esp_timer_create(&args, &MYDBG_watchTimer) != ESP_OK ||
+        esp_timer_start_periodic(MYDBG_watchTimer, MYDBG_watchIntervallMs * 1000ULL) != ESP_OK)
+    {
+        Serial.println("[MYDBG] ❌ Abtast-Timer für MYDBG_WATCH ließ sich nicht starten");
+        return;
+    }
+    xTaskCreatePinnedToCore(MYDBG_watchTask, "MYDBG_watch", MYDBG_WATCH_TASK_STACK, nullptr, MYDBG_TASK_PRIO, nullptr, tskNO_AFFINITY);
+} // Ende der Funktion MYDBG_watchStart
+
+// Trägt eine Variable beim ersten Aufruf ein; dieselbe Adresse von einer zweiten Stelle wird nur einmal abgetastet
+inline void MYDBG_watchRegistrieren(MYDBG_Watch &w)
+{
+    if (w.eingetragen)
+        return;
+    bool neu = false;
+    portENTER_CRITICAL(&MYDBG_watchMux);
+    if (!w.eingetragen)
+    {
+        MYDBG_Watch *gleich = MYDBG_watchListe;
+        while (gleich && gleich->adresse != w.adresse)
+            gleich = gleich->naechste;
+        if (!gleich)
+        {
+            w.naechste = MYDBG_watchListe;
+            MYDBG_watchListe = &w;
+            neu = true;
+        }
+        w.eingetragen = true;
+    }
+    portEXIT_CRITICAL(&MYDBG_watchMux);
+    if (!neu)
+        return;
+    Serial.printf("[MYDBG] ✅ Beobachte %s (%s) alle %u ms, %u Byte RAM\n", w.name, MYDBG_watchTypName(w.typ),
+                  (unsigned)MYDBG_watchIntervallMs, (unsigned)sizeof(MYDBG_Watch));
+    MYDBG_watchStart();
+} // Ende der Funktion MYDBG_watchRegistrieren
+
+// Ändert den Abstand der Proben (mindestens 1 ms); laufende Blöcke werden abgeschlossen
+inline void MYDBG_setzeWatchIntervall(uint16_t ms)
+{
+    MYDBG_watchIntervallMs = max<uint16_t>(ms, 1);
+    if (MYDBG_watchTimer)
+    {
+        esp_timer_stop(MYDBG_watchTimer);
+        esp_timer_start_periodic(MYDBG_watchTimer, MYDBG_watchIntervallMs * 1000ULL);
+    }
+} // Ende der Funktion MYDBG_setzeWatchIntervall
+
+#ifndef MYDBG_OHNE_WATCH
+// MYDBG_WATCH(zyklus); – einmal, z. B. in setup(), weitere Aufrufe derselben Stelle kosten nur eine Abfrage
+#define MYDBG_WATCH(var)                                                                                    \
+    do                                                                                                      \
+    {                                                                                                       \
+        static MYDBG_Watch __mydbg_watch = {                                                                \
+            #var, &(var), MYDBG_watchTyp<std::remove_cv_t<std::remove_reference_t<decltype(var)>>>()};     \
+        MYDBG_watchRegistrieren(__mydbg_watch);                                                             \
+    } while (0) // Ende des Makros MYDBG_WATCH
+#else
+#define MYDBG_WATCH(var) MYDBG_ENTFERNT(var)
+#endif
+
+// GET /mydbg_watch.json: {"interval_ms":…,"frame_ms":…,"bytes_per_watch":…,"watch":[{"name","type","segments":[[t0,dt,[…]],…]}]}
+// Blöcke ältester zuerst. Überschreibt der Abtaster während des Streamens einen Block, fehlt dessen alter Inhalt.
+struct MYDBG_WatchQuelle : MYDBG_ChunkQuelle
+{
+    MYDBG_Watch *w = MYDBG_watchListe;
+    MYDBG_WatchLeser l;
+    uint8_t start = 0;      // Schreibblock beim Beginn der Variable, gelesen wird ab dem nächsten
+    uint16_t j = 0;         // 0 = Kopf der Variable, danach Block 1…MYDBG_WATCH_BLOECKE
+    uint8_t teil = 0;       // 0 = Kopf, 1 = Variablen, 2 = fertig
+    bool imBlock = false;
+    bool erstesSegment = true;
+    bool ersterWert = true;
+    uint32_t ab = 0;        // nächste erwartete Probe; ältere Blöcke (schon überschrieben) werden übergangen
+
+    bool naechsteZeile() override
+    {
+        if (teil == 2)
+            return false;
+        MYDBG_Puffer z(zeile, sizeof(zeile));
+        if (teil == 0)
+        {
+            z.printf("{\"interval_ms\":%u,\"frame_ms\":%u,\"bytes_per_watch\":%u,\"watch\":[", (unsigned)MYDBG_watchIntervallMs,
+                     (unsigned)MYDBG_WATCH_FRAME_MS, (unsigned)sizeof(MYDBG_Watch));
+            teil = 1;
+        }
+        while (teil == 1 && z.frei() > 160)
+        {
+            if (!w)
+            {
+                z << "]}";
+                teil = 2;
+            }
+            else if (j == 0)
+            {
+                z << (w != MYDBG_watchListe ? ",{\"name\":\"" : "{\"name\":\"");
+                z.json(w->name).printf("\",\"type\":\"%s\",\"segments\":[", MYDBG_watchTypName(w->typ));
+                start = w->block;
+                j = 1;
+                erstesSegment = true;
+            }
+            else if (!imBlock)
+            {
+                if (j > MYDBG_WATCH_BLOECKE)
+                {
+                    z << "]}";
+                    w = w->naechste;
+                    j = 0;
+                    continue;
+                }
+                l.laden(*w, (start + j++) % MYDBG_WATCH_BLOECKE);
+                if (l.b.anzahl == 0 || (!erstesSegment && (int32_t)(l.b.nr - ab) < 0))
+                    continue;
+                z.printf("%s[%u,%u,[", erstesSegment ? "" : ",", (unsigned)l.b.startMs, (unsigned)l.b.intervallMs);
+                erstesSegment = false;
+                ersterWert = true;
+                imBlock = true;
+            }
+            else if (l.naechste())
+            {
+                if (!ersterWert)
+                    z << ",";
+                ersterWert = false;
+                MYDBG_watchWert(z, w->typ, l.roh);
+            }
+            else
+            {
+                z << "]]";
+                ab = l.b.nr + l.b.anzahl;
+                imBlock = false;
+            }
+        }
+        laenge = z.laenge;
+        return true;
+    }
+}; // Ende der Struktur MYDBG_WatchQuelle
+
+// === Heap und Stack ===
+// Jeder Eintrag von MYDBG(1…9, ...) trägt freien Heap, größten freien Block, Heap-Minimum seit Start und die
+// Stack-Reserve des aufrufenden Tasks (MYDBG_gesundheitEinpacken). Die Heap-Werte liest der Aufruf aus dem
+// Zwischenspeicher des Abtasters, die Stack-Reserve je Task höchstens einmal je MYDBG_GESUNDHEIT_INTERVALL_MS.
+// Ein esp_timer tastet alle MYDBG_GESUNDHEIT_INTERVALL_MS ab und führt einen Trend mit festen
+// MYDBG_GESUNDHEIT_PUNKTE Punkten: Ist er voll, werden je zwei Punkte zu einem zusammengefasst und jeder
+// weitere Punkt deckt doppelt so viele Abtastungen ab. So reicht derselbe Speicher vom Start bis jetzt, nach
+// einer Woche mit einer Auflösung von gut zwei Stunden. Aus dem Trend ermittelt MYDBG_leckAnalyse per
+// Ausgleichsgerade, ob freier Heap oder größter Block stetig sinken. GET /mydbg_health.json, Menüpunkt 0.
+#define MYDBG_STACK_TASKS 8 // Tasks mit eigener Stack-Reserve im Zwischenspeicher
+
+// Ein Punkt des Trends: Minima über seinen Abschnitt
+struct MYDBG_GesundheitPunkt
+{
+    uint32_t zeitS; // Beginn des Abschnitts, s seit Start
+    MYDBG_GesundheitWert w;
+}; // Ende der Struktur MYDBG_GesundheitPunkt
+
+struct MYDBG_StackStand
+{
+    TaskHandle_t task; // nur verglichen, nie benutzt – der Task kann längst beendet sein
+    uint32_t frei;
+    uint32_t geprueftMs;
+    char name[16];
+}; // Ende der Struktur MYDBG_StackStand
+
+struct MYDBG_GesundheitZustand
+{
+    MYDBG_GesundheitWert aktuell = {}; // letzte Abtastung, Stack: kleinste Reserve aller bekannten Tasks
+    bool gueltig = false;
+    MYDBG_GesundheitPunkt punkte[MYDBG_GESUNDHEIT_PUNKTE];
+    uint16_t anzahl = 0;
+    uint32_t jePunkt = 1; // Abtastungen je Punkt, verdoppelt sich bei jedem Zusammenfassen
+    MYDBG_GesundheitPunkt offen = {};
+    uint32_t offenProben = 0;
+    uint32_t neuePunkte = 0; // seit der letzten Prüfung auf ein Leck
+    MYDBG_StackStand tasks[MYDBG_STACK_TASKS] = {};
+    uint8_t taskAnzahl = 0;
+}; // Ende der Struktur MYDBG_GesundheitZustand
+
+inline MYDBG_GesundheitZustand MYDBG_gesundheit;
+inline portMUX_TYPE MYDBG_gesundheitMux = portMUX_INITIALIZER_UNLOCKED;
+inline esp_timer_handle_t MYDBG_gesundheitTimer = nullptr;
+
+inline void MYDBG_gesundheitMin(MYDBG_GesundheitWert &ziel, const MYDBG_GesundheitWert &w)
+{
+    ziel.heapFrei = min(ziel.heapFrei, w.heapFrei);
+    ziel.heapBlock = min(ziel.heapBlock, w.heapBlock);
+    ziel.heapMin = min(ziel.heapMin, w.heapMin);
+    ziel.stackFrei = min(ziel.stackFrei, w.stackFrei);
+} // Ende der Funktion MYDBG_gesundheitMin
+
+// Stack-Reserve des aufrufenden Tasks. uxTaskGetStackHighWaterMark durchsucht den unbenutzten Teil des Stacks,
+// daher je Task höchstens einmal je MYDBG_GESUNDHEIT_INTERVALL_MS; dazwischen gilt der zwischengespeicherte Wert
+inline uint32_t MYDBG_stackFrei()
+{
+    MYDBG_GesundheitZustand &g = MYDBG_gesundheit;
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    uint32_t jetzt = millis();
+    uint8_t i = 0;
+    portENTER_CRITICAL(&MYDBG_gesundheitMux);
+    while (i < g.taskAnzahl && g.tasks[i].task != task)
+        i++;
+    if (i < g.taskAnzahl && jetzt - g.tasks[i].geprueftMs < MYDBG_GESUNDHEIT_INTERVALL_MS)
+    {
+        uint32_t frei = g.tasks[i].frei;
+        portEXIT_CRITICAL(&MYDBG_gesundheitMux);
+        return frei;
+    }
+    portEXIT_CRITICAL(&MYDBG_gesundheitMux);
+
+    uint32_t frei = uxTaskGetStackHighWaterMark(nullptr); // Byte (ESP-IDF)
+    portENTER_CRITICAL(&MYDBG_gesundheitMux);
+    while (i < g.taskAnzahl && g.tasks[i].task != task) // Liste kann inzwischen gewachsen sein
+        i++;
+    if (i == g.taskAnzahl && g.taskAnzahl < MYDBG_STACK_TASKS)
+    {
+        MYDBG_kopiere(g.tasks[i].name, sizeof(g.tasks[i].name), pcTaskGetName(nullptr));
+        g.tasks[i].task = task;
+        g.taskAnzahl++;
+    }
+    if (i < g.taskAnzahl)
+    {
+        g.tasks[i].frei = frei;
+        g.tasks[i].geprueftMs = jetzt;
+    }
+    portEXIT_CRITICAL(&MYDBG_gesundheitMux);
+    return frei;
+} // Ende der Funktion MYDBG_stackFrei
+
+// Heap-Werte direkt vom System (Abtaster und erster Eintrag vor der ersten Abtastung)
+inline void MYDBG_heapMessen(MYDBG_GesundheitWert &w)
+{
+    w.heapFrei = ESP.getFreeHeap();
+    w.heapBlock = ESP.getMaxAllocHeap();
+    w.heapMin = ESP.getMinFreeHeap();
+} // Ende der Funktion MYDBG_heapMessen
+
+// Aus MYDBG_erfassen: Heap aus dem Zwischenspeicher, Stack des aufrufenden Tasks
+inline void MYDBG_gesundheitEintragen(MYDBG_LogRecord &rec)
+{
+#ifndef MYDBG_OHNE_GESUNDHEIT
+    if (!MYDBG_gesundheitJeEintrag || !(rec.flags & MYDBG_FLAG_STOP))
+        return; // MYDBG(0, ...) landet nirgends, wo die Werte gelesen würden
+    MYDBG_GesundheitWert w;
+    portENTER_CRITICAL(&MYDBG_gesundheitMux);
+    bool gueltig = MYDBG_gesundheit.gueltig;
+    w = MYDBG_gesundheit.aktuell;
+    portEXIT_CRITICAL(&MYDBG_gesundheitMux);
+    if (!gueltig)
+        MYDBG_heapMessen(w);
+    w.stackFrei = MYDBG_stackFrei();
+    MYDBG_gesundheitEinpacken(rec, w);
+#endif
+} // Ende der Funktion MYDBG_gesundheitEintragen
+
+// esp_timer-Callback: misst den Heap und schreibt den Trend fort
+inline void MYDBG_gesundheitAbtasten(void *)
+{
+    MYDBG_GesundheitWert w;
+    MYDBG_heapMessen(w); // außerhalb der Sperre, heap_caps_* nimmt selbst eine
+    uint32_t zeitS = (uint32_t)(esp_timer_get_time() / 1000000);
+
+    MYDBG_GesundheitZustand &g = MYDBG_gesundheit;
+    portENTER_CRITICAL(&MYDBG_gesundheitMux);
+    w.stackFrei = UINT32_MAX; // kein Task bekannt
+    for (uint8_t i = 0; i < g.taskAnzahl; i++)
+        w.stackFrei = min(w.stackFrei, g.tasks[i].frei);
+    g.aktuell = w;
+    g.gueltig = true;
+
+    if (g.offenProben == 0)
+        g.offen = {zeitS, w};
+    else
+        MYDBG_gesundheitMin(g.offen.w, w);
+    if (++g.offenProben >= g.jePunkt)
+    {
+        if (g.anzahl == MYDBG_GESUNDHEIT_PUNKTE)
+        {
+            for (uint16_t i = 0; i < MYDBG_GESUNDHEIT_PUNKTE / 2; i++)
+            {
+                MYDBG_GesundheitPunkt p = g.punkte[2 * i];
+                MYDBG_gesundheitMin(p.w, g.punkte[2 * i + 1].w);
+                g.punkte[i] = p;
+            }
+            g.anzahl = MYDBG_GESUNDHEIT_PUNKTE / 2;
+            g.jePunkt *= 2;
+        }
+        g.punkte[g.anzahl++] = g.offen;
+        g.offenProben = 0;
+        g.neuePunkte++;
+    }
+    portEXIT_CRITICAL(&MYDBG_gesundheitMux);
+} // Ende der Funktion MYDBG_gesundheitAbtasten
+
+// Startet den Abtaster (einmalig, aus MYDBG_autoInit)
+inline void MYDBG_gesundheitStart()
+{
+#ifndef MYDBG_OHNE_GESUNDHEIT
+    static std::atomic<bool> gestartet{false};
+    if (gestartet.load(std::memory_order_relaxed) || gestartet.exchange(true))
+        return;
+    esp_timer_create_args_t args = {};
+    args.callback = MYDBG_gesundheitAbtasten;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "mydbg_health";
+    args.skip_unhandled_events = true;
+    if (esp_timer_create(&args, &MYDBG_gesundheitTimer) != ESP_OK ||
+        esp_timer_start_periodic(MYDBG_gesundheitTimer, MYDBG_GESUNDHEIT_INTERVALL_MS * 1000ULL) != ESP_OK)
+        Serial.println("[MYDBG] ❌ Abtast-Timer für Heap und Stack ließ sich nicht starten");
+#endif
+} // Ende der Funktion MYDBG_gesundheitStart
+
+// Kopie des Trends, damit Auswertung und Ausgabe den Abtaster nicht aufhalten
+struct MYDBG_GesundheitKopie
+{
+    MYDBG_GesundheitPunkt punkte[MYDBG_GESUNDHEIT_PUNKTE];
+    uint16_t anzahl = 0;
+    uint32_t jePunkt = 1;
+    MYDBG_GesundheitWert aktuell = {};
+    bool gueltig = false;
+    MYDBG_StackStand tasks[MYDBG_STACK_TASKS];
+    uint8_t taskAnzahl = 0;
+
+    void laden()
+    {
+        const MYDBG_GesundheitZustand &g = MYDBG_gesundheit;
+        portENTER_CRITICAL(&MYDBG_gesundheitMux);
+        anzahl = g.anzahl;
+        memcpy(punkte, g.punkte, anzahl * sizeof(MYDBG_GesundheitPunkt));
+        jePunkt = g.jePunkt;
+        aktuell = g.aktuell;
+        gueltig = g.gueltig;
+        taskAnzahl = g.taskAnzahl;
+        memcpy(tasks, g.tasks, sizeof(tasks));
+        portEXIT_CRITICAL(&MYDBG_gesundheitMux);
+    }
+}; // Ende der Struktur MYDBG_GesundheitKopie
+
+// Ergebnis der Ausgleichsgeraden über den Trend nach dem Anlauf (höchstens die jüngere Hälfte des Rings)
+struct MYDBG_LeckBefund
+{
+    float heapProH = 0;  // Steigung des freien Heaps, Byte je Stunde
+    float blockProH = 0; // Steigung des größten Blocks
+    float heapR2 = 0;    // Bestimmtheitsmaß: 1 = alle Punkte auf der Geraden, nahe 0 = nur Rauschen
+    float blockR2 = 0;
+    uint32_t fensterS = 0; // ausgewertete Zeitspanne
+    uint16_t punkte = 0;
+    bool leck = false;        // freier Heap sinkt stetig um mehr als MYDBG_LECK_BYTES_PRO_H
+    bool zerfall = false;     // größter Block sinkt stetig, freier Heap nicht: Fragmentierung
+    bool stackKnapp = false;  // ein Task hatte weniger als MYDBG_STACK_WARNUNG Byte Reserve
+    float stundenBisLeer = -1; // bei gleichbleibendem Leck, -1 = kein Leck
+}; // Ende der Struktur MYDBG_LeckBefund
+
+// Kleinste Quadrate über y(x), in einem Durchlauf ohne Zwischenspeicher
+struct MYDBG_Gerade
+{
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0, syy = 0;
+
+    void dazu(double x, double y)
+    {
+        n++;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+        syy += y * y;
+    }
+
+    // Steigung; r2 = Anteil der Streuung, den die Gerade erklärt
+    float steigung(float &r2) const
+    {
+        double vx = sxx - sx * sx / n, vy = syy - sy * sy / n, kov = sxy - sx * sy / n;
+        r2 = vx > 0 && vy > 0 ? (float)(kov * kov / (vx * vy)) : 0;
+        return vx > 0 ? (float)(kov / vx) : 0;
+    }
+}; // Ende der Struktur MYDBG_Gerade
+
+inline MYDBG_LeckBefund MYDBG_leckAnalyse(const MYDBG_GesundheitKopie &k)
+{
+    MYDBG_LeckBefund b;
+    for (uint8_t i = 0; i < k.taskAnzahl; i++)
+        b.stackKnapp |= k.tasks[i].frei < MYDBG_STACK_WARNUNG;
+
+    uint16_t erster = k.anzahl > MYDBG_GESUNDHEIT_PUNKTE / 2 ? k.anzahl - MYDBG_GESUNDHEIT_PUNKTE / 2 : 0;
+    while (erster < k.anzahl && k.punkte[erster].zeitS < MYDBG_GESUNDHEIT_ANLAUF_S)
+        erster++;
+    b.punkte = k.anzahl - erster;
+    if (b.punkte < 3)
+        return b;
+    MYDBG_Gerade heap, block;
+    for (uint16_t i = erster; i < k.anzahl; i++)
+    {
+        const MYDBG_GesundheitPunkt &p = k.punkte[i];
+        double stunden = (p.zeitS - k.punkte[erster].zeitS) / 3600.0;
+        heap.dazu(stunden, p.w.heapFrei);
+        block.dazu(stunden, p.w.heapBlock);
+    }
+    b.fensterS = k.punkte[k.anzahl - 1].zeitS - k.punkte[erster].zeitS;
+    b.heapProH = heap.steigung(b.heapR2);
+    b.blockProH = block.steigung(b.blockR2);
+
+    // "Stetig": genug Punkte über genug Zeit, und die Gerade erklärt den Verlauf besser als das Rauschen
+    if (b.punkte < 8 || b.fensterS < MYDBG_LECK_MIN_MINUTEN * 60u)
+        return b;
+    b.leck = b.heapProH <= -MYDBG_LECK_BYTES_PRO_H && b.heapR2 >= 0.5f;
+    b.zerfall = !b.leck && b.blockProH <= -MYDBG_LECK_BYTES_PRO_H && b.blockR2 >= 0.5f;
+    if (b.leck)
+        b.stundenBisLeer = k.punkte[k.anzahl - 1].w.heapFrei / -b.heapProH;
+    return b;
+} // Ende der Funktion MYDBG_leckAnalyse
+
+// Aus MYDBG_systemAktualisieren: meldet ein neu erkanntes Leck, einen Zerfall oder knappen Stack einmal auf der Konsole
+// Läuft vor der Pause von MYDBG(n, ...), daher ohne Heap: Die Kopie ist statisch und gehört dem, der MYDBG_Sperre hält.
+inline void MYDBG_gesundheitPruefen()
+{
+#ifndef MYDBG_OHNE_GESUNDHEIT
+    static bool gemeldetLeck = false, gemeldetZerfall = false, gemeldetStack = false;
+    static MYDBG_GesundheitKopie k;
+    portENTER_CRITICAL(&MYDBG_gesundheitMux); // der Abtaster zählt im esp_timer-Task weiter
+    bool neu = MYDBG_gesundheit.neuePunkte > 0;
+    MYDBG_gesundheit.neuePunkte = 0;
+    portEXIT_CRITICAL(&MYDBG_gesundheitMux);
+    if (!neu)
+        return;
+    MYDBG_Sperre sperre; // meist hält sie der Aufrufer schon
+    k.laden();
+    MYDBG_LeckBefund b = MYDBG_leckAnalyse(k);
+    if (b.leck && !gemeldetLeck)
+        Serial.printf("[MYDBG] ⚠️ Heap-Leck? Freier Heap sinkt um %.0f Byte/h (seit %u min, R² %.2f), leer in etwa %.1f h\n",
+                      -b.heapProH, (unsigned)(b.fensterS / 60), b.heapR2, b.stundenBisLeer);
+    if (b.zerfall && !gemeldetZerfall)
+        Serial.printf("[MYDBG] ⚠️ Heap zerfällt? Größter freier Block sinkt um %.0f Byte/h bei stabilem freien Heap\n", -b.blockProH);
+    if (b.stackKnapp && !gemeldetStack)
+        Serial.printf("[MYDBG] ⚠️ Stack knapp: ein Task hatte weniger als %u Byte Reserve (Menü 0, /mydbg_health.json)\n",
+                      (unsigned)MYDBG_STACK_WARNUNG);
+    gemeldetLeck = b.leck;
+    gemeldetZerfall = b.zerfall;
+    gemeldetStack = b.stackKnapp;
+#endif
+} // Ende der Funktion MYDBG_gesundheitPruefen
+
+// GET /mydbg_health.json: aktueller Stand, Stack je Task, Trend ältester Punkt zuerst und Leck-Befund
+//   {"interval_ms":1000,"samples_per_point":4,"current":{…},"tasks":[{"name","stack_free"}],
+//    "trend":[[t_s,heap_free,heap_block,heap_min,stack_free],…],"leak":{…}}
+// Trendwerte sind Minima über den Abschnitt des Punkts; stack_free null = noch kein Task gemessen
+struct MYDBG_GesundheitQuelle : MYDBG_ChunkQuelle
+{
+    MYDBG_GesundheitKopie k;
+    uint16_t i = 0;
+    uint8_t teil = 0; // 0 = Kopf, 1 = Trend, 2 = Befund, 3 = fertig
+
+    MYDBG_GesundheitQuelle() { k.laden(); }
+
+    static void stack(MYDBG_Puffer &z, uint32_t frei)
+    {
+        if (frei == UINT32_MAX)
+            z << "null";
+        else
+            z << frei;
     }
 
-    while (wdArr.size() > MYDBG_MAX_WATCHDOGS)
-        wdArr.remove(wdArr.size() - 1);
-
-    File out = LittleFS.open("/mydbg_watchdog.json", "w");
-    if (out)
+    bool naechsteZeile() override
     {
-        serializeJson(wdDoc, out);
-        out.close();
+        if (teil == 3)
+            return false;
+        MYDBG_Puffer z(zeile, sizeof(zeile));
+        if (teil == 0)
+        {
+            const MYDBG_GesundheitWert &w = k.aktuell;
+            z.printf("{\"interval_ms\":%u,\"samples_per_point\":%u,\"uptime_s\":%u,\"current\":", (unsigned)MYDBG_GESUNDHEIT_INTERVALL_MS,
+                     (unsigned)k.jePunkt, (unsigned)(esp_timer_get_time() / 1000000));
+            if (k.gueltig)
+            {
+                z.printf("{\"heap_free\":%u,\"heap_block\":%u,\"heap_min\":%u,\"stack_free\":", (unsigned)w.heapFrei,
+                         (unsigned)w.heapBlock, (unsigned)w.heapMin);
+                stack(z, w.stackFrei);
+                z << "}";
+            }
+            else
+                z << "null";
+            z << ",\"tasks\":[";
+            for (uint8_t t = 0; t < k.taskAnzahl; t++)
+            {
+                z << (t ? ",{\"name\":\"" : "{\"name\":\"");
+                z.json(k.tasks[t].name) << "\",\"stack_free\":" << k.tasks[t].frei << "}";
+            }
+            z << "],\"trend\":[";
+            teil = 1;
+        }
+        while (teil == 1 && z.frei() > 80)
+        {
+            if (i == k.anzahl)
+            {
+                z << "]";
+                teil = 2;
+                break;
+            }
+            const MYDBG_GesundheitPunkt &p = k.punkte[i];
+            z.printf("%s[%u,%u,%u,%u,", i ? "," : "", (unsigned)p.zeitS, (unsigned)p.w.heapFrei, (unsigned)p.w.heapBlock,
+                     (unsigned)p.w.heapMin);
+            stack(z, p.w.stackFrei);
+            z << "]";
+            i++;
+        }
+        if (teil == 2 && z.frei() > 300)
+        {
+            MYDBG_LeckBefund b = MYDBG_leckAnalyse(k);
+            z.printf(",\"leak\":{\"window_s\":%u,\"points\":%u,\"heap_slope_per_h\":%.1f,\"heap_r2\":%.3f,\"block_slope_per_h\":%.1f,"
+                     "\"block_r2\":%.3f,\"leaking\":%s,\"fragmenting\":%s,\"stack_low\":%s,\"hours_left\":",
+                     (unsigned)b.fensterS, (unsigned)b.punkte, b.heapProH, b.heapR2, b.blockProH, b.blockR2,
+                     b.leck ? "true" : "false", b.zerfall ? "true" : "false", b.stackKnapp ? "true" : "false");
+            if (b.leck)
+                z.printf("%.1f}}", b.stundenBisLeer);
+            else
+                z << "null}}";
+            teil = 3;
+        }
+        laenge = z.laenge;
+        return true;
     }
-} // Ende der Funktion MYDBG_writeWatchdogRestartFromLastLog
+}; // Ende der Struktur MYDBG_GesundheitQuelle
 
-// Einfache Textzeile an WebClient senden
-inline void MYDBG_streamWebLineJSON(const String &msg, const String &varName, const String &varValue, const String &func, int zeile)
+// Konsolenausgabe für Menüpunkt 0: Stand, Tasks, Befund und der Trend als grobe Tabelle (höchstens 16 Zeilen)
+inline void MYDBG_gesundheitAnzeigen()
 {
-    StaticJsonDocument<256> doc;
-    JsonObject root = doc.to<JsonObject>(); // <== wichtig!
-
-    root["timestamp"] = MYDBG_getTimestamp();
-    root["pgmFunc"] = func;
-    root["pgmZeile"] = zeile;
-    root["msg"] = msg;
-    root["varName"] = varName;
-    root["varValue"] = varValue;
-    root["millis"] = millis();
-
-    MYDBG_fillResetInfo(root, true); // Farbe nur fürs Web nötig
-
-    if (MYDBG_filesystemReady)
+    std::unique_ptr<MYDBG_GesundheitKopie> k(new (std::nothrow) MYDBG_GesundheitKopie);
+    if (!k)
+        return;
+    k->laden();
+    Serial.println("\n=== Heap und Stack ===");
+    if (!k->gueltig)
     {
-        size_t total = LittleFS.totalBytes();
-        size_t used = LittleFS.usedBytes();
-        float freiProzent = 100.0 - (used * 100.0) / total;
-        root["fs_free_kb"] = (total - used) / 1024;
-        root["fs_free_percent"] = freiProzent;
+        Serial.println("[MYDBG] Noch keine Abtastung.");
+        return;
     }
+    const MYDBG_GesundheitWert &w = k->aktuell;
+    Serial.printf("Heap: %u Byte frei, größter Block %u Byte (%u%%), Minimum seit Start %u Byte\n", (unsigned)w.heapFrei,
+                  (unsigned)w.heapBlock, (unsigned)(w.heapFrei ? w.heapBlock * 100ULL / w.heapFrei : 0), (unsigned)w.heapMin);
+    for (uint8_t t = 0; t < k->taskAnzahl; t++)
+        Serial.printf("Stack %-16s %6u Byte Reserve%s\n", k->tasks[t].name, (unsigned)k->tasks[t].frei,
+                      k->tasks[t].frei < MYDBG_STACK_WARNUNG ? "  ⚠️" : "");
+
+    MYDBG_LeckBefund b = MYDBG_leckAnalyse(*k);
+    if (b.punkte >= 3)
+        Serial.printf("Trend über %u min (%u Punkte): Heap %+.0f Byte/h (R² %.2f), größter Block %+.0f Byte/h (R² %.2f)\n",
+                      (unsigned)(b.fensterS / 60), (unsigned)b.punkte, b.heapProH, b.heapR2, b.blockProH, b.blockR2);
     else
+        Serial.printf("Trend: noch zu kurz (Anlauf %u s wird nicht gewertet)\n", (unsigned)MYDBG_GESUNDHEIT_ANLAUF_S);
+    if (b.leck)
+        Serial.printf("⚠️  Heap-Leck: bei gleichem Tempo in etwa %.1f h kein Heap mehr frei\n", b.stundenBisLeer);
+    if (b.zerfall)
+        Serial.println("⚠️  Heap zerfällt: größter Block schrumpft, freier Heap bleibt");
+
+    Serial.printf("\n%8s %10s %10s %10s %8s   (Minima je Abschnitt, %u s je Punkt)\n", "Zeit s", "frei", "Block", "Minimum", "Stack",
+                  (unsigned)(k->jePunkt * MYDBG_GESUNDHEIT_INTERVALL_MS / 1000));
+    uint16_t schritt = max<uint16_t>(1, (k->anzahl + 15) / 16);
+    for (uint16_t i = 0; i < k->anzahl; i += schritt)
     {
-        root["fs_free_kb"] = -1;
-        root["fs_free_percent"] = -1;
+        const MYDBG_GesundheitPunkt &p = k->punkte[i];
+        Serial.printf("%8u %10u %10u %10u %8d\n", (unsigned)p.zeitS, (unsigned)p.w.heapFrei, (unsigned)p.w.heapBlock,
+                      (unsigned)p.w.heapMin, p.w.stackFrei == UINT32_MAX ? -1 : (int)p.w.stackFrei);
     }
-
-    String jsonStr;
-    serializeJson(doc, jsonStr);
-    MYDBG_ws.textAll(jsonStr);
-} // Ende der Funktion MYDBG_streamWebLineJSON
+} // Ende der Funktion MYDBG_gesundheitAnzeigen
 
 // diese Funktion prüft JsonFiles
 inline void MYDBG_prepareJsonFiles()
@@ -356,7 +5018,6 @@ inline void MYDBG_prepareJsonFiles()
     };
 
     const JsonInitFile dateien[] = {
-        {"/mydbg_data.json", "{\"log\":[]}"},
         {"/mydbg_watchdog.json", "{\"watchdogs\":[]}"},
         {"/mydbg_status.json", "{}"}};
 
@@ -369,7 +5030,7 @@ inline void MYDBG_prepareJsonFiles()
             File testfile = LittleFS.open(eintrag.pfad, "r");
             if (testfile)
             {
-                StaticJsonDocument<256> testdoc;
+                JsonDocument testdoc;
                 DeserializationError error = deserializeJson(testdoc, testfile);
                 testfile.close();
                 if (error)
@@ -409,6 +5070,21 @@ inline void MYDBG_prepareJsonFiles()
             }
         }
     }
+
+    // Logeinträge liegen im Ringpuffer, eine alte /mydbg_data.json wird nicht mehr gebraucht
+    if (LittleFS.exists("/mydbg_data.json"))
+    {
+        LittleFS.remove("/mydbg_data.json");
+        Serial.println("[MYDBG] Alte /mydbg_data.json entfernt – Logs liegen jetzt im Ringpuffer.");
+    }
+    MYDBG_ringInit();
+    MYDBG_siteIndexLaden();
+    MYDBG_zeitLaden();
+    MYDBG_systemAktualisieren(true);
+
+    static bool herunterfahrenRegistriert = false;
+    if (!herunterfahrenRegistriert)
+        herunterfahrenRegistriert = esp_register_shutdown_handler(MYDBG_herunterfahren) == ESP_OK;
 } // Ende der Funktion MYDBG_prepareJsonFiles
 
 // LittleFS initialisieren
@@ -428,18 +5104,55 @@ inline void MYDBG_setWatchdog(int sekunden)
     esp_task_wdt_add(NULL);
 } // Ende der Funktion MYDBG_setWatchdog
 
+#ifdef MYDBG_SERIAL_BINAER
+// Binärer Rahmen auf Serial statt Textzeile (Auswertung mit tools/mydbg_decode.py)
+// Eintrag: A5 5A Länge Eintrag | Aufrufstelle (einmal je Lauf): A5 5B LängeLo LängeHi Stelle
+// Zeitanker (nach jeder Synchronisation): A5 5C Länge Anker
+inline void MYDBG_serialBinaer(const MYDBG_LogRecord &rec)
+{
+    MYDBG_Site *site = MYDBG_siteSuchen(rec.site);
+    if (site && !(site->status & MYDBG_SITE_GESENDET))
+    {
+        uint8_t buf[4 + MYDBG_SITE_KOPF + 3 * MYDBG_SITE_TEXT_MAX];
+        size_t laenge = MYDBG_siteKodieren(*site, buf + 4);
+        buf[0] = 0xA5;
+        buf[1] = 0x5B;
+        buf[2] = laenge & 0xFF;
+        buf[3] = laenge >> 8;
+        Serial.write(buf, laenge + 4);
+        site->status |= MYDBG_SITE_GESENDET;
+    }
+    MYDBG_serialAnker();
+    uint8_t rahmen[3] = {0xA5, 0x5A, (uint8_t)sizeof(rec)};
+    Serial.write(rahmen, sizeof(rahmen));
+    Serial.write((const uint8_t *)&rec, sizeof(rec));
+} // Ende der Funktion MYDBG_serialBinaer
+#endif
+
 // STOP-Ausgabe über Serial und Web
-inline void MYDBG_stopAusgabe(const String &msg, const String &varName, const String &varValue, const String &func, int zeile)
+inline void MYDBG_stopAusgabe(const MYDBG_LogRecord &rec)
 {
     if (!MYDBG_isEnabled)
         return;
-    String ausgabe = "[MYDBG] > " + String(zeile) + " | " + func + "() | " + MYDBG_getTimestamp() + " | " + millis() + " | " + msg + " | " + varName + " = " + varValue;
-    Serial.println(ausgabe);
-    MYDBG_streamWebLine(ausgabe);
+    char zeit[30];
+    MYDBG_formatZeit(MYDBG_unixZeit(rec), zeit, sizeof(zeit));
+    MYDBG_Klartext k;
+    MYDBG_klartext(rec, k);
+    MYDBG_Zeile<> ausgabe;
+    ausgabe << "[MYDBG] > " << k.zeile << " | " << k.func << "() | " << zeit << " | " << rec.mikros / 1000 << " | "
+            << k.msg << " | " << k.varName << " = " << k.varValue;
+    if (rec.unterdrueckt)
+        ausgabe << " (+" << rec.unterdrueckt << " gedrosselt)";
+#ifdef MYDBG_SERIAL_BINAER
+    MYDBG_serialBinaer(rec);
+#else
+    Serial.println(ausgabe.text);
+#endif
+    // Die Webseite bekommt denselben Eintrag als JSON über MYDBG_streamWebLineJSON (gebündelt)
 } // Ende der Funktion MYDBG_stopAusgabe
 
 // gibt webseite aus
-inline void MYDBG_streamWebLine(const String &msg)
+inline void MYDBG_streamWebLine(const char *msg)
 {
     if (MYDBG_webClientActive)
     {
@@ -447,96 +5160,593 @@ inline void MYDBG_streamWebLine(const String &msg)
     }
 } // Ende der Funktion MYDBG_streamWebLine
 
-// Log-Eintrag in JSON-Datei schreiben
-// Neue Version von MYDBG_logToJson() mit sauberem LIFO und echten Objektkopien
-inline void MYDBG_logToJson(const String &text, const String &func, int line, const String &varName, const String &varValue)
+// Log-Eintrag in den Ringpuffer schreiben (Name stammt aus der Zeit der JSON-Logdatei)
+// Kostet einen Append fester Größe statt Lesen, Kopieren und Neuschreiben des ganzen Logs
+inline void MYDBG_logToJson(MYDBG_LogRecord &rec)
+{
+    MYDBG_ringAppend(rec); // vergibt die Sequenznummer
+    MYDBG_system.fsGeaendert = true;
+} // Ende der Funktion MYDBG_logToJson
+
+// === Letzter Status ===
+// Der jüngste Eintrag liegt im RAM und wird von /mydbg_status.json direkt ausgeliefert.
+// In die Datei kommt er nur alle MYDBG_STATUS_INTERVALL_MS und beim Herunterfahren (esp_restart, MYDBG_herunterfahren)
+// statt bei jedem MYDBG(1…9, ...) – das spart je Aufruf ein Kürzen und Neuschreiben der Datei im Flash.
+struct MYDBG_StatusZustand
 {
-    bool isWatchdogReset = (esp_reset_reason() == ESP_RST_WDT || esp_reset_reason() == ESP_RST_TASK_WDT);
+    MYDBG_LogRecord rec;
+    bool gueltig = false;   // in diesem Start schon ein Eintrag
+    bool geaendert = false; // neuer als die Datei
+    uint32_t gespeichertMs = 0;
+    uint32_t aktualisierungen = 0; // Einträge seit dem Start
+    uint32_t schreibvorgaenge = 0; // davon in die Datei geschrieben
+}; // Ende der Struktur MYDBG_StatusZustand
 
-    StaticJsonDocument<2048> doc;
+inline MYDBG_StatusZustand MYDBG_status;
 
-    if (LittleFS.exists("/mydbg_data.json"))
+inline constexpr char MYDBG_JSON_STATUS[] = ",\"aktualisierungen\":%u,\"schreibvorgaenge\":%u,\"gespeichert\":%s}";
+constexpr size_t MYDBG_STATUS_JSON_MAX = MYDBG_JSON_EINTRAG_MAX + sizeof(MYDBG_JSON_STATUS) + 2 * 10 + 5;
+
+// Status als JSON: Felder wie in /mydbg_data.json plus Zähler, 0 wenn es nicht in den Puffer passt
+inline size_t MYDBG_statusJson(char *buf, size_t groesse)
+{
+    if (!MYDBG_status.gueltig || groesse < 2)
+        return 0;
+    size_t n = MYDBG_recordToJson(MYDBG_status.rec, buf, groesse);
+    if (n == 0 || buf[n - 1] != '}')
+        return 0;
+    int m = snprintf(buf + n - 1, groesse - n + 1, MYDBG_JSON_STATUS, // schließende Klammer überschreiben
+                     (unsigned)MYDBG_status.aktualisierungen, (unsigned)MYDBG_status.schreibvorgaenge, MYDBG_status.geaendert ? "false" : "true");
+    if (m < 0 || (size_t)m >= groesse - n + 1)
+    {
+        buf[0] = '\0';
+        return 0;
+    }
+    return n - 1 + m;
+} // Ende der Funktion MYDBG_statusJson
+
+// Neuesten Status merken (nur RAM)
+inline void MYDBG_writeStatusFile(const MYDBG_LogRecord &rec)
+{
+    MYDBG_status.rec = rec;
+    MYDBG_status.gueltig = true;
+    MYDBG_status.geaendert = true;
+    MYDBG_status.aktualisierungen++;
+} // Ende der Funktion MYDBG_writeStatusFile
+
+// Schreibt den Status in /mydbg_status.json, wenn er neuer ist als die Datei
+inline void MYDBG_statusSpeichern()
+{
+    if (!MYDBG_status.geaendert || !MYDBG_filesystemReady)
+        return;
+    MYDBG_status.geaendert = false; // vor dem Formatieren, damit "gespeichert" in der Datei stimmt
+    MYDBG_Zeile<MYDBG_STATUS_JSON_MAX> json;
+    json.laenge = MYDBG_statusJson(json.text, sizeof(json.speicher));
+    File file = LittleFS.open("/mydbg_status.json", "w");
+    if (file)
+    {
+        file.write((const uint8_t *)json.text, json.laenge);
+        file.close();
+        MYDBG_status.schreibvorgaenge++;
+        MYDBG_system.fsGeaendert = true;
+    }
+    else
+    {
+        MYDBG_status.geaendert = true;
+    }
+    MYDBG_status.gespeichertMs = millis();
+} // Ende der Funktion MYDBG_statusSpeichern
+
+// Regelmäßiges Sichern (aus MYDBG_systemAktualisieren)
+inline void MYDBG_statusPflegen()
+{
+    if (MYDBG_STATUS_INTERVALL_MS > 0 && MYDBG_status.geaendert &&
+        millis() - MYDBG_status.gespeichertMs >= MYDBG_STATUS_INTERVALL_MS)
+        MYDBG_statusSpeichern();
+} // Ende der Funktion MYDBG_statusPflegen
+
+// Vor einem geplanten Neustart oder Tiefschlaf aufrufen; bei esp_restart() geschieht das automatisch
+inline void MYDBG_herunterfahren()
+{
+    MYDBG_statusSpeichern();
+} // Ende der Funktion MYDBG_herunterfahren
+
+// Drosselung je Aufrufstelle, bevor Konsole, WebSocket, Flash oder Eintragspuffer etwas kosten:
+// - Token-Bucket mit MYDBG_rateProS und MYDBG_rateBurst, als GCRA mit nur einem Zeitpunkt je Stelle
+// - gleicher Wert wie im letzten Eintrag der Stelle → höchstens alle MYDBG_wiederholungMs ausgeben
+// Gedrosselte Aufrufe werden gezählt und im nächsten Eintrag der Stelle als rec.unterdrueckt mitgeliefert.
+// Einträge mit Pause (MYDBG_FLAG_STOP) werden nie gedrosselt – außer aus einer ISR, dort gibt es keine Pause.
+// Ohne MYDBG_ASYNC läuft das unter MYDBG_Sperre; mit MYDBG_ASYNC im Aufrufer ohne Sperre: Rufen mehrere Tasks
+// dieselbe Stelle gleichzeitig auf, kann eine Entscheidung oder ein Zähler ungenau werden.
+inline bool MYDBG_drosseln(MYDBG_Site &site, MYDBG_LogRecord &rec)
+{
+    MYDBG_SiteDrossel &d = site.drossel;
+    const int64_t jetzt = (int64_t)rec.mikros;
+    const bool pausiert = (rec.flags & MYDBG_FLAG_STOP) && !(rec.flags & MYDBG_FLAG_ISR);
+    d.aufrufe++;
+    if (!pausiert && d.hatWert)
     {
-        File file = LittleFS.open("/mydbg_data.json", "r");
-        if (file)
+        bool wiederholt = MYDBG_wiederholungMs && rec.typ == d.letzterTyp &&
+                          memcmp(&rec.wert, &d.letzterWert, sizeof(rec.wert)) == 0 &&
+                          jetzt - d.letzteAusgabe < (int64_t)MYDBG_wiederholungMs * 1000;
+        bool zuSchnell = false;
+        if (!wiederholt && MYDBG_rateProS)
+        {
+            const int64_t abstand = 1000000 / MYDBG_rateProS;
+            int64_t frei = max(d.frei, jetzt);
+            zuSchnell = frei - jetzt > (int64_t)(MYDBG_rateBurst > 0 ? MYDBG_rateBurst - 1 : 0) * abstand;
+            if (!zuSchnell)
+                d.frei = frei + abstand;
+        }
+        if (wiederholt || zuSchnell)
         {
-            DeserializationError error = deserializeJson(doc, file);
-            file.close();
-            if (error)
-                doc.clear();
+            d.offen++;
+            d.unterdrueckt++;
+            return false;
         }
     }
+    else if (MYDBG_rateProS)
+    {
+        d.frei = max(d.frei, jetzt) + 1000000 / MYDBG_rateProS;
+    }
+    rec.unterdrueckt = d.offen > 0xFFFF ? 0xFFFF : d.offen;
+    d.offen = 0;
+    d.letzterWert = rec.wert;
+    d.letzterTyp = rec.typ;
+    d.hatWert = true;
+    d.letzteAusgabe = jetzt;
+    return true;
+} // Ende der Funktion MYDBG_drosseln
 
-    JsonArray oldArr = doc["log"].is<JsonArray>() ? doc["log"].as<JsonArray>() : doc.createNestedArray("log");
+// === Eintragspuffer: je CPU-Kern ein Ring ohne Sperre ===
+// Mehrere Erzeuger (Tasks beider Kerne und ISRs) reservieren einen Platz mit compare_exchange und kopieren
+// nur den fertigen Eintrag hinein; niemand wartet auf eine Sperre, auch nicht in einer ISR.
+// Jeder Platz trägt eine Folgenummer (Verfahren nach D. Vyukov): == Position → frei, == Position + 1 → gefüllt.
+// Ein Leser übernimmt einen Eintrag erst, wenn dessen Erzeuger fertig kopiert hat, halbe Einträge gibt es nicht.
+// Genutzt von MYDBG_ASYNC (alle Einträge) und MYDBG_ISR (auch ohne MYDBG_ASYNC).
+static_assert((MYDBG_QUEUE_LAENGE & (MYDBG_QUEUE_LAENGE - 1)) == 0, "MYDBG_QUEUE_LAENGE muss eine Zweierpotenz sein");
 
-    // Neues Dokument vorbereiten
-    StaticJsonDocument<2048> newDoc;
-    JsonArray newArr = newDoc.createNestedArray("log");
+struct MYDBG_EintragsPlatz
+{
+    MYDBG_LogRecord rec;
+    std::atomic<uint32_t> folge;
+    std::atomic<uint32_t> zeit; // untere 32 Bit von rec.mikros: MYDBG_pufferNehmen vergleicht, ohne rec anzufassen
+    MYDBG_Site *site; // nur bei MYDBG_FLAG_ISR, die ID vergibt erst der Task
+}; // Ende der Struktur MYDBG_EintragsPlatz
 
-    JsonObject newEntry = newArr.createNestedObject();
-    newEntry["timestamp"] = MYDBG_getTimestamp();
-    newEntry["millis"] = millis();
-    newEntry["pgmFunc"] = func;
-    newEntry["pgmZeile"] = line;
-    newEntry["msg"] = text;
-    newEntry["varName"] = varName;
-    newEntry["varValue"] = varValue;
-    MYDBG_fillResetInfo(newEntry, false); // ohne Farbe für JSON-Datei
+struct MYDBG_Eintragsring
+{
+    MYDBG_EintragsPlatz plaetze[MYDBG_QUEUE_LAENGE];
+    std::atomic<uint32_t> kopf{0}; // nächste zu reservierende Position
+    std::atomic<uint32_t> ende{0}; // nächste zu lesende Position
 
-    for (JsonObject o : oldArr)
+    MYDBG_Eintragsring()
     {
-        if (newArr.size() >= MYDBG_MAX_LOGFILES)
-            break;
-        JsonObject copy = newArr.createNestedObject();
-        for (JsonPair kv : o)
+        for (uint32_t i = 0; i < MYDBG_QUEUE_LAENGE; i++)
+            plaetze[i].folge.store(i, std::memory_order_relaxed);
+    }
+}; // Ende der Struktur MYDBG_Eintragsring
+inline MYDBG_Eintragsring MYDBG_puffer[portNUM_PROCESSORS]; // getrennt je Kern: Erzeuger beider Kerne kommen sich nicht in die Quere
+inline TaskHandle_t volatile MYDBG_verbraucher = nullptr; // Ausgabe-Task (nur mit MYDBG_ASYNC)
+
+// Reserviert einen Platz im Ring des eigenen Kerns und kopiert den Eintrag hinein; false, wenn der Ring voll ist
+inline bool IRAM_ATTR MYDBG_pufferSchreiben(const MYDBG_LogRecord &rec, MYDBG_Site *site)
+{
+    MYDBG_Eintragsring &p = MYDBG_puffer[xPortGetCoreID()];
+    uint32_t pos = p.kopf.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        MYDBG_EintragsPlatz &platz = p.plaetze[pos % MYDBG_QUEUE_LAENGE];
+        int32_t abstand = (int32_t)(platz.folge.load(std::memory_order_acquire) - pos);
+        if (abstand == 0)
+        {
+            // Scheitert nur, wenn ein anderer Erzeuger zuvorgekommen ist; pos enthält dann dessen neuen Stand
+            if (p.kopf.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                platz.rec = rec;
+                platz.site = site;
+                platz.zeit.store((uint32_t)rec.mikros, std::memory_order_relaxed);
+                platz.folge.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (abstand < 0)
+        {
+            return false; // Platz aus der vorigen Runde noch nicht gelesen
+        }
+        else
         {
-            copy[kv.key()] = kv.value();
+            pos = p.kopf.load(std::memory_order_relaxed);
         }
     }
+} // Ende der Funktion MYDBG_pufferSchreiben
 
-    File out = LittleFS.open("/mydbg_data.json", "w");
-    if (out)
+// Nimmt den ältesten fertigen Eintrag aus einem Ring (Ausgabe-Task oder Erzeuger, der bei Überlauf den ältesten verwirft)
+inline bool MYDBG_ringNehmen(MYDBG_Eintragsring &p, MYDBG_LogRecord &rec, MYDBG_Site *&site)
+{
+    uint32_t pos = p.ende.load(std::memory_order_relaxed);
+    for (;;)
     {
-        serializeJson(newDoc, out);
-        out.close();
+        MYDBG_EintragsPlatz &platz = p.plaetze[pos % MYDBG_QUEUE_LAENGE];
+        int32_t abstand = (int32_t)(platz.folge.load(std::memory_order_acquire) - (pos + 1));
+        if (abstand == 0)
+        {
+            if (p.ende.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                rec = platz.rec;
+                site = platz.site;
+                platz.folge.store(pos + MYDBG_QUEUE_LAENGE, std::memory_order_release); // frei für die nächste Runde
+                return true;
+            }
+        }
+        else if (abstand < 0)
+        {
+            return false; // leer, oder der Erzeuger kopiert noch
+        }
+        else
+        {
+            pos = p.ende.load(std::memory_order_relaxed);
+        }
     }
-} // Ende der Funktion MYDBG_logToJson
+} // Ende der Funktion MYDBG_ringNehmen
 
-// Status-Log schreiben
-inline void MYDBG_writeStatusFile(const String &msg, const String &func, int line, const String &varName, const String &varValue)
+// Nimmt aus allen Ringen den Eintrag mit dem ältesten Zeitstempel, damit die Kerne im Log nicht blockweise erscheinen.
+// Verglichen wird nur platz.zeit: Zwischen Prüfen und Nehmen kann ein Erzeuger mit MYDBG_VERWIRF_AELTESTE den Platz
+// leeren und neu füllen; dann stimmt höchstens die Reihenfolge nicht, gelesen wird rec erst in MYDBG_ringNehmen.
+inline bool MYDBG_pufferNehmen(MYDBG_LogRecord &rec, MYDBG_Site *&site)
 {
-    if (!MYDBG_filesystemReady)
-        MYDBG_initFilesystem();
-    StaticJsonDocument<512> doc;
-    doc["timestamp"] = MYDBG_getTimestamp();
-    doc["millis"] = millis();
-    doc["pgmFunc"] = func;
-    doc["pgmZeile"] = line;
-    doc["msg"] = msg;
-    doc["varName"] = varName;
-    doc["varValue"] = varValue;
+    for (;;)
+    {
+        int beste = -1;
+        uint32_t zeit = 0;
+        for (int k = 0; k < portNUM_PROCESSORS; k++)
+        {
+            MYDBG_Eintragsring &p = MYDBG_puffer[k];
+            uint32_t pos = p.ende.load(std::memory_order_relaxed);
+            MYDBG_EintragsPlatz &platz = p.plaetze[pos % MYDBG_QUEUE_LAENGE];
+            if (platz.folge.load(std::memory_order_acquire) != pos + 1)
+                continue;
+            uint32_t z = platz.zeit.load(std::memory_order_relaxed);
+            if (beste < 0 || (int32_t)(z - zeit) < 0) // über den Überlauf nach 71 Minuten hinweg
+            {
+                zeit = z;
+                beste = k;
+            }
+        }
+        if (beste < 0)
+            return false;
+        if (MYDBG_ringNehmen(MYDBG_puffer[beste], rec, site))
+            return true;
+    }
+} // Ende der Funktion MYDBG_pufferNehmen
 
-    File file = LittleFS.open("/mydbg_status.json", "w");
-    if (file)
+// Belegte Plätze über alle Kerne (für das Menü)
+inline uint32_t MYDBG_pufferBelegt()
+{
+    uint32_t belegt = 0;
+    for (int k = 0; k < portNUM_PROCESSORS; k++)
+        belegt += MYDBG_puffer[k].kopf.load(std::memory_order_relaxed) - MYDBG_puffer[k].ende.load(std::memory_order_relaxed);
+    return belegt;
+} // Ende der Funktion MYDBG_pufferBelegt
+
+// Weckt den Ausgabe-Task, aus einem Task wie aus einer ISR; ohne MYDBG_ASYNC leert der nächste MYDBG-Aufruf den Puffer
+inline void IRAM_ATTR MYDBG_verbraucherWecken()
+{
+#ifdef MYDBG_ASYNC
+    TaskHandle_t task = MYDBG_verbraucher;
+    if (!task)
+        return;
+    if (xPortInIsrContext())
     {
-        serializeJson(doc, file);
-        file.close();
+        BaseType_t hoeherePrio = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &hoeherePrio);
+        if (hoeherePrio)
+            portYIELD_FROM_ISR();
     }
-} // Ende der Funktion MYDBG_writeStatusFile
+    else
+    {
+        xTaskNotifyGive(task);
+    }
+#endif
+} // Ende der Funktion MYDBG_verbraucherWecken
+
+// Eintrag aus dem Puffer ausgeben; für Einträge aus einer ISR zuerst nachholen, was dort nicht erlaubt war
+inline void MYDBG_pufferVerarbeiten(MYDBG_LogRecord &rec, MYDBG_Site *site)
+{
+    if ((rec.flags & MYDBG_FLAG_ISR) && site)
+    {
+        if (site->id == 0)
+            MYDBG_siteRegistrieren(*site, rec.typ);
+        rec.site = site->id;
+        rec.boot = MYDBG_zeit.boot;
+        rec.resetReason = (uint8_t)MYDBG_resetGrund();
+        if (!(site->status & MYDBG_SITE_GESPEICHERT))
+            rec.flags |= MYDBG_FLAG_SITE;
+#ifndef MYDBG_OHNE_FLUGSCHREIBER
+        MYDBG_flug.schreiben(rec);
+        if ((rec.flags & ~MYDBG_FLAG_ISR) == 0)
+            return;
+#endif
+        if (!MYDBG_drosseln(*site, rec))
+            return;
+    }
+    MYDBG_ausgeben(rec);
+} // Ende der Funktion MYDBG_pufferVerarbeiten
+
+// Gibt alle Einträge im Puffer aus. Mit MYDBG_ASYNC erledigt das der Ausgabe-Task; ohne ihn der nächste
+// MYDBG-Aufruf oder die Pause danach – wer nur aus ISRs loggt, ruft MYDBG_pufferLeeren() in loop() auf.
+inline void MYDBG_pufferLeeren()
+{
+    MYDBG_LogRecord rec;
+    MYDBG_Site *site;
+    if (!MYDBG_pufferBelegt())
+        return;
+    MYDBG_Sperre sperre;
+    while (MYDBG_pufferNehmen(rec, site))
+    {
+        MYDBG_pufferVerarbeiten(rec, site);
+    }
+} // Ende der Funktion MYDBG_pufferLeeren
+
+// Übernimmt einen MYDBG_ISR-Aufruf: nur Zeitstempel und Rohwert, keine Sperre, kein Heap, kein Dateisystem.
+// Registrierung der Stelle, Flugschreiber, Drosselung und Ausgabe folgen im Task (MYDBG_pufferVerarbeiten).
+inline void IRAM_ATTR MYDBG_isrErfassen(MYDBG_Site &site, const MYDBG_Wert &wert)
+{
+    uint8_t flags = 0;
+    if (MYDBG_isEnabled && !MYDBG_stopEnabled)
+        flags |= MYDBG_FLAG_KONSOLE;
+    if (MYDBG_stopEnabled)
+        flags |= MYDBG_FLAG_STOP; // volle Ausgabe wie MYDBG(1, ...), aber ohne Pause
+    if (!flags && !MYDBG_FLUG_AKTIV)
+        return;
+    MYDBG_LogRecord rec = {};
+    rec.mikros = esp_timer_get_time();
+    rec.typ = wert.typ;
+    rec.flags = flags | MYDBG_FLAG_ISR;
+    rec.stufe = 1;
+    rec.wert = wert.daten;
+    if (!MYDBG_pufferSchreiben(rec, &site))
+    {
+        MYDBG_verworfen++; // eine ISR kann weder warten noch den ältesten Eintrag sicher verwerfen
+        return;
+    }
+    MYDBG_verbraucherWecken();
+} // Ende der Funktion MYDBG_isrErfassen
+
+#ifdef MYDBG_ASYNC
+// === Asynchrone Ausgabe: Ausgabe-Task ===
+// Der Aufrufer kopiert nur einen Eintrag in den Eintragspuffer (wenige Mikrosekunden),
+// Konsole, Ringpuffer, Statusdatei und WebSocket bedient der Task "MYDBG" im Hintergrund.
+
+// Ausgabe-Task: leert den Puffer, sobald er geweckt wird (spätestens alle 100 ms)
+inline void MYDBG_asyncTask(void *)
+{
+    uint32_t gemeldetVerworfen = 0; // zuletzt auf der Konsole gemeldeter Stand von MYDBG_verworfen
+    for (;;)
+    {
+        // Liegt ein WebSocket-Bündel bereit, nur so lange schlafen wie sein Zeitfenster
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MYDBG_wsBuendel.anzahl ? MYDBG_WS_FENSTER_MS : 100));
+        {
+            MYDBG_Sperre sperre;
+            MYDBG_pufferLeeren();
+            MYDBG_wsPruefen();
+            MYDBG_systemAktualisieren();
+        }
+        uint32_t verworfen = MYDBG_verworfen;
+        if (verworfen != gemeldetVerworfen)
+        {
+            Serial.printf("[MYDBG] ⚠️ Eintragspuffer voll – bisher %u Einträge verworfen\n", (unsigned)verworfen);
+            gemeldetVerworfen = verworfen;
+        }
+    }
+} // Ende der Funktion MYDBG_asyncTask
+
+// Startet den Ausgabe-Task (einmalig, beim ersten Eintrag aus einem Task)
+inline void MYDBG_asyncStart()
+{
+    static std::atomic<bool> gestartet{false};
+    if (MYDBG_verbraucher || gestartet.exchange(true))
+        return;
+    TaskHandle_t task = nullptr;
+    xTaskCreatePinnedToCore(MYDBG_asyncTask, "MYDBG", MYDBG_TASK_STACK, nullptr, MYDBG_TASK_PRIO, &task, tskNO_AFFINITY);
+    MYDBG_verbraucher = task;
+} // Ende der Funktion MYDBG_asyncStart
+
+// Legt einen Eintrag in den Puffer, bei Überlauf nach MYDBG_ueberlauf
+inline void MYDBG_queuePush(const MYDBG_LogRecord &rec)
+{
+    MYDBG_asyncStart();
+    // Der Ausgabe-Task selbst darf nie auf sich warten
+    bool blockieren = MYDBG_ueberlauf == MYDBG_BLOCKIERE && xTaskGetCurrentTaskHandle() != MYDBG_verbraucher;
+
+    while (!MYDBG_pufferSchreiben(rec, nullptr))
+    {
+        if (blockieren)
+        {
+            MYDBG_verbraucherWecken();
+            vTaskDelay(1);
+            continue;
+        }
+        MYDBG_verworfen++;
+        MYDBG_LogRecord alt;
+        MYDBG_Site *site;
+        if (MYDBG_ueberlauf != MYDBG_VERWIRF_AELTESTE || !MYDBG_ringNehmen(MYDBG_puffer[xPortGetCoreID()], alt, site))
+            return;
+    }
+    MYDBG_verbraucherWecken();
+} // Ende der Funktion MYDBG_queuePush
+#endif // MYDBG_ASYNC
+
+// Übernimmt einen MYDBG-Aufruf in einen Eintrag und gibt ihn sofort aus oder legt ihn in den Eintragspuffer
+// Gespeichert werden nur ID der Aufrufstelle und Rohwert, formatiert wird erst bei der Ausgabe
+inline void MYDBG_erfassen(MYDBG_Site &site, uint8_t flags, uint8_t stufe, const MYDBG_Wert &wert)
+{
+    if (site.id == 0)
+        MYDBG_siteRegistrieren(site, wert.typ);
+    MYDBG_LogRecord rec = {};
+    rec.site = site.id;
+    rec.mikros = esp_timer_get_time(); // Uhrzeit wird erst bei der Ausgabe berechnet
+    rec.boot = MYDBG_zeit.boot;
+    rec.typ = wert.typ;
+    rec.resetReason = (uint8_t)MYDBG_resetGrund();
+    rec.flags = flags;
+    rec.stufe = stufe;
+    rec.wert = wert.daten;
+    if (!(site.status & MYDBG_SITE_GESPEICHERT))
+        rec.flags |= MYDBG_FLAG_SITE;
+#ifndef MYDBG_OHNE_FLUGSCHREIBER
+    MYDBG_flug.schreiben(rec); // im Kontext des Aufrufers, damit auch der letzte Aufruf vor einem Absturz erhalten bleibt
+    if (rec.flags == 0)
+        return; // Aufruf ohne Ausgabe, Stelle bereits gespeichert
+#endif
+#ifdef MYDBG_ASYNC
+    if (MYDBG_drosseln(site, rec))
+    {
+        MYDBG_gesundheitEintragen(rec); // im Task des Aufrufers, nicht im Ausgabe-Task
+        MYDBG_queuePush(rec);
+    }
+#else
+    MYDBG_Sperre sperre;  // Aufrufe aus mehreren Tasks nacheinander
+    MYDBG_pufferLeeren(); // zuerst, was ISRs seit dem letzten Aufruf abgelegt haben
+    if (MYDBG_drosseln(site, rec))
+    {
+        MYDBG_gesundheitEintragen(rec);
+        MYDBG_ausgeben(rec);
+    }
+#endif
+} // Ende der Funktion MYDBG_erfassen
+
+// Verteilt einen Eintrag an die Ausgaben: Konsole, Ringpuffer, Statusdatei und WebSocket
+inline void MYDBG_ausgeben(MYDBG_LogRecord &rec)
+{
+    if (rec.flags & MYDBG_FLAG_SITE)
+    {
+        if (!MYDBG_filesystemReady)
+            MYDBG_initFilesystem();
+        MYDBG_Site *site = MYDBG_siteSuchen(rec.site);
+        if (site && MYDBG_filesystemReady)
+            MYDBG_siteSpeichern(*site); // Texte einmalig ablegen, damit der Eintrag nach einem Neustart lesbar bleibt
+    }
+    if (rec.flags & MYDBG_FLAG_KONSOLE)
+    {
+#ifdef MYDBG_SERIAL_BINAER
+        MYDBG_serialBinaer(rec);
+#else
+        MYDBG_Klartext k;
+        MYDBG_klartext(rec, k);
+        MYDBG_Zeile<> meldung;
+        meldung << "[MYDBG] > " << k.zeile << " | " << k.msg;
+        if (k.varName[0] && k.varValue[0])
+        {
+            meldung << " | " << k.varName << " = " << k.varValue;
+        }
+        if (rec.unterdrueckt)
+            meldung << " (+" << rec.unterdrueckt << " gedrosselt)";
+        Serial.println(meldung.text);
+#endif
+    }
+    if (rec.flags & MYDBG_FLAG_STOP)
+    {
+        if (!MYDBG_filesystemReady)
+            MYDBG_initFilesystem();
+        MYDBG_logToJson(rec); // zuerst, damit alle Ausgaben die Sequenznummer tragen
+        MYDBG_stopAusgabe(rec);
+        MYDBG_writeStatusFile(rec);
+        MYDBG_streamWebLineJSON(rec);
+    }
+} // Ende der Funktion MYDBG_ausgeben
+
+// Pause nach MYDBG(1…9, ...), maximal 9 Sekunden
+inline void MYDBG_warten(int waitIndex)
+{
+#ifndef MYDBG_ASYNC
+    {
+        MYDBG_Sperre sperre;
+        MYDBG_pufferLeeren();
+        MYDBG_wsSenden(); // vor der Pause nichts im WebSocket-Bündel liegen lassen (mit MYDBG_ASYNC erledigt das der Task)
+        MYDBG_systemAktualisieren();
+    }
+#endif
+    unsigned long ms = constrain(waitIndex * 1000, 0, 9000);
+    unsigned long t0 = millis();
+    while (millis() - t0 < ms)
+    {
+        delay(10);
+    }
+} // Ende der Funktion MYDBG_warten
 
 // JSON-Ausgabe der Logs über Webserver bereitstellen
 inline void MYDBG_addJsonRoutes(AsyncWebServer &server)
 {
     server.on("/mydbg_data.json", HTTP_GET, [](AsyncWebServerRequest *request)
+              { MYDBG_sendeChunked(request, "application/json", std::make_shared<MYDBG_LogJsonQuelle>()); });
+
+    // Binärer Ringpuffer und Tabelle der Aufrufstellen für tools/mydbg_decode.py
+    server.on("/mydbg_log.bin", HTTP_GET, [](AsyncWebServerRequest *request)
+              { MYDBG_sendeChunked(request, "application/octet-stream", std::make_shared<MYDBG_LogDumpQuelle>()); });
+    server.on("/mydbg_sites.json", HTTP_GET, [](AsyncWebServerRequest *request)
+              { MYDBG_sendeChunked(request, "application/json", std::make_shared<MYDBG_SitesJsonQuelle>()); });
+
+    // Letzter Status aus dem RAM, vor dem ersten Eintrag dieses Starts die gesicherte Datei
+    server.on("/mydbg_status.json", HTTP_GET, [](AsyncWebServerRequest *request)
               {
-        if (LittleFS.exists("/mydbg_data.json"))
+        MYDBG_Zeile<MYDBG_STATUS_JSON_MAX> json;
         {
-            request->send(LittleFS, "/mydbg_data.json", "application/json");
+            MYDBG_Sperre sperre; // MYDBG_writeStatusFile/MYDBG_statusSpeichern ändern den Status im Logging- oder MYDBG-Task
+            json.laenge = MYDBG_statusJson(json.text, sizeof(json.speicher));
         }
+        if (json.laenge > 0)
+            request->send(200, "application/json", json.text);
+        else if (LittleFS.exists("/mydbg_status.json"))
+            request->send(LittleFS, "/mydbg_status.json", "application/json");
         else
+            request->send(404, "application/json", "{\"error\":\"Kein Status vorhanden\"}"); });
+
+    // Gefilterte, seitenweise Abfrage als NDJSON
+    server.on("/mydbg_query", HTTP_GET, [](AsyncWebServerRequest *request)
+              {
+        static const char *const namen[] = {"since_seq", "limit", "func", "line", "level", "from", "to"};
+        MYDBG_LogFilter filter;
+        for (const char *name : namen)
         {
-            request->send(404, "application/json", "{\"error\":\"Keine Logdatei gefunden\"}");
-        } });
+            if (request->hasParam(name) && !filter.setzen(name, request->getParam(name)->value().c_str()))
+            {
+                MYDBG_Zeile<96> fehler;
+                fehler.printf("{\"error\":\"Ungültiger Parameter %s\"}", name);
+                request->send(400, "application/json", fehler.text);
+                return;
+            }
+        }
+        {
+            MYDBG_Sperre sperre;
+            if (!MYDBG_ring.bereit)
+                MYDBG_ringInit();
+        }
+        MYDBG_sendeChunked(request, "application/x-ndjson", std::make_shared<MYDBG_QueryQuelle>(filter)); });
+
+    // Laufzeiten der MYDBG_SCOPE/MYDBG_TIC-Messstellen, ?reset=1 leert sie beim Auslesen
+    server.on("/mydbg_profile.json", HTTP_GET, [](AsyncWebServerRequest *request)
+              {
+        bool leeren = request->hasParam("reset") && request->getParam("reset")->value() == "1";
+        MYDBG_sendeChunked(request, "application/json", std::make_shared<MYDBG_ProfilJsonQuelle>(leeren)); });
+
+    // Zähler, Pegel und Verteilungen von MYDBG_COUNTER/MYDBG_GAUGE/MYDBG_HISTOGRAM für Prometheus
+    server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request)
+              { MYDBG_sendeChunked(request, "text/plain; version=0.0.4", std::make_shared<MYDBG_MetrikQuelle>()); });
+
+    // Strecken von MYDBG_TRACE_BEGIN/END/SCOPE für chrome://tracing oder ui.perfetto.dev, ?reset=1 leert den Ring danach
+    server.on("/mydbg_trace.json", HTTP_GET, [](AsyncWebServerRequest *request)
+              {
+        bool leeren = request->hasParam("reset") && request->getParam("reset")->value() == "1";
+        MYDBG_sendeChunked(request, "application/json", std::make_shared<MYDBG_TraceQuelle>(leeren)); });
+
+    // Verlauf der MYDBG_WATCH-Variablen aus den Ringen im RAM
+    server.on("/mydbg_watch.json", HTTP_GET, [](AsyncWebServerRequest *request)
+              { MYDBG_sendeChunked(request, "application/json", std::make_shared<MYDBG_WatchQuelle>()); });
+
+    // Heap und Stack: aktueller Stand, Trend seit Start und Leck-Befund
+    server.on("/mydbg_health.json", HTTP_GET, [](AsyncWebServerRequest *request)
+              { MYDBG_sendeChunked(request, "application/json", std::make_shared<MYDBG_GesundheitQuelle>()); });
 
     server.on("/mydbg_watchdog.json", HTTP_GET, [](AsyncWebServerRequest *request)
               {
@@ -554,217 +5764,56 @@ inline void MYDBG_addJsonRoutes(AsyncWebServer &server)
     request->send(200, "text/plain", "Logdateien wurden gelöscht und neu vorbereitet."); });
 } // Ende der Funktion MYDBG_addJsonRoutes
 
+// Sendet die Web-Debug-Seite: gzip-gepackt direkt aus dem Flash, mit starkem ETag. Cache-Control: no-cache lässt
+// den Browser bei jedem Laden nachfragen; hat er den Stand schon (If-None-Match), genügt 304 ohne Inhalt. Nach einem
+// Firmware-Update mit geänderter Seite passt das ETag nicht mehr und die neue Seite wird geladen.
+inline void MYDBG_seiteSenden(AsyncWebServerRequest *request)
+{
+    AsyncWebHeader *frage = request->getHeader("If-None-Match");
+    AsyncWebServerResponse *antwort;
+    if (frage && (strstr(frage->value().c_str(), MYDBG_SEITE_ETAG) || frage->value() == "*"))
+    {
+        antwort = request->beginResponse(304);
+    }
+    else
+    {
+        antwort = request->beginResponse_P(200, "text/html; charset=utf-8", MYDBG_SEITE_GZ, sizeof(MYDBG_SEITE_GZ));
+        antwort->addHeader("Content-Encoding", "gzip");
+    }
+    antwort->addHeader("ETag", MYDBG_SEITE_ETAG);
+    antwort->addHeader("Cache-Control", "no-cache");
+    request->send(antwort);
+} // Ende der Funktion MYDBG_seiteSenden
+
 // Web-Debug-Seite starten
 inline void MYDBG_startWebDebug()
 {
     MYDBG_addJsonRoutes(MYDBG_server); // JSON-Routen für /mydbg_data.json und /mydbg_watchdog.json aktivieren
-    // HTTP-Handler für MYDBG_status.html
+    // HTTP-Handler für MYDBG_status.html (gzip-gepackt aus dem Flash, siehe MYDBG_seiteSenden)
     MYDBG_server.on("/MYDBG_status.html", HTTP_GET, [](AsyncWebServerRequest *request)
-                    { request->send(200, "text/html", R"rawliteral(
-            
-    <!DOCTYPE html>
-    <html lang="de">
-    <head>
-        <meta charset="UTF-8">
-        <title>MYDBG Web-Debug</title>
-        <style>
-            body { font-family: monospace; background: #111; color: #0f0; margin: 0; padding: 0; }
-            #header { position: sticky; top: 0; background: #111; padding: 10px; z-index: 10; }
-            h1 { margin: 0; font-size: 24px; }
-            #controls { margin-top: 10px; }
-            button { background: #0f0; color: #111; border: none; padding: 5px 10px; margin-right: 10px; cursor: pointer; }
-            button:hover { background: #5f5; }
-            table { width: 100%; border-collapse: collapse; table-layout: fixed; word-wrap: break-word; }
-            th, td { border: 1px solid #0f0; padding: 5px; text-align: left; }
-            th { background: #003300; color: #ccffcc; font-weight: bold; position: sticky; top: 160px; z-index: 5; }
-            tr:nth-child(even) { background: #000; }
-            #status, #mydbg_resetGrund { margin: 20px; font-size: 1.2em;font-weight: bold; color: #ccc; }
-        </style>
-    </head>
-    <body>
-        <div id="header">
-            <h1 id="mainTitle">MYDBG WEB-Debug</h1>
-            <div id="controls">
-                <button id="toggleProtocolBtn">Protokoll AUS</button>
-                <button id="showJsonBtn">Logdatei anzeigen</button>
-                <button id="showWatchdogBtn">Watchdog-Logs anzeigen</button>
-                <button id="deleteLogsBtn">Logdateien löschen</button>
-            </div>
-            <div id="status">Verbindung wird aufgebaut...</div>
-            <div id="mydbg_resetGrund">Letzter Reset: unbekannt</div>
-        </div>
-
-        <table id="logTable">
-            <thead>
-                <tr>
-                    <th>Zeile</th>
-                    <th>Funktion</th>
-                    <th>Datum</th>
-                    <th>Millis</th>
-                    <th>Nachricht</th>
-                    <th>Variable</th>
-                    <th>Wert</th>
-                </tr>
-            </thead>
-            <tbody id="logBody"></tbody>
-        </table>
-
-    <script>
-    const WEBSOCKET_TIMEOUT_MS = 20000; // 20 Sekunden
-    let conn;
-    let retryDelay = 3000;
-    let statusDiv = document.getElementById('status');
-    let resetDiv = document.getElementById('mydbg_resetGrund');
-    let logBody = document.getElementById('logBody');
-    let mainTitle = document.getElementById('mainTitle');
-    let toggleBtn = document.getElementById('toggleProtocolBtn');
-    let protocolActive = true;
-    let lastMessageTime = Date.now();
-
-    function setVerbindungsStatus(ok) {
-        if (ok) {
-            statusDiv.innerText = "✅ Verbindung aktiv.";
-            statusDiv.style.color = "#0f0";
-            document.title = "✅ MYDBG verbunden";
-        } else {
-            statusDiv.innerText = "❌ Keine Verbindung!";
-            statusDiv.style.color = "#f00";
-            document.title = "❌ MYDBG getrennt";
-        }
-    }
-
-    function handleMessage(event) {
-        lastMessageTime = Date.now();
-        if (!protocolActive) return;
-
-        let data = JSON.parse(event.data);
-        let row = document.createElement('tr');
-        row.innerHTML = 
-            "<td>" + data.pgmZeile + "</td>" +
-            "<td>" + data.pgmFunc + "</td>" +
-            "<td>" + data.timestamp + "</td>" +
-            "<td>" + (data.millis || "-") + "</td>" +
-            "<td>" + data.msg + "</td>" +
-            "<td>" + data.varName + "</td>" +
-            "<td>" + data.varValue + "</td>";
-
-        logBody.insertBefore(row, logBody.firstChild);
-
-        if (data.fs_free_kb !== undefined && data.fs_free_percent !== undefined && data.fs_free_kb >= 0) {
-            statusDiv.innerText = "✅ Verbindung aktiv. Freier Speicher: " + data.fs_free_kb + " kB (" + data.fs_free_percent.toFixed(1) + "%)";
-        }
-
-        if (data.resetReason !== undefined && data.resetReason > 0) {
-            const grundText = data.ResetGrund || interpretResetReason(data.resetReason);
-            const color = data.ResetColor || "#ccc";
-            resetDiv.innerText = "Letzter Reset: " + grundText;
-            resetDiv.style.color = color;
-        }
-    }
-
-    function interpretResetReason(code) {
-        const reasons = {
-            1: "PowerOn",
-            2: "ExtReset",
-            3: "SW-Reset",
-            4: "Panic",
-            5: "Int-WDT",
-            6: "Task-WDT",
-            7: "WDT",
-            8: "DeepSleep",
-            9: "Brownout",
-            10: "SDIO",
-            11: "RTC Watchdog",
-            12: "Unknown Reset"
-        };
-        return reasons[code] || "Unbekannt (" + code + ")";
-    }
-
-    function startWebSocket() {
-        conn = new WebSocket('ws://' + location.host + '/dbgws');
-
-        conn.onopen = () => {
-            setVerbindungsStatus(true);
-            console.log("WebSocket verbunden");
-        };
-
-        conn.onmessage = handleMessage;
-
-        conn.onclose = () => {
-            setVerbindungsStatus(false);
-            console.warn("WebSocket getrennt – neuer Versuch in " + retryDelay + "ms");
-            setTimeout(startWebSocket, retryDelay);
-        };
-
-        conn.onerror = (err) => {
-            console.error("WebSocket Fehler:", err);
-            conn.close(); // erzwingt reconnect über onclose
-        };
-    }
-
-    // Lebenszeichen überwachen – wird jede 3s geprüft
-    setInterval(() => {
-        if (Date.now() - lastMessageTime > WEBSOCKET_TIMEOUT_MS) { 
-            console.warn("⚠️ Keine Daten seit 20s – Erzwinge reconnect");
-            if (conn && conn.readyState === WebSocket.OPEN) {
-                conn.close(); // triggert onclose und reconnect
-            }
-        }
-    }, 3000);
-
-    startWebSocket();
-
-    document.getElementById('showJsonBtn').addEventListener('click', () => {
-        window.open('/mydbg_data.json', '_blank');
-    });
-    document.getElementById('showWatchdogBtn').addEventListener('click', () => {
-        window.open('/mydbg_watchdog.json', '_blank');
-    });
-    document.getElementById('deleteLogsBtn').addEventListener('click', () => {
-        if (confirm('Willst du wirklich alle Logdateien löschen?')) {
-            fetch('/mydbg_delete_logs')
-                .then(response => response.text())
-                .then(text => {
-                    alert(text);
-                    logBody.innerHTML = "";
-                })
-                .catch(error => alert('Fehler beim Löschen: ' + error));
-        }
-    });
-    toggleBtn.addEventListener('click', () => {
-        protocolActive = !protocolActive;
-        if (protocolActive) {
-            toggleBtn.textContent = "Protokoll AUS";
-            mainTitle.textContent = "MYDBG WEB-Debug";
-            mainTitle.style.color = "#0f0";
-            if (conn.readyState === WebSocket.OPEN) conn.send("PROTOKOLL_EIN");
-        } else {
-            toggleBtn.textContent = "Protokoll EIN";
-            mainTitle.textContent = "MYDBG WEB-Debug Protokoll AUS";
-            mainTitle.style.color = "#f00";
-            if (conn.readyState === WebSocket.OPEN) conn.send("PROTOKOLL_AUS");
-        }
-    });
-    </script>
-
-    </body>
-    </html>
-
-    )rawliteral"); });
+                    { MYDBG_seiteSenden(request); });
 
     // WebSocket Events
-    MYDBG_ws.onEvent([](AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type,
+    MYDBG_ws.onEvent([](AsyncWebSocket * /*server*/, AsyncWebSocketClient *client, AwsEventType type,
                         void *arg, uint8_t *data, size_t len)
                      {
             if (type == WS_EVT_CONNECT)
             {
-                Serial.println("[MYDBG] WebSocket verbunden");
-                MYDBG_webClientActive = true;
+                if (MYDBG_wsClientNeu(client->id()))
+                {
+                    Serial.println("[MYDBG] WebSocket verbunden");
+                }
+                else
+                {
+                    // 1013 "Try Again Later": ohne Platz bekäme der Client nie einen Eintrag
+                    Serial.printf("[MYDBG] ⚠️ WebSocket abgewiesen: schon %d Clients (MYDBG_WS_MAX_CLIENTS)\n", MYDBG_WS_MAX_CLIENTS);
+                    client->close(1013, "MYDBG_WS_MAX_CLIENTS");
+                }
             }
             else if (type == WS_EVT_DISCONNECT)
             {
                 Serial.println("[MYDBG] WebSocket getrennt");
-                MYDBG_webClientActive = false;
+                MYDBG_wsClientWeg(client->id());
             }
             else if (type == WS_EVT_DATA)
             {
@@ -772,17 +5821,34 @@ inline void MYDBG_startWebDebug()
                 if (info->final && info->index == 0 && info->len == len)
                 {
                     String msg = String((char *)data).substring(0, len);
+                    // PROTOKOLL_AUS/EIN und ABO betreffen nur diesen Client, nicht Konsole, Ringpuffer oder andere Clients
                     if (msg == "PROTOKOLL_AUS")
                     {
-                        MYDBG_isEnabled = false;
-                        MYDBG_stopEnabled = false;
-                        Serial.println("[MYDBG] WebSocket-Befehl: Protokoll AUS empfangen.");
+                        MYDBG_wsAboAendern(client->id(), nullptr, true);
+                        Serial.printf("[MYDBG] WebSocket-Befehl: Protokoll AUS für Client %u empfangen.\n", (unsigned)client->id());
                     }
                     else if (msg == "PROTOKOLL_EIN")
                     {
-                        MYDBG_isEnabled = true;
-                        MYDBG_stopEnabled = true;
-                        Serial.println("[MYDBG] WebSocket-Befehl: Protokoll EIN empfangen.");
+                        MYDBG_wsAboAendern(client->id(), nullptr, false);
+                        Serial.printf("[MYDBG] WebSocket-Befehl: Protokoll EIN für Client %u empfangen.\n", (unsigned)client->id());
+                    }
+                    else if (msg == "ABO" || msg.startsWith("ABO "))
+                    {
+                        const char *parameter = msg.c_str() + 3;
+                        while (*parameter == ' ')
+                            parameter++;
+                        if (MYDBG_wsAboAendern(client->id(), parameter))
+                            Serial.printf("[MYDBG] WebSocket-Abo für Client %u: %s\n", (unsigned)client->id(), *parameter ? parameter : "alle Einträge");
+                        else
+                            Serial.printf("[MYDBG] ⚠️ Ungültiges WebSocket-Abo von Client %u: %s\n", (unsigned)client->id(), parameter);
+                    }
+                    else if (msg == "FORMAT_MSGPACK")
+                    {
+                        MYDBG_wsFormat(client, MYDBG_WS_MSGPACK);
+                    }
+                    else if (msg == "FORMAT_JSON")
+                    {
+                        MYDBG_wsFormat(client, MYDBG_WS_JSON);
                     }
                 }
             } });
@@ -814,34 +5880,18 @@ inline String MYDBG_getTimestamp()
     return String(buf);
 } // Ende der Funktion MYDBG_getTimestamp
 
-// Zeitsynchronisation starten
+// Zeitsynchronisation starten: SNTP läuft im Hintergrund, MYDBG_zeitSynchronisiert() meldet das Ergebnis
 inline void MYDBG_initTime(const char *ntpServer)
 {
-    if (WiFi.status() != WL_CONNECTED)
+    if (MYDBG_zeit.sntpGestartet || WiFi.status() != WL_CONNECTED)
     {
-        // Kein WLAN – keine Zeit möglich
+        // Kein WLAN – beim nächsten Aufruf erneut versuchen (kostet nur die Statusabfrage)
         return;
     }
 
-    configTime(3600, 0, ntpServer); // z. B. UTC+1
-    delay(1000);
-
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo))
-    {
-        if (!MYDBG_timeInitDone)
-        {
-            // Nur einmal melden – vorher war keine Zeit da
-            Serial.println("[MYDBG] ⏰ Zeit über NTP synchronisiert.");
-        }
-        MYDBG_timeInitDone = true;
-    }
-    else
-    {
-        // nur bei echtem Fehler
-        Serial.println("[MYDBG] ⚠️ Zeit konnte nicht per NTP bezogen werden.");
-        MYDBG_timeInitDone = false;
-    }
+    sntp_set_time_sync_notification_cb(MYDBG_zeitSynchronisiert);
+    configTime(3600, 0, ntpServer); // z. B. UTC+1, kehrt sofort zurück
+    MYDBG_zeit.sntpGestartet = true;
 } // Ende der Funktion MYDBG_initTime
 
 // Hilfsfunktionen für JSON-Logs
@@ -855,9 +5905,26 @@ void MYDBG_displayJsonLogs()
     };
 
     const LogFileInfo dateien[] = {
-        {"/mydbg_data.json", "JSON-Logdatei", "log"},
         {"/mydbg_watchdog.json", "Watchdog-Logdatei", "watchdogs"}};
 
+    MYDBG_Sperre sperre; // Ausgabe nicht mit Einträgen anderer Tasks mischen
+    Serial.println("\n=== Inhalt des Log-Ringpuffers (neuester zuerst) ===");
+    if (!MYDBG_ring.bereit)
+        MYDBG_ringInit();
+    MYDBG_RingLeser leser;
+    leser.oeffnen();
+    MYDBG_LogRecord rec;
+    MYDBG_Klartext k;
+    char zeit[30];
+    while (leser.naechster(rec))
+    {
+        MYDBG_formatZeit(MYDBG_unixZeit(rec), zeit, sizeof(zeit));
+        MYDBG_klartext(rec, k);
+        Serial.printf("#%u Zeit: %s | Funktion: %s | Zeile: %u | Nachricht: %s | Variable: %s = %s | Reset: %u\n",
+                      (unsigned)rec.seq, zeit, k.func, (unsigned)k.zeile, k.msg, k.varName, k.varValue, (unsigned)rec.resetReason);
+    }
+    leser.schliessen();
+
     for (const auto &datei : dateien)
     {
         Serial.printf("\n=== Inhalt der %s ===\n", datei.titel);
@@ -874,7 +5941,7 @@ void MYDBG_displayJsonLogs()
             continue;
         }
 
-        StaticJsonDocument<2048> doc;
+        JsonDocument doc;
         DeserializationError error = deserializeJson(doc, file);
         file.close();
 
@@ -904,6 +5971,7 @@ void MYDBG_displayJsonLogs()
 // Löschen und Neuinitialisieren der JSON-Logs
 inline void MYDBG_resetJsonFiles()
 {
+    MYDBG_Sperre sperre;
     MYDBG_deleteJsonLogs();
     MYDBG_prepareJsonFiles();
     Serial.println("[MYDBG] ✅ JSON-Dateien wurden gelöscht und neu vorbereitet.");
@@ -912,11 +5980,27 @@ inline void MYDBG_resetJsonFiles()
 // Löschen der JSON-Logs
 void MYDBG_deleteJsonLogs()
 {
-    if (LittleFS.exists("/mydbg_data.json"))
+    MYDBG_Sperre sperre; // kommt auch aus dem Webserver-Task (/mydbg_delete_logs)
+    MYDBG_ringSchliessen();
+    char pfad[32];
+    for (uint32_t nr = MYDBG_ring.ersteNr; nr <= MYDBG_ring.letzteNr; nr++)
     {
-        LittleFS.remove("/mydbg_data.json");
-        Serial.println("[MYDBG] /mydbg_data.json gelöscht.");
+        MYDBG_segPfad(pfad, sizeof(pfad), nr);
+        LittleFS.remove(pfad);
+    }
+    LittleFS.remove(MYDBG_SEG_MANIFEST); // Budget gilt wieder aus MYDBG_LOG_BUDGET_PROZENT
+    LittleFS.remove(MYDBG_SEG_TEMP);
+    MYDBG_ring = MYDBG_RingState();
+    Serial.printf("[MYDBG] Log-Segmente in " MYDBG_SEG_VERZEICHNIS " gelöscht.\n");
+    if (LittleFS.exists(MYDBG_SITES_DATEI))
+    {
+        LittleFS.remove(MYDBG_SITES_DATEI);
+        Serial.println("[MYDBG] " MYDBG_SITES_DATEI " gelöscht.");
     }
+    MYDBG_system.fsGeaendert = true;
+    MYDBG_siteIndexAnzahl = 0;
+    for (MYDBG_Site *site = MYDBG_siteListe; site; site = site->naechste)
+        site->status &= ~MYDBG_SITE_GESPEICHERT;
     if (LittleFS.exists("/mydbg_watchdog.json"))
     {
         LittleFS.remove("/mydbg_watchdog.json");
@@ -927,6 +6011,8 @@ void MYDBG_deleteJsonLogs()
         LittleFS.remove("/mydbg_status.json");
         Serial.println("[MYDBG] /mydbg_status.json gelöscht.");
     }
+    MYDBG_status.gueltig = false;
+    MYDBG_status.geaendert = false;
     Serial.println("\aJSON-Dateien gelöscht!\a");
 } // Ende von MYDBG_deleteJsonLogs()
 
@@ -1012,6 +6098,19 @@ void processSerialInput()
         Serial.println("[MYDBG] Modus 7 gesetzt: Alle JSON-Logs löschen und neu vorbereiten");
         MYDBG_resetJsonFiles();
     }
+    else if (input == "8")
+    {
+        MYDBG_profilAnzeigen();
+    }
+    else if (input == "9")
+    {
+        MYDBG_profilZuruecksetzen();
+        Serial.println("[MYDBG] Modus 9: Profil zurückgesetzt");
+    }
+    else if (input == "0")
+    {
+        MYDBG_gesundheitAnzeigen();
+    }
     else
     {
         Serial.println("[MYDBG] Ungültige Eingabe: " + input);
@@ -1033,7 +6132,7 @@ inline void MYDBG_MENUE_IMPL(const char *aufruferFunc)
     if (!startInfoGezeigt)
     {
         Serial.println("\n=== Systemeinstellungen (nur beim ersten Menüaufruf) ===");
-        Serial.printf("[MYDBG] MAX_LOGFILES     = %d   >>> Maximale Anzahl gespeicherter Logeinträge\n", MYDBG_MAX_LOGFILES);
+        Serial.printf("[MYDBG] MAX_LOGFILES     = %d   >>> Angezeigte Logeinträge (gespeichert wird bis zum Budget)\n", MYDBG_MAX_LOGFILES);
         Serial.printf("[MYDBG] MAX_WATCHDOGS    = %d   >>> Maximale Anzahl gespeicherter Watchdog-Einträge\n", MYDBG_MAX_WATCHDOGS);
         Serial.printf("[MYDBG] WDT_DEFAULT      = %d   >>> Standard-Watchdog in Sekunden (bei Debug-Stop)\n", MYDBG_WDT_DEFAULT);
         Serial.printf("[MYDBG] WDT_EXTENDED     = %d   >>> Erweiterter Watchdog bei Benutzerwahl (z. B. Menü)\n", MYDBG_WDT_EXTENDED);
@@ -1047,6 +6146,12 @@ inline void MYDBG_MENUE_IMPL(const char *aufruferFunc)
 #else
         Serial.println("[MYDBG] Web-Debug wird automatisch gestartet (kein MYDBG_WEBDEBUG_NUR_MANUELL)");
 #endif
+        Serial.printf("[MYDBG] COMPILE_LEVEL    = %d   >>> MYDBG-Aufrufe mit kleinerem wait sind nicht übersetzt\n", MYDBG_COMPILE_LEVEL);
+#ifdef MYDBG_ASYNC
+        Serial.printf("[MYDBG] MYDBG_ASYNC ist AKTIV – Ausgabe über Eintragspuffer (%d Plätze je Kern) und Task \"MYDBG\"\n", MYDBG_QUEUE_LAENGE);
+#else
+        Serial.println("[MYDBG] Ausgabe direkt im aufrufenden Task (kein MYDBG_ASYNC)");
+#endif
 
         Serial.println("[MYDBG] WLAN-Status: " + String(WiFi.status() == WL_CONNECTED ? "verbunden mit : " + String(WiFi.SSID()) : "nicht verbunden"));
 
@@ -1060,7 +6165,11 @@ inline void MYDBG_MENUE_IMPL(const char *aufruferFunc)
     }
 
     // ResetGrund gleich am Anfang anzeigen
-    esp_reset_reason_t rsn = esp_reset_reason();
+    {
+        MYDBG_Sperre sperre;
+        MYDBG_systemAktualisieren(true);
+    }
+    esp_reset_reason_t rsn = MYDBG_resetGrund();
     MYDBG_ResetInfo info = MYDBG_interpretResetReason(rsn);
 
     Serial.printf("Letzter Reset: %s (Code %d)\n", info.text, rsn);
@@ -1071,10 +6180,37 @@ inline void MYDBG_MENUE_IMPL(const char *aufruferFunc)
         Serial.println("⚠️  ⚠️  ⚠️  Watchdog-Reset erkannt! ⚠️  ⚠️  ⚠️");
     }
 
-    if (MYDBG_filesystemReady)
+    Serial.printf("Heap: %u Byte frei (Minimum seit Start: %u Byte)", (unsigned)MYDBG_system.heapFrei, (unsigned)MYDBG_system.heapMin);
+    if (MYDBG_system.rssi != 0)
+        Serial.printf(", WLAN: %d dBm", MYDBG_system.rssi);
+    Serial.println();
+
+    Serial.printf("Log: %u Einträge in %u Segmenten, %u von %u kB belegt (Budget %u%% der Partition, MYDBG_setzeLogBudget)\n",
+                  (unsigned)(MYDBG_ring.nextSeq - MYDBG_ring.ersteSeq), (unsigned)MYDBG_ring.segmente(),
+                  (unsigned)(MYDBG_ring.belegt / 1024), (unsigned)(MYDBG_segBudget() / 1024), (unsigned)MYDBG_ring.budgetProzent);
+    Serial.printf("Status: %u Einträge seit Start, %u davon in /mydbg_status.json geschrieben\n",
+                  (unsigned)MYDBG_status.aktualisierungen, (unsigned)MYDBG_status.schreibvorgaenge);
+    uint32_t gedrosselt = 0;
+    for (MYDBG_Site *site = MYDBG_siteListe; site; site = site->naechste)
+        gedrosselt += site->drossel.unterdrueckt;
+    Serial.printf("Drosselung: %u/s je Stelle, Burst %u, gleiche Werte alle %u ms – bisher %u Aufrufe gedrosselt\n",
+                  (unsigned)MYDBG_rateProS, (unsigned)MYDBG_rateBurst, (unsigned)MYDBG_wiederholungMs, (unsigned)gedrosselt);
+
+    Serial.printf("Eintragspuffer: %u von %d belegt (%d je Kern), %u Einträge verworfen\n", (unsigned)MYDBG_pufferBelegt(),
+                  MYDBG_QUEUE_LAENGE * portNUM_PROCESSORS, MYDBG_QUEUE_LAENGE, (unsigned)MYDBG_verworfen);
+    if (MYDBG_watchListe)
+    {
+        unsigned anzahl = 0;
+        for (MYDBG_Watch *w = MYDBG_watchListe; w; w = w->naechste)
+            anzahl++;
+        Serial.printf("Beobachtete Variablen: %u, alle %u ms, je %u Byte RAM\n", anzahl, (unsigned)MYDBG_watchIntervallMs,
+                      (unsigned)sizeof(MYDBG_Watch));
+    }
+
+    if (MYDBG_filesystemReady && MYDBG_system.fsGesamt > 0)
     {
-        size_t total = LittleFS.totalBytes();
-        size_t used = LittleFS.usedBytes();
+        size_t total = MYDBG_system.fsGesamt;
+        size_t used = MYDBG_system.fsBelegt;
         Serial.printf("Filesystem: %.2f kB verwendet, von %.2f kB (%.1f%% belegt)\n",
                       used / 1024.0, total / 1024.0, (used * 100.0) / total);
     }
@@ -1089,7 +6225,10 @@ inline void MYDBG_MENUE_IMPL(const char *aufruferFunc)
     Serial.println(MYDBG_webDebugEnabled ? "x 4 = Web-Debug anzeigen (MYDBG_status.html)" : "  4 = Web-Debug anzeigen (MYDBG_status.html)");
     Serial.println(!MYDBG_webDebugEnabled ? "x 5 = Web-Debug beenden (Standard)" : "  5 = Web-Debug beenden (Standard)");
     Serial.println("  6 = JSON-Logs anzeigen (Serial-Ausgabe)");
-    Serial.println("  7 = Alle JSON-Logs löschen (Filesystem)\n");
+    Serial.println("  7 = Alle JSON-Logs löschen (Filesystem)");
+    Serial.println("  8 = Profil anzeigen (MYDBG_SCOPE / MYDBG_TIC)");
+    Serial.println("  9 = Profil zurücksetzen");
+    Serial.println("  0 = Heap und Stack anzeigen (Trend, Leck-Prüfung)\n");
     processSerialInput(); // Eingabe verarbeiten
 } // Ende der Funktion MYDBG_MENUE_IMPL
 
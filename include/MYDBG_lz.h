@@ -0,0 +1,142 @@
+#pragma once
+/*
+  MYDBG_lz.h – kleine LZSS-Kompression für abgeschlossene Log-Segmente (wird von MYDBG.h eingebunden)
+
+  Ohne Abhängigkeit von Arduino, damit tools/mydbg_lz_bench.cpp sie auf dem PC messen kann.
+  Format: Steuerbyte mit 8 Flags (niedrigstes Bit zuerst), danach je Flag
+    0 → ein Literal-Byte
+    1 → Treffer aus 2 Byte: Abstand (12 Bit, 1…4095) und Länge (4 Bit, 3…18)
+  Arbeitsspeicher beim Packen: Hashtabelle mit 2^MYDBG_LZ_HASH_BITS Einträgen (2 kB), Eingabe liegt vollständig vor.
+  Beim Entpacken dient der Ausgabepuffer selbst als Fenster.
+*/
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define MYDBG_LZ_MIN 3
+#define MYDBG_LZ_MAX 18
+#define MYDBG_LZ_FENSTER 4095
+#define MYDBG_LZ_HASH_BITS 10
+#define MYDBG_LZ_KANDIDATEN 4 // zusätzliche Kandidaten im Abstand einer Satzgröße
+
+inline uint16_t MYDBG_lzHash(const uint8_t *p)
+{
+    uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
+    return (uint16_t)((v * 2654435761u) >> (32 - MYDBG_LZ_HASH_BITS));
+} // Ende der Funktion MYDBG_lzHash
+
+// Packt n Byte (höchstens 65535) und übergibt die Ausgabe gruppenweise an aus(const uint8_t *daten, size_t laenge).
+// schritt = Satzgröße: Einträge fester Größe wiederholen ihre Felder im gleichen Abstand,
+// deshalb werden neben dem Hash-Kandidaten die Positionen 1…4 Sätze davor geprüft.
+// hash muss Platz für 1 << MYDBG_LZ_HASH_BITS Einträge haben. Rückgabe: Anzahl gepackter Bytes.
+template <typename Ausgabe>
+size_t MYDBG_lzPacken(const uint8_t *ein, size_t n, Ausgabe &&aus, uint16_t *hash, uint16_t schritt)
+{
+    memset(hash, 0, sizeof(uint16_t) << MYDBG_LZ_HASH_BITS);
+    uint8_t gruppe[1 + 2 * 8];
+    size_t g = 1;
+    uint8_t token = 0;
+    size_t gesamt = 0;
+    gruppe[0] = 0;
+
+    size_t i = 0;
+    while (i < n)
+    {
+        size_t besteLaenge = 0, besterAbstand = 0;
+        size_t maxLaenge = n - i < MYDBG_LZ_MAX ? n - i : MYDBG_LZ_MAX;
+        if (maxLaenge >= MYDBG_LZ_MIN)
+        {
+            size_t kandidaten[1 + MYDBG_LZ_KANDIDATEN];
+            size_t anzahl = 0;
+            uint16_t h = MYDBG_lzHash(ein + i);
+            if (hash[h])
+                kandidaten[anzahl++] = hash[h] - 1; // 0 = leer, sonst Position + 1
+            hash[h] = (uint16_t)(i + 1);
+            for (size_t k = 1; schritt && k <= MYDBG_LZ_KANDIDATEN && k * schritt <= i; k++)
+                kandidaten[anzahl++] = i - k * schritt;
+            for (size_t c = 0; c < anzahl; c++)
+            {
+                size_t pos = kandidaten[c];
+                if (pos >= i || i - pos > MYDBG_LZ_FENSTER)
+                    continue;
+                size_t laenge = 0;
+                while (laenge < maxLaenge && ein[pos + laenge] == ein[i + laenge])
+                    laenge++;
+                if (laenge > besteLaenge)
+                {
+                    besteLaenge = laenge;
+                    besterAbstand = i - pos;
+                }
+            }
+        }
+
+        if (besteLaenge >= MYDBG_LZ_MIN)
+        {
+            gruppe[0] |= 1 << token;
+            gruppe[g++] = besterAbstand & 0xFF;
+            gruppe[g++] = ((besterAbstand >> 8) << 4) | (besteLaenge - MYDBG_LZ_MIN);
+            for (size_t j = 1; j < besteLaenge; j++)
+            {
+                if (i + j + MYDBG_LZ_MIN <= n)
+                    hash[MYDBG_lzHash(ein + i + j)] = (uint16_t)(i + j + 1);
+            }
+            i += besteLaenge;
+        }
+        else
+        {
+            gruppe[g++] = ein[i++];
+        }
+
+        if (++token == 8)
+        {
+            aus(gruppe, g);
+            gesamt += g;
+            g = 1;
+            token = 0;
+            gruppe[0] = 0;
+        }
+    }
+    if (token > 0)
+    {
+        aus(gruppe, g);
+        gesamt += g;
+    }
+    return gesamt;
+} // Ende der Funktion MYDBG_lzPacken
+
+// Entpackt bis zu max Byte; quelle() liefert das nächste gepackte Byte oder -1 am Ende.
+// Rückgabe: Anzahl entpackter Bytes, 0 bei beschädigten Daten.
+template <typename Quelle>
+size_t MYDBG_lzEntpacken(Quelle &&quelle, uint8_t *aus, size_t max)
+{
+    size_t o = 0;
+    while (o < max)
+    {
+        int steuer = quelle();
+        if (steuer < 0)
+            break;
+        for (uint8_t bit = 0; bit < 8 && o < max; bit++)
+        {
+            if (steuer & (1 << bit))
+            {
+                int b0 = quelle(), b1 = quelle();
+                if (b0 < 0 || b1 < 0)
+                    return 0;
+                size_t abstand = b0 | ((b1 >> 4) << 8);
+                size_t laenge = (b1 & 0x0F) + MYDBG_LZ_MIN;
+                if (abstand == 0 || abstand > o)
+                    return 0;
+                for (size_t j = 0; j < laenge && o < max; j++, o++)
+                    aus[o] = aus[o - abstand]; // Überlappung erlaubt (Wiederholungen)
+            }
+            else
+            {
+                int c = quelle();
+                if (c < 0)
+                    return 0;
+                aus[o++] = (uint8_t)c;
+            }
+        }
+    }
+    return o;
+} // Ende der Funktion MYDBG_lzEntpacken
@@ -0,0 +1,452 @@
+#pragma once
+/*
+  MYDBG_seite.h – Web-Debug-Seite /MYDBG_status.html, gzip-gepackt (wird von MYDBG.h eingebunden)
+
+  Erzeugt von tools/mydbg_seite.py aus tools/MYDBG_status.html – nicht von Hand ändern, sondern die
+  HTML-Datei bearbeiten und den Build (oder das Skript) laufen lassen.
+  Seite 21243 Byte, gepackt 6972 Byte.
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#define MYDBG_SEITE_ETAG "\"555724040a93b38f\"" // starkes ETag: Hash über die gepackten Bytes
+#define MYDBG_SEITE_ROH 21243 // Byte entpackt
+
+inline constexpr uint8_t MYDBG_SEITE_GZ[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xa5, 0x3c, 0x4d, 0x73, 0xdb, 0xc8,
+    0x72, 0x77, 0xff, 0x8a, 0x31, 0x36, 0xbb, 0x02, 0x56, 0x24, 0x44, 0x52, 0xb6, 0xd7, 0x4b, 0x4a,
+    0x72, 0x49, 0xb6, 0xe4, 0xd5, 0xb3, 0x6c, 0xa9, 0x2c, 0x79, 0x9d, 0xb7, 0x5a, 0x45, 0x05, 0x12,
+    0x43, 0x12, 0x4b, 0x10, 0xe0, 0x03, 0x40, 0x52, 0xd2, 0xae, 0xab, 0x72, 0xc9, 0x2d, 0x55, 0xef,
+    0x90, 0xaa, 0x1c, 0x52, 0x49, 0x25, 0x87, 0x57, 0xf9, 0x01, 0x39, 0xa4, 0xde, 0x61, 0x6f, 0xfe,
+    0x27, 0xfb, 0x07, 0xf2, 0x17, 0xd2, 0xdd, 0x33, 0x03, 0xcc, 0x00, 0x20, 0xa5, 0xad, 0xa7, 0xb2,
+    0x25, 0x62, 0x3e, 0x7a, 0x7a, 0x7a, 0xfa, 0x7b, 0x1a, 0xdc, 0x79, 0xfc, 0xea, 0xf4, 0xe5, 0xc5,
+    0x1f, 0xcf, 0x0e, 0xd9, 0x38, 0x9b, 0x86, 0x7b, 0x8f, 0x76, 0xf0, 0x0f, 0x0b, 0xbd, 0x68, 0xb4,
+    0x6b, 0xf9, 0xdc, 0xc2, 0x06, 0xee, 0xf9, 0x7b, 0x8f, 0x18, 0xfc, 0xec, 0x4c, 0x79, 0xe6, 0xb1,
+    0xc1, 0xd8, 0x4b, 0x52, 0x9e, 0xed, 0x5a, 0x1f, 0x2e, 0x8e, 0x9a, 0xcf, 0x2d, 0xd9, 0x95, 0x05,
+    0x59, 0xc8, 0xf7, 0xde, 0xfe, 0xf1, 0xd5, 0xc1, 0x6b, 0xf6, 0x91, 0xf7, 0x9b, 0xaf, 0x78, 0x7f,
+    0x3e, 0xda, 0xd9, 0x12, 0xcd, 0x62, 0x48, 0x9a, 0xdd, 0xaa, 0xcf, 0xf8, 0xd3, 0x8f, 0xfd, 0x5b,
+    0xf6, 0x33, 0x1b, 0xc6, 0x51, 0xd6, 0x1c, 0x7a, 0xd3, 0x20, 0xbc, 0xed, 0xb2, 0x69, 0x1c, 0xc5,
+    0xe9, 0xcc, 0x1b, 0xf0, 0x1e, 0xeb, 0x7b, 0x83, 0xc9, 0x28, 0x89, 0xe7, 0x91, 0xdf, 0x65, 0x5f,
+    0xb4, 0xdb, 0xed, 0x1e, 0x1b, 0xc4, 0x61, 0x9c, 0xc0, 0x43, 0x6b, 0xd8, 0xea, 0xb1, 0xa9, 0x97,
+    0x8c, 0x82, 0xa8, 0xcb, 0xe0, 0xe3, 0xcc, 0xf3, 0xfd, 0x20, 0x1a, 0xd1, 0xe7, 0x31, 0x0f, 0x46,
+    0xe3, 0xac, 0xcb, 0xda, 0xad, 0xd6, 0x62, 0xdc, 0x63, 0x7e, 0x90, 0xce, 0x42, 0x0f, 0x00, 0x0f,
+    0x43, 0x7e, 0xd3, 0xa3, 0xdf, 0x4d, 0x3f, 0x48, 0xf8, 0x20, 0x0b, 0x62, 0x98, 0x0c, 0x10, 0xe7,
+    0xd3, 0xa8, 0xc7, 0x3e, 0xe5, 0x48, 0x7d, 0x81, 0xbb, 0xe5, 0x09, 0xe0, 0x55, 0x5d, 0x3f, 0x5f,
+    0xa7, 0xdd, 0x9a, 0xdd, 0xe8, 0x93, 0xc6, 0x6d, 0x18, 0xaf, 0x21, 0x44, 0x5b, 0x4a, 0x83, 0x3b,
+    0xde, 0x65, 0x9d, 0x27, 0xe6, 0xd0, 0x2f, 0x06, 0xd0, 0x97, 0xc4, 0x61, 0x9a, 0xcf, 0x68, 0x66,
+    0xf1, 0xac, 0x0a, 0xb2, 0x3f, 0xcf, 0xb2, 0x38, 0x2a, 0xa3, 0x41, 0x3b, 0x57, 0x64, 0x20, 0x9c,
+    0xfa, 0x71, 0x02, 0xe8, 0x76, 0x59, 0x14, 0x47, 0x5c, 0xc3, 0xf0, 0xe9, 0xec, 0x46, 0x82, 0x94,
+    0x8b, 0x24, 0x8a, 0x2c, 0xd8, 0x36, 0x98, 0x27, 0x29, 0x82, 0x98, 0xc5, 0x41, 0x94, 0xf1, 0xa4,
+    0xba, 0x6e, 0x77, 0x1c, 0x2f, 0xaa, 0x44, 0x78, 0x3a, 0x7c, 0x6a, 0x6c, 0x65, 0x18, 0x84, 0x19,
+    0x8d, 0x2a, 0x0e, 0x80, 0x16, 0xa8, 0x6c, 0x46, 0x8d, 0x0c, 0xa2, 0xd9, 0x3c, 0xab, 0xec, 0xa9,
+    0xd5, 0x2a, 0x1d, 0xad, 0xda, 0x53, 0x1b, 0x40, 0xa5, 0x71, 0x18, 0xf8, 0xb2, 0x3d, 0x5f, 0xe6,
+    0xc9, 0xaa, 0x8d, 0xad, 0xe2, 0x25, 0x0d, 0x95, 0x30, 0x1e, 0x1d, 0x47, 0xc3, 0xb8, 0x20, 0x7f,
+    0xc8, 0x87, 0x05, 0x61, 0x24, 0x1a, 0x83, 0xc1, 0xc0, 0x98, 0x14, 0xf1, 0x39, 0x4f, 0x33, 0x7e,
+    0x90, 0xe1, 0x89, 0xe4, 0x3c, 0x25, 0x68, 0x6e, 0xc2, 0x3e, 0x1f, 0xc0, 0xe1, 0x86, 0xc8, 0xd6,
+    0xc0, 0x6a, 0x00, 0xb6, 0xc7, 0x90, 0x92, 0xc3, 0x30, 0x5e, 0x36, 0x61, 0x86, 0x37, 0xcf, 0x62,
+    0xc0, 0x1c, 0x56, 0x55, 0x7c, 0xda, 0xd2, 0x01, 0x64, 0x5e, 0x3f, 0xe4, 0x30, 0x77, 0x19, 0xf8,
+    0xd9, 0x98, 0x78, 0xf8, 0x4b, 0x45, 0x8d, 0x26, 0xa0, 0x16, 0x7a, 0xb3, 0x94, 0x13, 0xd3, 0xd2,
+    0xa7, 0x9e, 0x18, 0xdf, 0x04, 0x5c, 0xe2, 0x39, 0x80, 0x1a, 0x06, 0x37, 0xdc, 0x37, 0xc0, 0x8d,
+    0x1b, 0x2c, 0xf3, 0x91, 0xde, 0xf7, 0x11, 0xb4, 0x85, 0x0c, 0x53, 0x08, 0x4f, 0xa7, 0x83, 0x4f,
+    0x19, 0xbf, 0xc9, 0x9a, 0x5e, 0x18, 0x8c, 0x80, 0xa9, 0x91, 0x48, 0x3d, 0xb6, 0x1c, 0x07, 0x19,
+    0x6f, 0x12, 0x4d, 0x71, 0xf7, 0xcb, 0xc4, 0x9b, 0x15, 0xfb, 0xeb, 0xb2, 0x71, 0xe0, 0xfb, 0x3c,
+    0x92, 0x13, 0x8b, 0x66, 0x1e, 0x86, 0xc1, 0x2c, 0x0d, 0x52, 0x13, 0xb5, 0x2a, 0x1b, 0x6c, 0x6f,
+    0xeb, 0x9c, 0x30, 0x18, 0x0c, 0x87, 0x78, 0x0a, 0x74, 0xa4, 0x4b, 0x89, 0x58, 0x3f, 0x0e, 0x61,
+    0x87, 0xb3, 0x38, 0x0d, 0x84, 0xfc, 0xa6, 0x59, 0x30, 0x98, 0xdc, 0xc2, 0x8a, 0x28, 0x42, 0x30,
+    0xf9, 0xae, 0x19, 0x44, 0x3e, 0xd2, 0xdd, 0x60, 0xd4, 0x2c, 0x71, 0x47, 0x3c, 0x01, 0xb1, 0xae,
+    0x65, 0x3d, 0x6d, 0x9c, 0xef, 0x8e, 0x83, 0x08, 0xd6, 0x42, 0xe1, 0x54, 0x78, 0x0c, 0x87, 0xad,
+    0x12, 0xac, 0x70, 0xce, 0x07, 0x13, 0x6e, 0x52, 0xb6, 0x24, 0x7e, 0x9a, 0x22, 0x12, 0x47, 0xae,
+    0x31, 0x49, 0x9a, 0x79, 0xd9, 0x3c, 0x6d, 0xb0, 0x2f, 0xa6, 0xb7, 0x7e, 0x7f, 0x74, 0x9d, 0x70,
+    0xd0, 0xa5, 0xaf, 0x13, 0x40, 0x48, 0xd3, 0x21, 0x9d, 0x82, 0x9b, 0x85, 0x1a, 0x69, 0xbb, 0x1d,
+    0x3e, 0xed, 0xd5, 0xd0, 0x62, 0x15, 0xc7, 0x2e, 0xbd, 0x6c, 0x30, 0x3e, 0xe0, 0x09, 0x0f, 0x06,
+    0xe3, 0x2a, 0xcf, 0xaa, 0x75, 0x2a, 0x82, 0x4a, 0xd3, 0x5e, 0x82, 0x82, 0xcf, 0xca, 0x6c, 0x98,
+    0xf3, 0x46, 0x8b, 0xe6, 0x54, 0xe9, 0xb8, 0x8a, 0xc9, 0xca, 0xd0, 0x4f, 0xf8, 0x88, 0xc3, 0x21,
+    0x31, 0x60, 0xa3, 0xa8, 0x90, 0xc2, 0x44, 0x41, 0x2f, 0x10, 0xda, 0xd9, 0x92, 0x06, 0x63, 0x67,
+    0x4b, 0x98, 0xa0, 0x1d, 0xb4, 0x18, 0xd2, 0x96, 0xf8, 0xc1, 0x82, 0x05, 0xfe, 0xae, 0x25, 0xd4,
+    0xb5, 0x55, 0x58, 0x95, 0x1d, 0x50, 0xc6, 0xd8, 0x31, 0xf5, 0x82, 0xe8, 0x02, 0x8d, 0x8f, 0xa5,
+    0x8c, 0xd2, 0xe1, 0x81, 0x32, 0x4a, 0xe3, 0xb6, 0x36, 0x5e, 0x41, 0x52, 0x8a, 0x59, 0x83, 0x45,
+    0xfd, 0x52, 0x13, 0xe3, 0x90, 0x2c, 0x1e, 0x8d, 0x42, 0x7e, 0x96, 0xc4, 0x59, 0x0c, 0x74, 0x07,
+    0x6d, 0x60, 0xed, 0xd1, 0xc3, 0x04, 0x45, 0x7e, 0xff, 0xc3, 0xf9, 0xce, 0x96, 0x18, 0xbc, 0x1a,
+    0x42, 0x3a, 0x8e, 0x97, 0x7f, 0x48, 0xe3, 0x88, 0xe6, 0x9e, 0xc4, 0x23, 0xdf, 0xcb, 0x78, 0xc0,
+    0xbc, 0xe8, 0x0e, 0xa8, 0xcb, 0xa3, 0x87, 0xcd, 0xff, 0x88, 0x54, 0xf4, 0xe3, 0x11, 0xc1, 0x50,
+    0x0f, 0x4d, 0x00, 0x96, 0xfe, 0x0e, 0x40, 0x3e, 0x0f, 0x79, 0xc6, 0x71, 0x92, 0x81, 0x0a, 0x8f,
+    0x58, 0xf8, 0xf9, 0x7f, 0xd3, 0xc1, 0xb8, 0x0e, 0xc6, 0xce, 0x16, 0xd0, 0xaa, 0x86, 0x72, 0x82,
+    0xa3, 0xad, 0xbd, 0xef, 0x79, 0xd2, 0x07, 0xf9, 0x9b, 0x47, 0x23, 0x60, 0x9d, 0xc4, 0x07, 0xd6,
+    0x1f, 0x8e, 0x78, 0x1f, 0x04, 0xc0, 0x75, 0xdd, 0x55, 0x73, 0xcb, 0x42, 0x00, 0xa8, 0xf0, 0xec,
+    0x0e, 0x8d, 0xc5, 0x7b, 0x6c, 0xeb, 0xb2, 0x79, 0xd4, 0xe7, 0x13, 0x2f, 0x8a, 0x32, 0x0d, 0x82,
+    0xfc, 0x68, 0x72, 0x82, 0xb0, 0x31, 0x3a, 0x27, 0x08, 0x73, 0x53, 0xf4, 0x1d, 0xcd, 0xa3, 0x09,
+    0xea, 0x0d, 0x8b, 0x81, 0x2c, 0x0c, 0xf8, 0x18, 0x04, 0x88, 0x27, 0xbb, 0x56, 0xd1, 0x8c, 0xb2,
+    0xb6, 0x6b, 0xb5, 0x9f, 0xad, 0x03, 0xf2, 0x03, 0x0f, 0x80, 0xa7, 0x4c, 0x08, 0xd4, 0xc6, 0xec,
+    0x3b, 0x97, 0x1d, 0xb8, 0xac, 0xdd, 0x69, 0xb1, 0x18, 0x5d, 0x08, 0x90, 0x9b, 0x26, 0x48, 0x8b,
+    0xa3, 0xe0, 0x76, 0x9e, 0xac, 0x83, 0x7b, 0x01, 0x4a, 0xb3, 0x04, 0x16, 0x9b, 0xc0, 0x66, 0xb2,
+    0x77, 0xde, 0x60, 0x9c, 0x80, 0x1c, 0x67, 0x0d, 0xf6, 0xbd, 0x97, 0x04, 0xa8, 0xf4, 0x1b, 0xe0,
+    0x63, 0x25, 0x99, 0x82, 0xbc, 0xdd, 0xd1, 0x21, 0x6b, 0xa7, 0x5c, 0xd8, 0x2d, 0x6b, 0xef, 0xb7,
+    0x7f, 0xfd, 0x1f, 0xf6, 0x4e, 0x3c, 0xd7, 0x1c, 0x2d, 0x49, 0x23, 0x4e, 0x91, 0xf6, 0xd1, 0xda,
+    0x03, 0xf1, 0x83, 0xb6, 0x35, 0x04, 0xd7, 0x55, 0x8c, 0xbe, 0xfe, 0xc0, 0x8b, 0x16, 0x5e, 0x5a,
+    0x0c, 0x21, 0x75, 0x82, 0xf0, 0x44, 0x47, 0x0d, 0x13, 0xe8, 0x7a, 0x01, 0x07, 0xae, 0x3f, 0xe8,
+    0xdc, 0xca, 0xe6, 0xae, 0x27, 0x99, 0x4d, 0xd9, 0x75, 0x81, 0x0f, 0x3a, 0x3a, 0x59, 0xe1, 0xbf,
+    0x16, 0x6d, 0x89, 0xd9, 0x20, 0x07, 0xee, 0xd1, 0x41, 0x82, 0xd3, 0x3a, 0xae, 0xef, 0x56, 0x9c,
+    0xb2, 0x7a, 0xc4, 0x2b, 0x90, 0x84, 0xe9, 0xea, 0xee, 0xb7, 0x01, 0xd8, 0xc2, 0x74, 0x75, 0x7f,
+    0x7e, 0xd2, 0xab, 0x87, 0x28, 0x0e, 0x58, 0x3d, 0x02, 0x39, 0xa3, 0xda, 0x0b, 0x2d, 0x89, 0x2e,
+    0xca, 0x25, 0xb2, 0xec, 0x64, 0xe4, 0x8e, 0x4b, 0x22, 0x1e, 0xc0, 0x67, 0x38, 0x88, 0x2c, 0x61,
+    0x83, 0xd0, 0x4b, 0x53, 0x68, 0x23, 0x9b, 0x87, 0x4d, 0x3e, 0x9a, 0x1c, 0xe4, 0x8c, 0x5d, 0xeb,
+    0x1b, 0x3c, 0xab, 0xcc, 0xdf, 0x23, 0xd0, 0xbf, 0x6f, 0xf0, 0x56, 0xa6, 0xe9, 0xf2, 0x2d, 0x3a,
+    0x40, 0xf3, 0xc4, 0x77, 0xd2, 0x41, 0x12, 0xcc, 0xb2, 0xbd, 0x47, 0xa0, 0x96, 0xd3, 0x0c, 0x95,
+    0xf7, 0xf9, 0xe9, 0xcb, 0x37, 0x87, 0x17, 0xd7, 0x17, 0xc7, 0x6f, 0x0f, 0x4f, 0x3f, 0x5c, 0x5c,
+    0xbf, 0x3d, 0x67, 0xbb, 0x68, 0x8c, 0xd0, 0xf4, 0x6c, 0x6d, 0xc1, 0x27, 0x76, 0xce, 0x27, 0xa0,
+    0x40, 0x78, 0xf4, 0x08, 0x34, 0x1b, 0xac, 0x1b, 0x45, 0x3d, 0xfa, 0x94, 0xf0, 0x2c, 0xb9, 0x7d,
+    0xc5, 0xc1, 0xfa, 0xc1, 0x84, 0x6d, 0x1c, 0x4f, 0xcd, 0x42, 0x69, 0xbd, 0x02, 0x9e, 0xda, 0x65,
+    0x7e, 0x3c, 0x98, 0x4f, 0x79, 0x94, 0x81, 0x9b, 0x90, 0x1d, 0x86, 0x1c, 0x3f, 0x1e, 0xdc, 0x1e,
+    0xfb, 0xf6, 0x86, 0x18, 0xb4, 0xe1, 0x28, 0x48, 0xa0, 0x91, 0xee, 0x99, 0x51, 0xd6, 0x67, 0x6a,
+    0xae, 0x24, 0xea, 0xba, 0xa9, 0x72, 0x88, 0x36, 0x43, 0x3a, 0x93, 0xeb, 0xe7, 0x88, 0x41, 0xda,
+    0x2c, 0x72, 0x6f, 0xd7, 0xcf, 0xc1, 0x21, 0x6a, 0x86, 0xe6, 0xdb, 0xae, 0x99, 0x54, 0x8c, 0x52,
+    0xf3, 0x72, 0x03, 0xbb, 0x96, 0x1c, 0x6a, 0x90, 0x9a, 0x25, 0x4c, 0xe8, 0x3d, 0x8b, 0x55, 0xec,
+    0xac, 0x9a, 0x3d, 0x93, 0x4d, 0xfb, 0x10, 0xbf, 0x2d, 0x70, 0xe1, 0x2c, 0x99, 0x73, 0xb9, 0x71,
+    0x2f, 0xcd, 0xde, 0xf2, 0x34, 0xf5, 0x46, 0xfc, 0x22, 0x98, 0x62, 0x1f, 0xc8, 0x22, 0x77, 0xc1,
+    0x4b, 0xb5, 0x61, 0xf2, 0xa3, 0xe1, 0x3c, 0xa2, 0x98, 0x8f, 0xc1, 0xc1, 0x14, 0x76, 0x2a, 0x3d,
+    0xa7, 0x03, 0xb6, 0xe3, 0x89, 0xc3, 0x7e, 0x26, 0xfe, 0x0b, 0x86, 0x4c, 0x7b, 0xc2, 0x9f, 0x9c,
+    0x51, 0xdc, 0x20, 0x8a, 0x84, 0x9e, 0x06, 0xe0, 0xd6, 0x6f, 0xff, 0xfe, 0x4f, 0x4c, 0x33, 0x78,
+    0x1e, 0x28, 0x86, 0x85, 0x6b, 0xf5, 0x6a, 0xa6, 0x91, 0x17, 0xe3, 0x92, 0xa3, 0x86, 0x13, 0xd1,
+    0x2b, 0xd2, 0xc6, 0xe5, 0x44, 0xc8, 0x24, 0x2d, 0x09, 0xb2, 0x70, 0x59, 0xc0, 0x85, 0xee, 0x13,
+    0x4b, 0xcb, 0xf1, 0x9f, 0xc0, 0x97, 0x4e, 0xf9, 0x03, 0x70, 0xfb, 0x8f, 0x7f, 0x66, 0x6f, 0x78,
+    0x10, 0x71, 0x0d, 0xc3, 0xc7, 0x0f, 0xc2, 0x6d, 0xd8, 0xba, 0x07, 0x37, 0x80, 0x2c, 0x70, 0x83,
+    0x33, 0x4b, 0x38, 0x98, 0x65, 0x85, 0xda, 0xa3, 0x4f, 0x1a, 0x91, 0xc7, 0x5e, 0xe4, 0x87, 0x5c,
+    0x1e, 0x87, 0xcd, 0x17, 0x00, 0x43, 0x91, 0x74, 0xfd, 0x39, 0xa9, 0x23, 0xa0, 0x29, 0x2e, 0xb8,
+    0x24, 0x1e, 0x18, 0x40, 0x40, 0x37, 0x1a, 0xf0, 0x78, 0xc8, 0xf6, 0x93, 0xc4, 0xbb, 0x3d, 0x98,
+    0x0f, 0x87, 0x3c, 0xd1, 0x4f, 0x68, 0x3a, 0xdb, 0x9f, 0x0f, 0x23, 0x3e, 0x06, 0x54, 0xb5, 0x89,
+    0x0e, 0xe9, 0x05, 0x24, 0x09, 0x67, 0x68, 0x8e, 0x61, 0x4c, 0x32, 0x1f, 0x02, 0x0f, 0x87, 0x21,
+    0x78, 0x39, 0xde, 0x1c, 0xfc, 0xe2, 0x3e, 0xf8, 0x5e, 0x86, 0x03, 0xc7, 0xa6, 0x3c, 0x99, 0x80,
+    0x06, 0x51, 0x90, 0x41, 0x77, 0xcc, 0x93, 0x48, 0xed, 0x50, 0x21, 0xf7, 0xd8, 0x64, 0x43, 0x27,
+    0x1f, 0x46, 0x23, 0x60, 0xd1, 0x43, 0x08, 0xab, 0x93, 0xcf, 0x7f, 0x19, 0x71, 0x36, 0x89, 0xa7,
+    0x80, 0x15, 0x10, 0xab, 0xff, 0xf9, 0x57, 0x38, 0xc8, 0x30, 0x63, 0x1e, 0x84, 0xfe, 0x7f, 0x38,
+    0x3f, 0x7d, 0xd7, 0xa4, 0xcd, 0xf4, 0xd8, 0xcf, 0x56, 0x3a, 0x09, 0x66, 0x33, 0xee, 0x5b, 0xdd,
+    0xe8, 0x13, 0xac, 0x0f, 0xa6, 0x3f, 0x63, 0x9f, 0x7f, 0xed, 0xf3, 0x24, 0x9d, 0x81, 0x02, 0x01,
+    0x9b, 0xc8, 0x0b, 0x78, 0x82, 0x82, 0x30, 0x80, 0x28, 0xb3, 0x4b, 0x80, 0xdc, 0x19, 0xa6, 0x63,
+    0x8c, 0x8d, 0xe7, 0x98, 0xd2, 0x1a, 0x6e, 0x90, 0xd2, 0x5f, 0x9b, 0x3a, 0x75, 0xc2, 0x61, 0x83,
+    0x3b, 0x8c, 0x93, 0x43, 0x30, 0x3b, 0xf6, 0x1d, 0xda, 0xbe, 0x7d, 0xe9, 0x40, 0x3a, 0x06, 0xc3,
+    0x21, 0x28, 0x1a, 0x4b, 0x86, 0x9a, 0x3d, 0xde, 0xdd, 0x65, 0xc8, 0x96, 0x43, 0xe0, 0x30, 0x5f,
+    0x87, 0x47, 0xdd, 0xc5, 0x59, 0x14, 0x53, 0x56, 0x80, 0x93, 0x3b, 0x5f, 0x0d, 0x50, 0x86, 0x63,
+    0x0a, 0x2b, 0xdb, 0xfa, 0xed, 0xdf, 0xfe, 0xeb, 0xff, 0xfe, 0xfa, 0x67, 0x66, 0xb1, 0x4d, 0x66,
+    0x40, 0xd8, 0x84, 0xa6, 0x82, 0xea, 0x06, 0xf9, 0x98, 0xad, 0x89, 0xe9, 0xdd, 0x9c, 0x52, 0x5b,
+    0xa9, 0x37, 0x75, 0x2c, 0x67, 0x85, 0x50, 0x19, 0x84, 0xb0, 0x35, 0x8a, 0x12, 0x8f, 0xc3, 0xf1,
+    0x4a, 0xf6, 0x3d, 0x83, 0x10, 0x88, 0xd9, 0x11, 0xd0, 0x8e, 0x1d, 0x9d, 0xbe, 0x7f, 0xbb, 0x8f,
+    0x36, 0xe9, 0xf5, 0xd9, 0xfe, 0xcb, 0x37, 0x0e, 0x84, 0x59, 0xf3, 0x04, 0x62, 0x2e, 0xce, 0x8e,
+    0xe2, 0x04, 0x28, 0xd1, 0xa0, 0xcf, 0x42, 0x6e, 0x52, 0x74, 0x72, 0xb2, 0x42, 0x54, 0xa6, 0xb3,
+    0x13, 0x30, 0x16, 0x91, 0x3d, 0x33, 0xd8, 0x5a, 0x58, 0x3d, 0x1f, 0x8e, 0x38, 0xe2, 0x4b, 0x94,
+    0x10, 0xef, 0xfb, 0x80, 0x2f, 0xd5, 0xa0, 0x9e, 0x3e, 0x86, 0x4f, 0xc8, 0xdb, 0x14, 0x23, 0x91,
+    0xdd, 0x5f, 0xf1, 0x01, 0xb6, 0x28, 0x71, 0x22, 0xbd, 0x09, 0xdd, 0x2d, 0x7d, 0x56, 0x26, 0x34,
+    0x05, 0x68, 0xe1, 0x3d, 0x88, 0xc1, 0xc8, 0x1e, 0xa2, 0x42, 0x16, 0xb0, 0x5c, 0x9f, 0x20, 0xd8,
+    0x08, 0xf0, 0x03, 0x10, 0xf5, 0xb9, 0x60, 0x1f, 0xb1, 0x78, 0x83, 0xcd, 0x1a, 0x2c, 0x72, 0x40,
+    0xba, 0x66, 0x6c, 0x13, 0x20, 0xf4, 0x24, 0xf7, 0x33, 0x8c, 0xef, 0xf5, 0x25, 0xc0, 0xd1, 0xc9,
+    0xb8, 0xb9, 0x06, 0xb2, 0xec, 0xe5, 0x15, 0xe5, 0x11, 0xd0, 0x5f, 0x8e, 0x9a, 0x4d, 0x87, 0x79,
+    0xee, 0x6c, 0x9e, 0x8e, 0xed, 0x25, 0x38, 0x2d, 0x36, 0x42, 0x95, 0xd0, 0xbc, 0x12, 0x34, 0x70,
+    0x11, 0x50, 0x70, 0x4d, 0x78, 0x68, 0xe6, 0x7e, 0xfe, 0x64, 0xc2, 0x13, 0x3d, 0x13, 0xe8, 0x11,
+    0x20, 0x7b, 0x2c, 0xbe, 0x9c, 0x5c, 0x69, 0x8f, 0x9f, 0xd4, 0x12, 0x71, 0x69, 0x09, 0x08, 0x67,
+    0x53, 0xa4, 0xc2, 0x02, 0x17, 0xb0, 0x17, 0x6c, 0x67, 0x97, 0x1d, 0x04, 0x60, 0x2a, 0x33, 0xfb,
+    0xdd, 0x7c, 0x0a, 0x0c, 0xe5, 0xbe, 0xdd, 0xff, 0xfb, 0xeb, 0xf3, 0xfd, 0xa3, 0xc3, 0xeb, 0xe3,
+    0x77, 0x17, 0x87, 0xaf, 0x0f, 0xdf, 0x3b, 0xec, 0xab, 0xaf, 0x60, 0xf4, 0xde, 0x2e, 0x6b, 0xde,
+    0x33, 0xd0, 0x61, 0x2f, 0x98, 0xe8, 0xb3, 0x17, 0x0e, 0xeb, 0xb2, 0x85, 0x49, 0x28, 0x8e, 0xcb,
+    0xda, 0xc0, 0x26, 0x43, 0xa7, 0xd8, 0x1c, 0xba, 0x19, 0x43, 0xbb, 0x4a, 0xe7, 0x45, 0x8e, 0x76,
+    0xce, 0x43, 0x62, 0x6b, 0x1a, 0x0b, 0x0b, 0xc0, 0x7d, 0x3c, 0x52, 0x34, 0xae, 0x74, 0x88, 0xf6,
+    0x6c, 0x73, 0xd3, 0x29, 0x74, 0x3b, 0x0a, 0x61, 0x9f, 0xed, 0xb0, 0xd6, 0xcd, 0xf3, 0x96, 0xd2,
+    0x60, 0xac, 0x5f, 0xd7, 0xff, 0x6d, 0xd1, 0x2f, 0x4f, 0x01, 0x3a, 0xbe, 0x62, 0xed, 0xa7, 0xb5,
+    0xd0, 0xbc, 0x62, 0x34, 0x71, 0xc0, 0xba, 0xb1, 0x03, 0x0d, 0x32, 0x30, 0x24, 0x0d, 0xdd, 0x6e,
+    0x57, 0x86, 0x02, 0x81, 0x5b, 0x37, 0x5c, 0xc3, 0x92, 0x35, 0x59, 0xe7, 0xe9, 0x33, 0xcd, 0x9e,
+    0x2d, 0x03, 0xd4, 0x4b, 0x76, 0x5f, 0xa7, 0x01, 0xd1, 0xc1, 0x03, 0xc9, 0xc6, 0x75, 0xba, 0x6a,
+    0x6e, 0x34, 0x0f, 0xc3, 0x5e, 0xed, 0x98, 0x4e, 0x3e, 0x66, 0x08, 0x3a, 0x9a, 0xd7, 0x0f, 0xda,
+    0xce, 0x07, 0x09, 0xcf, 0xa3, 0x6e, 0x8c, 0xd7, 0x2d, 0x08, 0xc0, 0x53, 0xfb, 0x49, 0x83, 0xd9,
+    0x74, 0xac, 0x74, 0x14, 0x47, 0x61, 0xec, 0x65, 0xdb, 0x1d, 0x7b, 0xe6, 0x38, 0xf5, 0xb3, 0xfb,
+    0xe6, 0xec, 0xe7, 0xd5, 0xd9, 0xcf, 0x9e, 0xac, 0x9e, 0x3d, 0x30, 0x67, 0xb7, 0x8d, 0xd9, 0x92,
+    0x0d, 0x56, 0xcd, 0xf5, 0xcd, 0xb9, 0x9d, 0xca, 0xdc, 0xf6, 0xb3, 0xd5, 0x93, 0xf9, 0xba, 0x4d,
+    0xe3, 0xe4, 0x75, 0x7b, 0x1e, 0xae, 0xd8, 0x33, 0x49, 0xa4, 0x4d, 0x20, 0x40, 0xc0, 0x10, 0x8a,
+    0xd8, 0x7b, 0x3d, 0x18, 0xbf, 0xb5, 0x6e, 0xf3, 0xc7, 0xeb, 0xf6, 0xee, 0xb7, 0xd7, 0xed, 0xfd,
+    0x78, 0xed, 0xd6, 0xfd, 0xce, 0xba, 0xad, 0x1f, 0xaf, 0xdd, 0xb9, 0xbf, 0xfd, 0xa0, 0x9d, 0x1f,
+    0xdf, 0xb3, 0xf1, 0x6f, 0xbb, 0x86, 0x18, 0xad, 0x3b, 0xfa, 0x15, 0x10, 0xbc, 0x1a, 0x08, 0xab,
+    0x18, 0x60, 0x05, 0x08, 0x9d, 0xf5, 0x50, 0xee, 0x1f, 0x0a, 0x43, 0x4f, 0x0a, 0x27, 0xf1, 0x92,
+    0xcc, 0xd8, 0x61, 0x92, 0xc4, 0x89, 0x6d, 0xe9, 0x86, 0xb6, 0x75, 0x83, 0x46, 0xbf, 0xef, 0x66,
+    0xf1, 0x79, 0x96, 0x04, 0xd1, 0xc8, 0x6e, 0x3f, 0x73, 0xc8, 0xec, 0xe7, 0x09, 0xa2, 0xdc, 0xa0,
+    0x3f, 0x2a, 0x5c, 0x37, 0xa5, 0xf5, 0xa5, 0xe5, 0x3e, 0x1f, 0x8c, 0xc3, 0xcf, 0xbf, 0xa6, 0x29,
+    0x0f, 0xd9, 0x52, 0x59, 0xe4, 0xeb, 0xb7, 0x67, 0xd7, 0xae, 0xeb, 0x62, 0xa2, 0x85, 0x9e, 0xdd,
+    0x71, 0x0f, 0x1c, 0xcd, 0x8c, 0xb5, 0x41, 0x7b, 0xea, 0x3e, 0x63, 0x83, 0x75, 0xa0, 0xa5, 0xf0,
+    0x25, 0x1a, 0x2c, 0x25, 0x2d, 0x4b, 0x6e, 0x87, 0x37, 0x12, 0x31, 0xd1, 0xec, 0x5c, 0xfa, 0x97,
+    0x68, 0x98, 0x1a, 0xf0, 0xac, 0xf9, 0x1e, 0xaa, 0x09, 0x62, 0x8e, 0xc8, 0x17, 0x96, 0xeb, 0x91,
+    0xee, 0x07, 0x14, 0x8e, 0x93, 0xe9, 0x0b, 0x48, 0x7f, 0x8f, 0x80, 0x96, 0xbc, 0x05, 0xb1, 0xe1,
+    0xaa, 0x9b, 0x07, 0x0e, 0x1c, 0x58, 0x1c, 0x31, 0xa9, 0xcb, 0x2e, 0xe9, 0xc3, 0x95, 0x93, 0xbb,
+    0x7a, 0x9c, 0xac, 0x8c, 0xa1, 0x65, 0xf9, 0x65, 0x0b, 0x8c, 0x24, 0xf8, 0x61, 0x6d, 0xa7, 0xd8,
+    0xc5, 0x25, 0xbf, 0x6c, 0x5f, 0xa1, 0xed, 0xd4, 0x34, 0x5d, 0xee, 0xc1, 0xe5, 0x33, 0x3a, 0x4e,
+    0x79, 0x9f, 0x75, 0xc3, 0xcb, 0x3e, 0xb3, 0xe9, 0x65, 0x4d, 0x67, 0x92, 0x8c, 0x36, 0x57, 0xbc,
+    0xf1, 0x29, 0x3f, 0x35, 0xd9, 0x85, 0x27, 0x04, 0x7e, 0x14, 0x1c, 0x5e, 0x5f, 0x38, 0x56, 0x74,
+    0x86, 0x10, 0xe6, 0x08, 0x7f, 0x5a, 0x8d, 0xea, 0x23, 0x77, 0xe0, 0x35, 0xc4, 0x90, 0x8f, 0x43,
+    0xca, 0x34, 0xff, 0x30, 0xc7, 0x08, 0xc2, 0x4f, 0x91, 0x17, 0x38, 0xf8, 0xe2, 0x21, 0x92, 0x65,
+    0x11, 0x4f, 0xe1, 0x7f, 0x82, 0xab, 0xe7, 0x0b, 0x80, 0xaf, 0x99, 0xf1, 0x44, 0x3f, 0x93, 0x02,
+    0x2b, 0x49, 0xaf, 0xcb, 0x67, 0x0d, 0xf6, 0x4d, 0x83, 0x7d, 0xdb, 0x60, 0xed, 0xce, 0x55, 0x4e,
+    0xd0, 0x89, 0x30, 0xdb, 0x82, 0x2c, 0xe0, 0x6d, 0x94, 0x1c, 0x5a, 0x79, 0xe6, 0xc2, 0x0f, 0xc1,
+    0x01, 0x3d, 0xda, 0x9d, 0x3a, 0xdc, 0x94, 0x0e, 0xd6, 0xa4, 0xf9, 0x2f, 0xbf, 0x00, 0x3c, 0xd0,
+    0x2c, 0xad, 0x06, 0x03, 0x1d, 0x61, 0xbd, 0xb0, 0x1a, 0xec, 0x89, 0xfc, 0xfb, 0x14, 0xfe, 0xc2,
+    0x9f, 0x67, 0x78, 0x6d, 0xf3, 0xa9, 0x80, 0xb2, 0x20, 0xd8, 0x4f, 0xae, 0x8a, 0x16, 0xdc, 0xaf,
+    0xf0, 0x67, 0x00, 0x1d, 0x34, 0x7c, 0x08, 0x55, 0x3c, 0xe5, 0xc8, 0x01, 0x9b, 0x58, 0x16, 0xf0,
+    0x48, 0x7a, 0xf9, 0x4c, 0x9c, 0xe6, 0xb6, 0xee, 0xaa, 0x80, 0xb4, 0x1d, 0xe1, 0xad, 0x92, 0xdd,
+    0x71, 0xf4, 0x31, 0x4f, 0x60, 0x0c, 0x38, 0x48, 0x30, 0xb5, 0x8d, 0x73, 0xad, 0x96, 0x85, 0xdd,
+    0x52, 0x2e, 0x17, 0xda, 0xce, 0x46, 0x1c, 0x3c, 0xed, 0x8c, 0xb6, 0x57, 0x30, 0x08, 0xe0, 0x88,
+    0x88, 0x48, 0x7f, 0x54, 0xca, 0x69, 0xc1, 0x8d, 0xb3, 0xd1, 0x94, 0xd2, 0x70, 0xb8, 0x5e, 0xe7,
+    0xaa, 0x81, 0xcf, 0x47, 0x70, 0x20, 0xf8, 0xb8, 0x0d, 0x8f, 0xd3, 0x74, 0x84, 0x1f, 0x9f, 0xc0,
+    0xc7, 0x85, 0x97, 0xbc, 0xf3, 0xa6, 0x34, 0xf0, 0xa9, 0x78, 0xfc, 0xde, 0x0b, 0xe7, 0xf0, 0x8c,
+    0x1b, 0x6f, 0x14, 0x6a, 0x05, 0xc2, 0x4c, 0x60, 0x80, 0xe9, 0xac, 0x0b, 0xf4, 0xd9, 0xbe, 0x02,
+    0xb4, 0xa5, 0x4f, 0x0d, 0x41, 0x13, 0x3e, 0x7f, 0x8d, 0x99, 0xda, 0x16, 0xee, 0xf5, 0xf8, 0xfc,
+    0x54, 0x6e, 0xc2, 0x71, 0xd3, 0x30, 0x18, 0x70, 0x1b, 0xc8, 0xdf, 0xfe, 0xd6, 0x71, 0x13, 0x4e,
+    0x89, 0x59, 0xdb, 0xba, 0x00, 0xc2, 0x5b, 0x8c, 0xb6, 0x6b, 0x5d, 0x4e, 0x28, 0xc4, 0x06, 0x64,
+    0xb3, 0x2b, 0xab, 0x58, 0x6e, 0x4a, 0x39, 0x3e, 0x5c, 0x0b, 0xb1, 0x4f, 0xe7, 0xb3, 0x59, 0x02,
+    0x6a, 0x8c, 0xfb, 0xd8, 0xf2, 0x54, 0xec, 0x1c, 0xe2, 0x81, 0x24, 0xc6, 0xb8, 0xa5, 0x9b, 0xb3,
+    0xc6, 0xb3, 0xab, 0x02, 0xc2, 0x30, 0xbd, 0x1e, 0x26, 0x9c, 0x5f, 0x4f, 0xfa, 0x45, 0xff, 0x37,
+    0x00, 0x4b, 0xb5, 0xcf, 0x78, 0x32, 0x80, 0x60, 0xaf, 0xab, 0xc8, 0xbb, 0x07, 0x8c, 0xf0, 0x42,
+    0x1b, 0x29, 0x76, 0xc4, 0xb6, 0x54, 0x7f, 0x97, 0x35, 0xdb, 0x05, 0xf4, 0x31, 0xf7, 0x66, 0x04,
+    0x07, 0x11, 0x7a, 0x0e, 0x60, 0xa9, 0x61, 0x8a, 0xd7, 0x41, 0x0a, 0xc4, 0xb7, 0xaa, 0xb5, 0x1f,
+    0xc6, 0x83, 0x09, 0x8e, 0x6b, 0xb7, 0x70, 0x2f, 0x19, 0x28, 0xe2, 0x7c, 0x6a, 0xbb, 0x0d, 0x4d,
+    0x49, 0x9a, 0x06, 0xc5, 0x3c, 0x10, 0x89, 0x86, 0x16, 0x3b, 0xa7, 0x3c, 0x7b, 0xcf, 0xbd, 0x34,
+    0x26, 0xc8, 0xda, 0xf9, 0xe3, 0xc4, 0xf7, 0x79, 0x86, 0xac, 0xd4, 0xd9, 0x51, 0x9d, 0x2f, 0xc5,
+    0xcd, 0x96, 0xd1, 0xb9, 0x7d, 0x25, 0x54, 0x83, 0xd2, 0x0c, 0x27, 0xf1, 0xa8, 0x79, 0x21, 0x7c,
+    0xd2, 0x2e, 0xc5, 0x58, 0x21, 0x5d, 0x1e, 0x44, 0xec, 0xe4, 0xf4, 0xf5, 0xf5, 0x9b, 0xfd, 0xb3,
+    0xfd, 0x1f, 0x8e, 0x2f, 0xf6, 0x0f, 0x2f, 0xb4, 0xd0, 0x10, 0xac, 0x12, 0x4a, 0x3c, 0x28, 0x0d,
+    0x3c, 0xbc, 0x29, 0x7b, 0x1f, 0xa0, 0x26, 0x1f, 0xf1, 0x3b, 0xcc, 0x62, 0x47, 0x42, 0x68, 0x7c,
+    0x1e, 0xe5, 0x01, 0x5c, 0x8a, 0xd9, 0xd8, 0xbe, 0x97, 0x40, 0x13, 0x71, 0x65, 0xe4, 0x92, 0x1d,
+    0x99, 0xe1, 0x70, 0x88, 0xba, 0xf0, 0xda, 0x0e, 0x19, 0x80, 0xfd, 0xc4, 0x21, 0x58, 0x08, 0x7d,
+    0xd6, 0x0f, 0x79, 0xd0, 0xc7, 0x88, 0x3f, 0xc4, 0x11, 0x0d, 0xc6, 0x47, 0x9e, 0xb0, 0x35, 0x18,
+    0x76, 0x72, 0x02, 0x79, 0x8e, 0x5a, 0x86, 0xc5, 0xa0, 0xc0, 0x01, 0x8f, 0x34, 0x73, 0x65, 0x8a,
+    0xb3, 0x84, 0xf2, 0x2e, 0x7b, 0x9a, 0xe7, 0x2a, 0xc3, 0x78, 0x84, 0x78, 0xca, 0x18, 0x4f, 0x68,
+    0x79, 0x73, 0x78, 0x91, 0xfd, 0x7b, 0xad, 0x44, 0xae, 0xd5, 0x63, 0x0f, 0xfa, 0x31, 0xf2, 0x15,
+    0x29, 0xee, 0xc5, 0x07, 0xba, 0x9c, 0x78, 0x48, 0x05, 0x0c, 0x2c, 0x09, 0xdd, 0x5e, 0xae, 0x23,
+    0xa3, 0x84, 0x68, 0x48, 0x17, 0x13, 0x12, 0xaf, 0x4b, 0x68, 0xfb, 0xb2, 0x84, 0xff, 0x95, 0xc8,
+    0xf6, 0x25, 0x1c, 0xed, 0x94, 0x44, 0x5c, 0x7a, 0xaf, 0xf5, 0xf8, 0xeb, 0xf8, 0x80, 0xfe, 0x99,
+    0xf2, 0x44, 0x2c, 0x9f, 0xe3, 0x26, 0x82, 0xe8, 0xbb, 0xf9, 0x94, 0x1d, 0x89, 0x6a, 0x82, 0x99,
+    0x07, 0x62, 0x05, 0x41, 0x13, 0x07, 0x7a, 0x83, 0xcb, 0x1e, 0xa6, 0x94, 0x5b, 0x41, 0x84, 0xf4,
+    0xb5, 0x0b, 0x7a, 0x34, 0x54, 0xd3, 0x89, 0xc7, 0xf1, 0x2c, 0x28, 0x24, 0xa6, 0xe8, 0xd8, 0x9b,
+    0xa7, 0xfc, 0x20, 0x40, 0x35, 0xdc, 0x6c, 0x3f, 0x9c, 0x6a, 0x18, 0x96, 0x74, 0x99, 0x34, 0x61,
+    0x0c, 0x8f, 0x77, 0xec, 0xa1, 0x69, 0x69, 0x60, 0x96, 0x21, 0xe5, 0x63, 0xa0, 0x5f, 0x0a, 0x7c,
+    0x4b, 0x68, 0x5f, 0x48, 0x42, 0x80, 0xc5, 0xc9, 0x97, 0xa3, 0xb5, 0x65, 0x65, 0xc4, 0xae, 0x0c,
+    0x4c, 0xb0, 0x89, 0x2c, 0x63, 0xf4, 0x5d, 0x0c, 0x10, 0x0a, 0x1c, 0x25, 0x7f, 0x46, 0xaf, 0x51,
+    0x13, 0x45, 0xb8, 0x1f, 0x19, 0xa5, 0xd0, 0xb1, 0x8b, 0x2b, 0x33, 0x75, 0x44, 0x0a, 0x98, 0x96,
+    0x8f, 0x2b, 0xe5, 0x51, 0xd0, 0xc9, 0x53, 0x16, 0x8d, 0x8b, 0x59, 0x85, 0xf7, 0xf1, 0xb3, 0x1a,
+    0xde, 0x15, 0x69, 0x02, 0x69, 0x88, 0x73, 0x60, 0x35, 0xf9, 0x91, 0x95, 0xa0, 0x8a, 0xa4, 0x4a,
+    0x57, 0x24, 0x6c, 0x94, 0x76, 0x07, 0x6d, 0x96, 0x5b, 0x0c, 0xd5, 0x81, 0x6a, 0xde, 0x81, 0x63,
+    0x96, 0x43, 0x73, 0xbd, 0x0d, 0x4a, 0x5f, 0x36, 0x09, 0xdd, 0x8a, 0x3a, 0xd4, 0x6a, 0x6a, 0x2a,
+    0x37, 0x32, 0x41, 0x81, 0x89, 0x00, 0x30, 0x0b, 0xb3, 0x51, 0x1a, 0x0b, 0xe8, 0x58, 0x56, 0x3a,
+    0xc8, 0x6c, 0x38, 0xb9, 0xd7, 0x21, 0xad, 0x97, 0x49, 0x52, 0x1c, 0x4b, 0x19, 0x45, 0x91, 0x32,
+    0x26, 0xc9, 0x27, 0x3d, 0xd5, 0x14, 0x97, 0xf7, 0xa8, 0x30, 0x60, 0xff, 0x53, 0x10, 0x77, 0xa5,
+    0x0b, 0xa0, 0xf3, 0x8e, 0x47, 0x06, 0xed, 0x2a, 0x14, 0xe2, 0xba, 0x97, 0x17, 0x21, 0x23, 0xe4,
+    0x32, 0xbc, 0xb9, 0x29, 0x51, 0x59, 0x23, 0x65, 0x85, 0xb3, 0x85, 0xb9, 0x4e, 0xc1, 0x64, 0x0d,
+    0x94, 0x1b, 0xcd, 0xab, 0x91, 0xb5, 0x0f, 0x22, 0x29, 0x86, 0xf7, 0x4b, 0x28, 0x30, 0x6c, 0x39,
+    0x07, 0x3d, 0xd7, 0x40, 0x2e, 0x0a, 0xc9, 0x1b, 0x4a, 0xc0, 0x94, 0x81, 0x46, 0x03, 0xde, 0x24,
+    0x70, 0x32, 0xa5, 0x62, 0x4a, 0xcc, 0x57, 0x5f, 0x29, 0x11, 0xba, 0xb4, 0x4d, 0xf1, 0x6a, 0x9a,
+    0xb2, 0xe5, 0xd4, 0x60, 0xba, 0xb3, 0x8b, 0xfb, 0x6b, 0x96, 0xda, 0x1d, 0x73, 0x62, 0xb3, 0x59,
+    0x24, 0x2f, 0x51, 0xbe, 0x33, 0xf4, 0x07, 0x35, 0xe7, 0x40, 0x2d, 0x6f, 0xac, 0xbe, 0xb9, 0x59,
+    0x4b, 0x98, 0x28, 0x31, 0x13, 0x09, 0xe6, 0x5e, 0x76, 0xd6, 0x23, 0xa2, 0x88, 0x2f, 0x82, 0x09,
+    0x25, 0x7d, 0x67, 0x20, 0x7b, 0x70, 0x68, 0xb9, 0x67, 0x2a, 0x35, 0x11, 0x10, 0x8d, 0xf9, 0x82,
+    0xe2, 0x23, 0xb0, 0x46, 0x43, 0x4c, 0xe2, 0x26, 0xc0, 0x94, 0xea, 0xbe, 0x90, 0x98, 0x85, 0x92,
+    0xf3, 0x31, 0x40, 0x61, 0xaf, 0x93, 0xf8, 0xf3, 0x7f, 0x36, 0xb7, 0xde, 0x80, 0x89, 0x88, 0xf0,
+    0x40, 0xc0, 0x62, 0x50, 0x3c, 0x21, 0xae, 0x91, 0x51, 0x89, 0xfd, 0xe0, 0x8d, 0x43, 0x71, 0x89,
+    0xac, 0x4a, 0x38, 0xbc, 0x66, 0xbf, 0xe0, 0x22, 0xa1, 0x34, 0x44, 0x24, 0xa0, 0xf3, 0xcf, 0x50,
+    0xad, 0xb7, 0xe6, 0x6e, 0xc5, 0xbc, 0x0a, 0xdf, 0x70, 0x80, 0xff, 0x81, 0xf9, 0x5d, 0x10, 0x88,
+    0xa9, 0x8d, 0x3e, 0xd0, 0x49, 0x0c, 0x16, 0xf0, 0x25, 0xc4, 0x74, 0x7a, 0xfe, 0x50, 0xa6, 0x0b,
+    0xef, 0x01, 0x8a, 0x3b, 0x7c, 0x20, 0x40, 0xd2, 0x21, 0xf7, 0x43, 0x24, 0x8a, 0x94, 0x41, 0x4e,
+    0x31, 0xa3, 0x6c, 0x6f, 0xfd, 0x83, 0xfd, 0xa3, 0xbf, 0xe9, 0xd8, 0x2f, 0xba, 0x3f, 0xa6, 0x5f,
+    0x37, 0xe1, 0x3f, 0x3d, 0x3a, 0x2f, 0xfe, 0x6e, 0x4b, 0xcb, 0x7f, 0x3f, 0xce, 0x29, 0x02, 0xac,
+    0xfb, 0x98, 0x76, 0x81, 0x1f, 0x68, 0x75, 0xa7, 0x9a, 0x12, 0x52, 0xbe, 0x68, 0x4e, 0xc8, 0x06,
+    0xed, 0x1c, 0x74, 0x09, 0xfa, 0x30, 0x02, 0xe7, 0x17, 0x6c, 0x93, 0x3e, 0x80, 0x17, 0x83, 0x8e,
+    0xd5, 0x71, 0x04, 0x6e, 0x74, 0x90, 0xdd, 0x36, 0x58, 0x1f, 0x15, 0x66, 0x3e, 0x46, 0xa4, 0xd3,
+    0xc1, 0x9b, 0x41, 0x65, 0xa5, 0x26, 0xa0, 0xdb, 0xa8, 0x26, 0x48, 0x27, 0x26, 0x3f, 0x53, 0xc5,
+    0xed, 0xda, 0x3d, 0xd4, 0x63, 0x69, 0x1c, 0x00, 0x02, 0x57, 0x95, 0x49, 0x4e, 0x35, 0xff, 0x84,
+    0x43, 0xc5, 0x48, 0xd7, 0xd8, 0x2e, 0x77, 0x87, 0x26, 0xf9, 0xdd, 0x20, 0x1a, 0x84, 0x73, 0x1f,
+    0xc2, 0xf2, 0xd2, 0x70, 0xc7, 0xa9, 0x49, 0x7d, 0x51, 0x30, 0xe3, 0xde, 0x81, 0xa0, 0xc8, 0xd1,
+    0x40, 0x04, 0x81, 0xca, 0x1d, 0x78, 0x9c, 0xb2, 0xad, 0xaf, 0x61, 0xa4, 0xcd, 0x95, 0x2d, 0x72,
+    0x03, 0x2e, 0x11, 0x1e, 0xa6, 0x02, 0xbc, 0x08, 0x63, 0xf6, 0x1f, 0xe7, 0x78, 0x6f, 0x8b, 0xf1,
+    0x3c, 0x77, 0x17, 0xe5, 0x86, 0xa5, 0x73, 0x0f, 0xd6, 0x64, 0xbc, 0x94, 0x04, 0x62, 0x45, 0x43,
+    0x22, 0xe5, 0xb0, 0x9b, 0x9b, 0x59, 0x21, 0x90, 0xc2, 0xbb, 0xc3, 0x0b, 0x4e, 0xd6, 0x07, 0x4b,
+    0x12, 0xd0, 0x55, 0x0c, 0x8a, 0x22, 0xf8, 0x63, 0x28, 0x5b, 0x78, 0xfd, 0x43, 0xbe, 0x9e, 0xb8,
+    0xdb, 0x8c, 0x0a, 0x5f, 0x23, 0x02, 0x73, 0x3e, 0x44, 0x8b, 0x1e, 0x95, 0x85, 0x6e, 0x1f, 0x4e,
+    0x01, 0x6f, 0xe4, 0x72, 0xb9, 0xcb, 0x0d, 0xb8, 0x21, 0x94, 0x82, 0x0c, 0x65, 0x17, 0xa4, 0xc6,
+    0xff, 0x20, 0x10, 0xe0, 0x14, 0xd8, 0xb9, 0xfe, 0x7f, 0xeb, 0x65, 0x63, 0xe0, 0xf1, 0x1b, 0x8c,
+    0x3d, 0x0a, 0x7f, 0xae, 0xa2, 0x37, 0x7b, 0x38, 0x7a, 0xa7, 0x18, 0x81, 0xcf, 0x9b, 0x9b, 0x4e,
+    0x29, 0xac, 0x17, 0x5c, 0xb5, 0xce, 0x82, 0x38, 0x4e, 0x59, 0xa9, 0x2a, 0x05, 0xa8, 0xeb, 0xd0,
+    0x4f, 0xf7, 0xef, 0x47, 0x0c, 0x34, 0x7d, 0x29, 0x65, 0xbf, 0xc4, 0x1d, 0xb5, 0x9b, 0xd2, 0x9f,
+    0x8b, 0x58, 0xbb, 0x8e, 0xa8, 0xd5, 0xac, 0xba, 0xab, 0x61, 0xf4, 0xea, 0xc2, 0x51, 0xf2, 0x88,
+    0x1c, 0xf3, 0x06, 0xa7, 0xe4, 0x2c, 0x99, 0xd9, 0xda, 0x84, 0xff, 0x09, 0x4f, 0x7c, 0x3f, 0x0a,
+    0x40, 0x97, 0xc0, 0x3a, 0x47, 0x09, 0x78, 0x06, 0xb6, 0x9a, 0x55, 0xba, 0xed, 0xf9, 0xc8, 0x47,
+    0x10, 0x47, 0x11, 0xe6, 0x19, 0x65, 0x0d, 0xf6, 0x89, 0x35, 0x74, 0xcf, 0x4f, 0xf8, 0x7d, 0xcc,
+    0x46, 0x46, 0xd2, 0x9c, 0x69, 0x19, 0x4a, 0x88, 0xac, 0x82, 0xa8, 0x86, 0x8a, 0xe2, 0x9c, 0x09,
+    0x21, 0xe6, 0xf8, 0xfc, 0x97, 0x71, 0x98, 0x81, 0x47, 0x12, 0x93, 0x41, 0x16, 0x4c, 0x19, 0x06,
+    0x0b, 0xfe, 0xa8, 0x20, 0x99, 0xe7, 0xfb, 0x87, 0x78, 0xb3, 0x77, 0x82, 0x39, 0xb5, 0x08, 0x82,
+    0xf2, 0x0d, 0x81, 0xca, 0x86, 0x4a, 0xac, 0x15, 0x14, 0xa9, 0xa3, 0x33, 0x86, 0x86, 0xa0, 0x0b,
+    0xf2, 0x53, 0xd9, 0x61, 0x2d, 0x47, 0x3f, 0x23, 0xe3, 0x44, 0xc5, 0xbe, 0xf3, 0x8c, 0x4d, 0xed,
+    0xb9, 0x41, 0xf4, 0x6f, 0x42, 0x44, 0x2f, 0xd8, 0xa9, 0x3b, 0xf6, 0x9a, 0x93, 0xc5, 0x8b, 0xf8,
+    0xc2, 0xc3, 0x95, 0x97, 0x41, 0xec, 0xc1, 0x0e, 0xb7, 0xa0, 0xd0, 0x82, 0x27, 0x24, 0x82, 0x10,
+    0x43, 0x61, 0x1d, 0x0f, 0xa6, 0xe1, 0xd8, 0x22, 0xe0, 0xa0, 0x76, 0x31, 0xcc, 0xc2, 0x1c, 0x11,
+    0x39, 0xde, 0x79, 0xd8, 0xa6, 0x2c, 0xa8, 0x08, 0x17, 0x68, 0x7d, 0xa4, 0xf7, 0x89, 0xa8, 0xe2,
+    0xdc, 0x55, 0x95, 0x19, 0xee, 0x30, 0x48, 0x52, 0x65, 0x83, 0x5e, 0x82, 0xf7, 0xe3, 0x37, 0xe0,
+    0x98, 0xb2, 0x9a, 0x81, 0x78, 0x83, 0xad, 0x8f, 0xeb, 0x95, 0x7d, 0xe3, 0xc3, 0xe4, 0x8e, 0xcf,
+    0x47, 0x25, 0xdb, 0x9c, 0x25, 0xba, 0xb9, 0x1b, 0x24, 0xdc, 0xcb, 0xb8, 0x84, 0x62, 0x6f, 0x64,
+    0xc9, 0x86, 0x53, 0xd2, 0x05, 0x81, 0x08, 0xe1, 0x02, 0x38, 0xb2, 0x6f, 0xe0, 0x0f, 0x8a, 0x76,
+    0x96, 0xb8, 0xde, 0x6c, 0x06, 0x7b, 0xa7, 0x65, 0xed, 0x95, 0xc0, 0xfc, 0x0d, 0x95, 0x43, 0x53,
+    0x28, 0x83, 0x9f, 0xc1, 0x93, 0xec, 0x80, 0x03, 0x74, 0x0e, 0x7e, 0x90, 0xb1, 0x33, 0x27, 0x3f,
+    0x2e, 0x8c, 0x6e, 0xe9, 0x32, 0x2e, 0x53, 0x99, 0xc5, 0xdc, 0xd6, 0xd4, 0x8b, 0x65, 0xbe, 0xc1,
+    0x95, 0xd1, 0x89, 0x2e, 0xad, 0x2a, 0xa8, 0x71, 0x4a, 0x11, 0x4e, 0x89, 0x66, 0x2e, 0x44, 0xc6,
+    0xe0, 0x39, 0x7f, 0x47, 0xf5, 0xa6, 0x68, 0x35, 0x3a, 0xdb, 0x85, 0xdf, 0xd0, 0x27, 0x16, 0x33,
+    0x98, 0x0f, 0xac, 0x6d, 0xfe, 0xdc, 0xad, 0x63, 0x68, 0xba, 0x79, 0x8c, 0xee, 0xd0, 0xa5, 0x32,
+    0xb5, 0x2b, 0x02, 0x6b, 0xb2, 0x7b, 0x3c, 0x59, 0x59, 0x46, 0xa0, 0xc5, 0x6f, 0x30, 0x4d, 0xc4,
+    0xa2, 0x51, 0x0c, 0x6c, 0x15, 0x48, 0x2b, 0x23, 0x12, 0x0b, 0x45, 0x4e, 0x4f, 0x32, 0xa0, 0x5a,
+    0x72, 0x00, 0x9b, 0xd4, 0x24, 0x6a, 0x00, 0xc3, 0x23, 0xb5, 0xc7, 0x2d, 0x66, 0x50, 0x67, 0x93,
+    0x75, 0x7a, 0xba, 0x0f, 0x2e, 0x4f, 0x06, 0xfe, 0x8f, 0xb2, 0x31, 0xb0, 0x83, 0x02, 0xed, 0x94,
+    0x29, 0x57, 0x6c, 0x17, 0x1c, 0x7d, 0xba, 0x7b, 0x15, 0xbb, 0x0d, 0x22, 0x9b, 0x3e, 0x0c, 0xc3,
+    0x38, 0x4e, 0x6a, 0xc5, 0xda, 0xc4, 0xa0, 0x61, 0x50, 0x49, 0x92, 0xae, 0x59, 0xac, 0x2b, 0x17,
+    0x2a, 0xa4, 0x48, 0xc8, 0x0e, 0x71, 0xa5, 0xac, 0x28, 0x11, 0xd5, 0xc2, 0x18, 0x9d, 0x10, 0x26,
+    0x5f, 0x1b, 0x47, 0x0e, 0x06, 0x7f, 0x76, 0x63, 0x19, 0x6c, 0xa7, 0x12, 0xa9, 0xc4, 0x9c, 0x81,
+    0x63, 0xe6, 0xa7, 0xd5, 0x85, 0xae, 0x80, 0xb5, 0xc9, 0x82, 0xde, 0xbd, 0xaa, 0x62, 0xd2, 0xcc,
+    0xb8, 0xf4, 0xa7, 0xd1, 0x6d, 0x21, 0x05, 0xbb, 0x0b, 0xad, 0xd2, 0xd4, 0x27, 0xea, 0x40, 0x8d,
+    0x35, 0x90, 0x62, 0x13, 0x20, 0xb0, 0xdc, 0xf1, 0x8b, 0x3c, 0xf2, 0xca, 0x83, 0x1e, 0xc1, 0x31,
+    0x6d, 0xf8, 0x3f, 0xa9, 0x0b, 0x71, 0xaa, 0x2d, 0xdd, 0xd2, 0x85, 0x23, 0x88, 0xb0, 0x20, 0x90,
+    0x2c, 0xc8, 0xc6, 0x5d, 0xa9, 0x14, 0xac, 0x85, 0xb5, 0xd9, 0x96, 0x19, 0xb3, 0x28, 0x61, 0x39,
+    0x9a, 0x53, 0x72, 0x98, 0xc8, 0x03, 0x51, 0xdb, 0x44, 0xcb, 0x91, 0xe3, 0x5f, 0x4d, 0x9c, 0xd7,
+    0x9c, 0x45, 0xed, 0xa9, 0x0a, 0xa2, 0x6a, 0xa7, 0xbb, 0xe2, 0xb0, 0x72, 0xde, 0x0a, 0x44, 0x79,
+    0x59, 0xe1, 0x9a, 0xec, 0x95, 0x53, 0x57, 0xb0, 0x1f, 0x49, 0x67, 0x2a, 0xd4, 0x28, 0xf5, 0xe2,
+    0x9d, 0x0d, 0x9e, 0x09, 0x76, 0x15, 0x40, 0x8c, 0x02, 0x8e, 0x08, 0xc9, 0xb1, 0xa2, 0xcf, 0x2a,
+    0x3b, 0xbd, 0x8e, 0xc0, 0x68, 0x73, 0x97, 0x51, 0x6e, 0x76, 0xb3, 0xe4, 0x65, 0xe1, 0x64, 0xa1,
+    0xfa, 0xb5, 0xdc, 0x91, 0xa5, 0x47, 0x99, 0x86, 0x21, 0xcb, 0x61, 0xb1, 0x5f, 0xd8, 0x6f, 0x7f,
+    0xfe, 0xab, 0x91, 0xd6, 0x41, 0xe0, 0x15, 0x6d, 0xa1, 0xe6, 0x8b, 0xcb, 0x28, 0xdc, 0xb7, 0x95,
+    0xeb, 0x5e, 0x2c, 0xb3, 0x23, 0x77, 0xf5, 0x65, 0x8c, 0x07, 0x84, 0x67, 0x80, 0xf0, 0x45, 0x7f,
+    0x51, 0x51, 0x57, 0x61, 0x89, 0xb2, 0x7e, 0xb3, 0x82, 0x28, 0x0c, 0x80, 0x37, 0x4a, 0x4c, 0x42,
+    0x46, 0xda, 0xc8, 0x53, 0x38, 0xb2, 0xb4, 0x2b, 0xcf, 0xce, 0x94, 0xba, 0x57, 0xe4, 0x36, 0x04,
+    0x8f, 0x56, 0x72, 0x3c, 0x15, 0xa6, 0xd3, 0xcd, 0x99, 0x4f, 0xde, 0x83, 0x3b, 0x40, 0x46, 0x03,
+    0x33, 0xab, 0x1c, 0x5e, 0x97, 0x6a, 0x40, 0x31, 0xd3, 0x42, 0xc2, 0xf4, 0x25, 0xeb, 0x20, 0xfe,
+    0x22, 0x05, 0x41, 0xf8, 0x5b, 0x7a, 0x74, 0x91, 0x07, 0x35, 0x5a, 0x84, 0xef, 0x5f, 0xb6, 0xae,
+    0xb0, 0x22, 0xed, 0x1c, 0x2b, 0x92, 0x77, 0xc1, 0xf8, 0x95, 0xbb, 0xb4, 0x05, 0x2c, 0x09, 0xc0,
+    0x2a, 0x0f, 0x32, 0x89, 0x9e, 0x2f, 0x54, 0x0c, 0x33, 0xec, 0x6c, 0xbb, 0x64, 0x67, 0xfd, 0xcb,
+    0xe0, 0xaa, 0x72, 0x28, 0x65, 0xf1, 0xac, 0xd6, 0x86, 0x95, 0x51, 0x97, 0x8e, 0x50, 0x0d, 0xda,
+    0x12, 0xcc, 0x25, 0xc4, 0x52, 0x40, 0x5a, 0x77, 0x88, 0xbf, 0x7c, 0xfc, 0x35, 0xc5, 0x5f, 0x98,
+    0xd3, 0x74, 0x17, 0xf8, 0x6b, 0x79, 0xa5, 0x69, 0x46, 0x8a, 0x44, 0xcb, 0xba, 0x71, 0x05, 0xae,
+    0x26, 0x41, 0x82, 0x32, 0x41, 0xf0, 0xa9, 0x32, 0x42, 0xd6, 0xf8, 0x15, 0x7d, 0xe5, 0xc4, 0x5f,
+    0x89, 0xb7, 0xf4, 0xcc, 0x5f, 0x5e, 0xd2, 0x55, 0xdc, 0x5d, 0x98, 0x97, 0x60, 0xe8, 0x33, 0x1a,
+    0x03, 0xe4, 0x25, 0xc6, 0x3d, 0xa3, 0x26, 0x7d, 0x29, 0x97, 0xa6, 0x35, 0xc8, 0xd6, 0x15, 0x61,
+    0xb2, 0x23, 0x70, 0xf8, 0x30, 0x71, 0x2d, 0x93, 0xf4, 0xdd, 0xa2, 0x5c, 0x4c, 0x03, 0x8b, 0xd2,
+    0x3a, 0x39, 0x60, 0x76, 0xa5, 0x4f, 0x22, 0x96, 0x5f, 0x7d, 0xb5, 0x49, 0xb2, 0xbf, 0x74, 0x4a,
+    0x9a, 0x99, 0xe6, 0xe4, 0x77, 0x29, 0xe5, 0x1b, 0x3f, 0x42, 0x50, 0xaa, 0x91, 0xef, 0x60, 0x90,
+    0xc0, 0x81, 0x14, 0x30, 0xbd, 0x34, 0x53, 0x9e, 0xbe, 0xc5, 0xda, 0xad, 0xce, 0x13, 0x27, 0xc7,
+    0x0a, 0x6c, 0xb6, 0xbb, 0x7a, 0x0a, 0xf4, 0x96, 0x66, 0xd4, 0x62, 0x87, 0x97, 0x33, 0x26, 0x2a,
+    0x1f, 0x4f, 0xf6, 0xdf, 0x69, 0xe4, 0xc0, 0x01, 0x04, 0xc0, 0x3f, 0x98, 0xd6, 0x96, 0x87, 0xea,
+    0x55, 0xa5, 0x1a, 0x5f, 0x3c, 0x32, 0xcf, 0x5c, 0xbb, 0xe9, 0x59, 0x71, 0x9c, 0xfa, 0x88, 0x3d,
+    0xf3, 0x38, 0x55, 0xed, 0x15, 0x4c, 0x92, 0x0b, 0xd1, 0x8c, 0xe2, 0x7e, 0x08, 0x5d, 0x40, 0x7a,
+    0x4d, 0x71, 0x96, 0x20, 0x8c, 0x1c, 0x50, 0x65, 0x6d, 0xad, 0xa6, 0x40, 0x00, 0x55, 0x65, 0xad,
+    0x05, 0x40, 0xba, 0x53, 0xa2, 0xf4, 0x31, 0xbe, 0x30, 0x65, 0x08, 0xb3, 0x28, 0xed, 0x36, 0xeb,
+    0x68, 0x4b, 0xaf, 0xa2, 0x20, 0xdd, 0x72, 0x44, 0x6b, 0xe6, 0x9a, 0xc5, 0xb4, 0xf4, 0xd7, 0x0c,
+    0x25, 0x81, 0x55, 0x43, 0x08, 0x03, 0xe9, 0x5e, 0x43, 0xd4, 0x1e, 0x7c, 0xdc, 0xbf, 0x78, 0xf9,
+    0x5d, 0x53, 0xd5, 0xf4, 0x47, 0x5d, 0xcc, 0x1d, 0xab, 0x27, 0xe3, 0x42, 0x8b, 0x06, 0x5e, 0x9f,
+    0x7d, 0x78, 0xf7, 0xe6, 0xe2, 0x90, 0xde, 0xfd, 0x00, 0x85, 0xfc, 0x13, 0x84, 0x43, 0xec, 0xcd,
+    0x1c, 0x22, 0x22, 0x0c, 0x2e, 0x59, 0x30, 0xc6, 0x70, 0x87, 0x64, 0x53, 0x0b, 0x7b, 0xd2, 0x89,
+    0x07, 0xbe, 0x66, 0x92, 0xa9, 0x42, 0x7a, 0x1d, 0xce, 0x2e, 0x7b, 0x86, 0x57, 0x4c, 0x7a, 0xcf,
+    0xd1, 0xfe, 0xfb, 0x83, 0xc3, 0x77, 0x18, 0x9a, 0x89, 0x42, 0xe5, 0x06, 0x16, 0x05, 0xcb, 0xbf,
+    0xad, 0xe1, 0x50, 0x3c, 0xb7, 0xe4, 0xdf, 0xe7, 0xa2, 0xfd, 0xb9, 0x27, 0x9f, 0x55, 0xff, 0xd3,
+    0xa7, 0xd6, 0x95, 0xb8, 0x99, 0xa0, 0xea, 0xcf, 0xf7, 0x3c, 0x18, 0xcb, 0x92, 0x08, 0xad, 0xb5,
+    0x12, 0x2b, 0x14, 0x8a, 0xa6, 0x54, 0x47, 0x4a, 0xf5, 0x24, 0xb9, 0xf1, 0xc1, 0x87, 0x5c, 0x2b,
+    0x2e, 0xab, 0x9e, 0x22, 0xd2, 0x5e, 0x5b, 0xf6, 0x72, 0xe9, 0x46, 0xa0, 0x75, 0x29, 0x0f, 0x67,
+    0xd7, 0xb5, 0x03, 0x5a, 0x0c, 0x0e, 0xf7, 0xf2, 0x8a, 0xae, 0x0c, 0x2e, 0xaf, 0x72, 0xa7, 0x8a,
+    0x5c, 0x70, 0x37, 0xe5, 0x23, 0x0c, 0xab, 0xd2, 0x7c, 0xc9, 0xd4, 0x5c, 0x92, 0x04, 0xe6, 0x52,
+    0xab, 0x05, 0xb0, 0x17, 0x55, 0x2d, 0x6d, 0xe8, 0x2e, 0x58, 0x31, 0xc5, 0xda, 0x09, 0x70, 0x64,
+    0xc1, 0xd7, 0x4a, 0x2f, 0xdb, 0x57, 0xbd, 0xca, 0x40, 0x94, 0xad, 0xc4, 0xcd, 0x94, 0xd3, 0x8f,
+    0x89, 0x77, 0x4c, 0xa0, 0x43, 0xd3, 0xa5, 0xd6, 0x0c, 0xae, 0xe8, 0x55, 0x5e, 0x7d, 0x8c, 0x6e,
+    0x6f, 0x3a, 0x18, 0xc7, 0x11, 0x65, 0xbf, 0xb6, 0xc4, 0x8b, 0x08, 0xb4, 0x61, 0xf7, 0x27, 0x94,
+    0x3b, 0x59, 0x25, 0x53, 0x59, 0x0a, 0xe1, 0x89, 0xa8, 0xcf, 0xe9, 0xd5, 0x74, 0x2e, 0x44, 0xe7,
+    0xa2, 0xd4, 0xa9, 0x13, 0xe9, 0x53, 0xa9, 0x62, 0x4f, 0xc3, 0x70, 0xcf, 0x60, 0xb8, 0x72, 0x79,
+    0x1e, 0x0e, 0x04, 0x93, 0x25, 0x2f, 0xda, 0x8d, 0x8d, 0x19, 0xd3, 0x7a, 0x8f, 0xca, 0x38, 0xe9,
+    0xb3, 0x16, 0xf7, 0xce, 0xfa, 0x64, 0x38, 0xcb, 0x14, 0x8f, 0xea, 0x2c, 0x58, 0x29, 0x61, 0xfe,
+    0x7d, 0x79, 0x23, 0x9a, 0xf2, 0x43, 0x4d, 0xf2, 0xc8, 0xe4, 0xe7, 0x1f, 0xca, 0x41, 0x73, 0xbd,
+    0x14, 0xe4, 0x77, 0x41, 0xde, 0x94, 0x64, 0xe6, 0xb4, 0xff, 0x13, 0x1f, 0x64, 0xee, 0x84, 0xdf,
+    0xa6, 0x3a, 0xfb, 0x3a, 0xae, 0xf0, 0x7e, 0x6d, 0x2a, 0x87, 0xd5, 0xf9, 0x3a, 0xba, 0xca, 0xe9,
+    0xa8, 0x6f, 0x98, 0xe0, 0xa9, 0x76, 0xc3, 0x79, 0x59, 0x99, 0x83, 0xd7, 0x5f, 0xf0, 0xda, 0x70,
+    0xaa, 0x4e, 0x06, 0x55, 0x07, 0x58, 0x05, 0xca, 0xf2, 0xc5, 0xaf, 0xdd, 0x7b, 0x20, 0xd2, 0xfb,
+    0x60, 0x2a, 0xdf, 0x21, 0xe6, 0xb8, 0xf4, 0xaa, 0x29, 0x2a, 0x4d, 0xf1, 0x28, 0xc2, 0xe3, 0x8f,
+    0xd8, 0x68, 0x0c, 0xcb, 0x43, 0x19, 0x63, 0x9c, 0x08, 0xa3, 0x35, 0x3c, 0xb2, 0x9b, 0x62, 0xc8,
+    0x88, 0x0b, 0xbf, 0xe7, 0x26, 0xb3, 0x37, 0x3a, 0x7e, 0xbe, 0x6c, 0x76, 0x03, 0x93, 0xb9, 0x97,
+    0xbc, 0x07, 0xe2, 0x22, 0x1b, 0xc1, 0x3f, 0x1d, 0x95, 0x86, 0xb9, 0xa2, 0x7e, 0x15, 0xf2, 0xd6,
+    0xbb, 0xd1, 0x63, 0x29, 0xd7, 0x75, 0x05, 0x69, 0xa7, 0xde, 0xac, 0xfe, 0x30, 0x2e, 0x57, 0x9c,
+    0x8e, 0x10, 0x5f, 0x03, 0x74, 0x10, 0xe9, 0x41, 0xfb, 0x03, 0x40, 0xb7, 0x0c, 0x00, 0xfd, 0x84,
+    0x4a, 0x0b, 0x34, 0xec, 0x08, 0xdb, 0x26, 0x41, 0x6e, 0xb0, 0xb6, 0x36, 0x34, 0x94, 0x6f, 0xe1,
+    0x16, 0xbe, 0xa2, 0x58, 0x2a, 0xd7, 0x62, 0xf8, 0x48, 0x3e, 0xff, 0xbd, 0x0a, 0x96, 0xd4, 0x68,
+    0xcf, 0x18, 0x22, 0x2a, 0xad, 0x76, 0x49, 0x38, 0x25, 0x9f, 0x52, 0x55, 0xf5, 0x82, 0xfc, 0x03,
+    0x0c, 0x37, 0x1c, 0x73, 0xc2, 0xb4, 0xb2, 0x73, 0x02, 0xe1, 0x34, 0xd8, 0xb4, 0x42, 0x6e, 0xd1,
+    0x63, 0xce, 0xc7, 0x77, 0xcc, 0x22, 0x5c, 0x71, 0x4a, 0xfb, 0x45, 0x70, 0xa0, 0xef, 0xdb, 0xe6,
+    0xa0, 0xa1, 0x97, 0xf4, 0x71, 0x8c, 0x6e, 0xe9, 0x2e, 0x31, 0x46, 0xd1, 0x1b, 0xe4, 0xe1, 0x68,
+    0x1b, 0x42, 0x5e, 0x49, 0xb3, 0x24, 0x9e, 0xf0, 0x73, 0x94, 0x00, 0x12, 0x55, 0x00, 0x64, 0x0e,
+    0xe8, 0xf3, 0x51, 0x10, 0x9d, 0x01, 0x96, 0xb6, 0x86, 0x19, 0x6a, 0xb4, 0xc2, 0x7f, 0xaf, 0x37,
+    0x0b, 0x42, 0x61, 0x2e, 0xc0, 0x03, 0xcf, 0xcb, 0xb4, 0x4c, 0xf1, 0xd4, 0x77, 0x80, 0xa4, 0xb0,
+    0x33, 0x79, 0xa0, 0x0e, 0xf8, 0x80, 0xf2, 0xc4, 0xbf, 0x66, 0xb6, 0x21, 0x48, 0x4d, 0xd6, 0x76,
+    0xaa, 0xb3, 0x6f, 0x0b, 0xa9, 0x90, 0x82, 0xd4, 0x64, 0x4f, 0x31, 0x03, 0x26, 0xd7, 0x27, 0xba,
+    0x21, 0x54, 0x49, 0xcd, 0x02, 0x6a, 0x3e, 0xbc, 0xdd, 0x2a, 0xc1, 0x0d, 0x20, 0xbc, 0xc3, 0xfd,
+    0x63, 0x7c, 0x7a, 0x11, 0xdb, 0x37, 0x0d, 0x76, 0x8b, 0xb7, 0x5c, 0xd8, 0x34, 0x8d, 0x17, 0x79,
+    0x53, 0xbd, 0xb1, 0x28, 0x28, 0x6b, 0x1b, 0xe7, 0x29, 0x58, 0x13, 0x7d, 0x56, 0xf1, 0x5e, 0x2a,
+    0x69, 0x9e, 0xdd, 0x0d, 0xf1, 0xae, 0x3b, 0x7a, 0x61, 0xe2, 0x24, 0xc1, 0x73, 0xdd, 0xd8, 0xc3,
+    0x47, 0xe4, 0x40, 0xf2, 0x63, 0x77, 0xc9, 0x47, 0xc3, 0xed, 0x18, 0x66, 0xa1, 0x7d, 0x45, 0xbd,
+    0xe4, 0xeb, 0x23, 0x6b, 0xe0, 0xc3, 0x6f, 0xff, 0xf8, 0xdf, 0x34, 0x18, 0x19, 0x06, 0x9e, 0x1d,
+    0xf9, 0xba, 0xab, 0x65, 0x26, 0x56, 0xd6, 0x6b, 0x32, 0xf9, 0xca, 0xea, 0x86, 0x23, 0xdc, 0xc6,
+    0xef, 0x2e, 0xde, 0x9e, 0x60, 0x66, 0x44, 0xb4, 0x9a, 0xb1, 0x53, 0xad, 0x07, 0x8b, 0x6f, 0x59,
+    0x98, 0x6f, 0x7c, 0x24, 0xd4, 0x81, 0x3a, 0xb4, 0xe0, 0x92, 0x36, 0x78, 0x9e, 0x67, 0x78, 0x1f,
+    0x76, 0x1a, 0x69, 0x35, 0x0f, 0x1d, 0x68, 0x3d, 0xbc, 0x11, 0xe0, 0xb4, 0x66, 0x2c, 0x16, 0x3c,
+    0xff, 0xd8, 0x2c, 0x37, 0x63, 0xed, 0xe0, 0x99, 0x17, 0x05, 0x03, 0xad, 0x0d, 0xeb, 0x08, 0x8f,
+    0xa3, 0xac, 0xf9, 0xf1, 0xd5, 0x85, 0xd6, 0xfa, 0x0c, 0x5a, 0x2f, 0xbc, 0x74, 0x52, 0x6a, 0xfe,
+    0x06, 0x9a, 0xcd, 0x96, 0xe7, 0xd0, 0xf2, 0x8a, 0xf3, 0xd9, 0x79, 0x08, 0xbf, 0xb4, 0xf6, 0x6f,
+    0xa1, 0xfd, 0x20, 0x89, 0x97, 0x51, 0x3c, 0xd7, 0x31, 0x68, 0xb7, 0x10, 0xb3, 0x57, 0xc7, 0xa7,
+    0x7a, 0x1b, 0x6e, 0xed, 0xfd, 0xc5, 0x4b, 0xa6, 0xde, 0x62, 0xd7, 0xfb, 0x70, 0x83, 0x1f, 0xa2,
+    0x49, 0x04, 0x90, 0x84, 0x03, 0x6e, 0xa9, 0xda, 0x2f, 0x2d, 0x33, 0x2d, 0xe9, 0x75, 0x89, 0x94,
+    0x24, 0x17, 0x0f, 0xa6, 0x48, 0x47, 0x47, 0x1c, 0x37, 0x76, 0xd0, 0xf9, 0x5a, 0x95, 0x58, 0x36,
+    0xc9, 0x3e, 0xf2, 0xfe, 0x39, 0x98, 0x30, 0x5e, 0xbc, 0x3c, 0x81, 0xaf, 0x8d, 0xca, 0x6a, 0xa5,
+    0xa2, 0x73, 0x63, 0x99, 0x76, 0xb7, 0xb6, 0x36, 0x28, 0x5f, 0x35, 0x20, 0xc3, 0xef, 0x8e, 0xe3,
+    0x14, 0xf3, 0x52, 0x1b, 0x5b, 0xe0, 0x64, 0x2d, 0xd3, 0x8d, 0xe2, 0x8d, 0x9c, 0xc8, 0x85, 0x60,
+    0xd4, 0x4b, 0x6e, 0x2f, 0x6e, 0x67, 0xa4, 0x5c, 0x3d, 0x2c, 0x76, 0xea, 0x53, 0xb5, 0xae, 0x4a,
+    0xa2, 0xd1, 0xa8, 0x38, 0x8a, 0x67, 0x64, 0xdf, 0xed, 0x92, 0x4e, 0xa8, 0x7d, 0x3f, 0x11, 0xdd,
+    0x90, 0x52, 0x78, 0x13, 0x83, 0x2d, 0x0e, 0xe3, 0x91, 0x6d, 0xe5, 0x78, 0x6a, 0xaf, 0x0b, 0x9a,
+    0x63, 0x23, 0x17, 0x5f, 0x3a, 0xb2, 0x2d, 0xf3, 0x2d, 0x25, 0x4b, 0x64, 0xb6, 0x8b, 0xeb, 0x2a,
+    0x2c, 0x3c, 0xd0, 0x2b, 0xae, 0x31, 0x0c, 0xcc, 0xa8, 0xb6, 0xd6, 0xf0, 0xee, 0x2a, 0x6f, 0xbf,
+    0x69, 0x2b, 0x9c, 0xbd, 0x3f, 0xbd, 0x38, 0x7d, 0x73, 0x7a, 0x72, 0x72, 0xbd, 0xff, 0xe1, 0x5c,
+    0x2e, 0x30, 0x02, 0xfd, 0x4f, 0x61, 0x8d, 0x56, 0x39, 0x4d, 0x2f, 0x4d, 0x89, 0x02, 0xbc, 0x77,
+    0x7c, 0x0e, 0xc1, 0x4b, 0xdf, 0x9b, 0x33, 0x9e, 0x44, 0x7c, 0x9e, 0x89, 0x17, 0xa4, 0x22, 0x75,
+    0xd6, 0x3a, 0xc5, 0xa6, 0x02, 0x39, 0x20, 0x9a, 0xf1, 0x7e, 0xa1, 0x39, 0x68, 0x10, 0xc6, 0x29,
+    0x7f, 0x28, 0x5d, 0xc9, 0xe7, 0xaa, 0x21, 0xec, 0xd2, 0x4b, 0x22, 0x9d, 0xb2, 0xea, 0x65, 0x47,
+    0xd0, 0x1a, 0xff, 0x42, 0x89, 0xbb, 0x04, 0xb7, 0x93, 0xe2, 0x3b, 0x84, 0x81, 0xc8, 0x64, 0x6a,
+    0x6f, 0x19, 0x03, 0xb7, 0x4d, 0x53, 0xfd, 0x08, 0x60, 0x69, 0x7c, 0xd5, 0x11, 0xe4, 0xc1, 0x36,
+    0xd9, 0xae, 0xa1, 0x4d, 0x53, 0x8e, 0xa3, 0xb9, 0x1b, 0x8e, 0x85, 0xf0, 0xb8, 0x1b, 0xf8, 0x50,
+    0xda, 0x90, 0xc2, 0x95, 0x8b, 0x5a, 0xf9, 0x02, 0xd9, 0x23, 0xac, 0x7b, 0x06, 0x3d, 0xd9, 0x60,
+    0x38, 0xa9, 0xc4, 0x09, 0x44, 0x1e, 0x5b, 0x9c, 0x0c, 0x4f, 0xee, 0x96, 0x01, 0xa8, 0x48, 0xc0,
+    0x02, 0xfb, 0xc0, 0x13, 0x12, 0x45, 0x42, 0x4c, 0x52, 0xb1, 0x54, 0x6b, 0x89, 0x65, 0x43, 0x29,
+    0xdd, 0xf4, 0x00, 0xe3, 0xd2, 0xc0, 0xa5, 0x47, 0x9f, 0x91, 0x28, 0xf4, 0x85, 0x0f, 0x14, 0x90,
+    0x6e, 0xa7, 0x40, 0xae, 0x59, 0xf2, 0xf9, 0xd7, 0x61, 0xf6, 0x28, 0xa5, 0x17, 0x20, 0x78, 0xb2,
+    0xf0, 0x42, 0xbb, 0x7c, 0x5d, 0x59, 0xbc, 0xf6, 0x09, 0x1a, 0xba, 0xfc, 0x56, 0xe8, 0x5e, 0xed,
+    0x1b, 0xdf, 0xf8, 0x76, 0xd7, 0x8a, 0xb3, 0x92, 0x2f, 0x06, 0x8a, 0xb7, 0x5e, 0x5f, 0x51, 0xe1,
+    0x3b, 0xd5, 0x32, 0x76, 0x5a, 0x29, 0xe1, 0x77, 0x28, 0xf6, 0xca, 0x8b, 0xbd, 0x5a, 0xa5, 0xa8,
+    0x85, 0x44, 0x1f, 0x02, 0x2d, 0x22, 0x13, 0xe8, 0x15, 0xff, 0x16, 0x99, 0x84, 0x93, 0x55, 0xce,
+    0x89, 0xeb, 0x9e, 0x9e, 0x1d, 0xbe, 0xab, 0xbc, 0x65, 0x54, 0x26, 0x6c, 0x96, 0x04, 0xa3, 0x11,
+    0x16, 0x5f, 0x2b, 0x76, 0xc4, 0x34, 0x46, 0xbe, 0x70, 0x39, 0x2c, 0x79, 0xf4, 0xa9, 0x41, 0xef,
+    0xa5, 0xe3, 0xed, 0x68, 0x59, 0x2d, 0x61, 0x54, 0xcc, 0xb1, 0xdc, 0x65, 0xa3, 0x12, 0xd0, 0x6d,
+    0x88, 0x82, 0x35, 0x37, 0x83, 0x23, 0xb0, 0x13, 0x9e, 0xce, 0x80, 0x1e, 0x54, 0xd8, 0xaf, 0x3e,
+    0xd3, 0x28, 0xdb, 0xd1, 0x87, 0x89, 0xd7, 0x46, 0xf7, 0xd6, 0xbc, 0xa8, 0x29, 0x47, 0x0f, 0xa8,
+    0xc6, 0x46, 0x1e, 0x19, 0xdd, 0xdb, 0xae, 0x7e, 0x47, 0xbe, 0xf8, 0x4a, 0x13, 0x30, 0x84, 0xd5,
+    0xfb, 0x6a, 0xf0, 0xd1, 0x07, 0x93, 0xd2, 0x75, 0x35, 0x1c, 0x85, 0x1f, 0x2f, 0x5d, 0x54, 0x81,
+    0xf9, 0xce, 0x08, 0x09, 0xda, 0x58, 0x83, 0x6d, 0x5c, 0xf7, 0x21, 0x2a, 0x9a, 0x6c, 0xc8, 0x4b,
+    0xe3, 0xb5, 0x6b, 0x6b, 0x5f, 0x87, 0xf2, 0x37, 0xad, 0xbf, 0x94, 0x70, 0x7e, 0x2f, 0x0e, 0xc6,
+    0x37, 0xa9, 0x3c, 0x18, 0x03, 0xc9, 0x71, 0xc3, 0x20, 0x99, 0xda, 0x1b, 0x1f, 0x83, 0x30, 0xc4,
+    0x57, 0x39, 0xe7, 0x28, 0x46, 0x93, 0x90, 0xea, 0xbd, 0xf0, 0x65, 0xc7, 0x9a, 0x6f, 0x65, 0x79,
+    0xb1, 0x61, 0xd4, 0xc3, 0x99, 0xcc, 0x21, 0x50, 0xb9, 0x06, 0xb3, 0x90, 0x4a, 0xee, 0x50, 0x3f,
+    0x6b, 0xb8, 0x84, 0x42, 0x23, 0xa7, 0x6e, 0xb8, 0xc8, 0xb2, 0xd6, 0xe5, 0x31, 0xbc, 0x10, 0x5f,
+    0xab, 0x91, 0x85, 0x38, 0x95, 0x24, 0x87, 0x56, 0x84, 0xfc, 0xc0, 0x0a, 0x98, 0xd2, 0x74, 0xbc,
+    0x74, 0xc3, 0xb8, 0x21, 0xb4, 0x8b, 0x94, 0x6a, 0x75, 0x60, 0x4d, 0xcd, 0x41, 0x09, 0xce, 0xea,
+    0xb2, 0x13, 0xfd, 0xa7, 0x5a, 0xa8, 0x60, 0x26, 0x3a, 0x4c, 0xca, 0x08, 0xc9, 0x90, 0x7a, 0x79,
+    0x4f, 0x52, 0x62, 0x43, 0xe8, 0x5c, 0xac, 0x28, 0x9a, 0xb2, 0x13, 0x79, 0x54, 0x5d, 0x86, 0x2e,
+    0x03, 0x8d, 0x74, 0x8a, 0xb4, 0x00, 0x7c, 0xba, 0x2c, 0x17, 0xe1, 0x01, 0xb3, 0xe9, 0xf5, 0x6e,
+    0xf9, 0x23, 0x15, 0xd4, 0x15, 0x99, 0xa5, 0xc0, 0xa7, 0x37, 0xa9, 0x56, 0x30, 0x62, 0xe0, 0xd7,
+    0xf1, 0x1e, 0x7d, 0xcd, 0x0c, 0x40, 0x34, 0xab, 0x97, 0x10, 0x1f, 0xed, 0xfe, 0xe9, 0x61, 0x2c,
+    0xbb, 0x8a, 0xa0, 0xa8, 0xf1, 0x90, 0x3d, 0xc1, 0x74, 0x8b, 0xef, 0xab, 0xf0, 0x64, 0x79, 0x2c,
+    0xd6, 0xbf, 0x66, 0x94, 0xc5, 0x54, 0xa5, 0x32, 0xb0, 0x93, 0x6c, 0x55, 0x99, 0x50, 0x7d, 0xbd,
+    0x48, 0xfe, 0x7d, 0x11, 0x0f, 0x44, 0xb2, 0xf2, 0x0d, 0x11, 0x25, 0x77, 0x45, 0xbb, 0xf8, 0x2b,
+    0xb9, 0x31, 0xda, 0x9d, 0x4a, 0xbe, 0xa6, 0x79, 0x6b, 0x62, 0x19, 0xdf, 0x15, 0xa0, 0x65, 0x8f,
+    0xf3, 0x6f, 0xb9, 0x28, 0x4f, 0x28, 0x7d, 0xf3, 0x54, 0xed, 0x94, 0xf5, 0x5f, 0x0f, 0xa1, 0x2c,
+    0xd3, 0x7d, 0x16, 0xa9, 0xd6, 0x09, 0x3b, 0x3c, 0x7e, 0xb7, 0xf2, 0x2d, 0xf7, 0x07, 0x6c, 0x12,
+    0xa7, 0xff, 0xfe, 0x4d, 0xb2, 0xfb, 0xa9, 0xb4, 0xfe, 0x5b, 0x27, 0xfe, 0xa6, 0x2d, 0x0b, 0xbf,
+    0x53, 0x13, 0x36, 0x88, 0xeb, 0xe4, 0x37, 0xc9, 0xc0, 0x47, 0xf1, 0xa5, 0x33, 0x3b, 0x5b, 0xe2,
+    0xab, 0x2e, 0xff, 0x1f, 0xb1, 0x1e, 0x0f, 0xc9, 0xfb, 0x52, 0x00, 0x00,
+}; // Ende von MYDBG_SEITE_GZ
@@ -153,6 +153,7 @@ void setup()
   delay(200);
   Serial.println("\nSetup gestartet"); // Konsolausgabe 
   connectToWiFiMitTimeout(WIFI_SSID, WIFI_PASS); // WLAN verbinden wenn vorhanden
+  MYDBG_WATCH(zyklus); // zyklus alle 100 ms abtasten, Verlauf als Kurve auf der Web-Debug-Seite
   
   
  // MYDBG_MENUE(); // Konsolenmenü für Debug-Einstellungen kann auch hier aufgerufen werden
@@ -0,0 +1,176 @@
+#pragma once
+/*
+  Strenge JSON-Prüfung für die Host-Tests (RFC 8259), unabhängig von ArduinoJson:
+  MYDBG_jsonGueltig(text) ist true, wenn text genau ein JSON-Wert ist (Leerraum außen erlaubt).
+*/
+#include <cctype>
+#include <cstring>
+#include <string>
+
+struct MYDBG_JsonPruefer
+{
+    const char *p;
+    const char *ende;
+    int tiefe = 0;
+
+    void leerraum()
+    {
+        while (p < ende && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+            p++;
+    }
+
+    bool wort(const char *w)
+    {
+        size_t n = strlen(w);
+        if ((size_t)(ende - p) < n || strncmp(p, w, n) != 0)
+            return false;
+        p += n;
+        return true;
+    }
+
+    bool ziffern()
+    {
+        const char *start = p;
+        while (p < ende && isdigit((unsigned char)*p))
+            p++;
+        return p > start;
+    }
+
+    bool zahl()
+    {
+        if (p < ende && *p == '-')
+            p++;
+        if (p < ende && *p == '0')
+            p++;
+        else if (!ziffern())
+            return false;
+        if (p < ende && *p == '.')
+        {
+            p++;
+            if (!ziffern())
+                return false;
+        }
+        if (p < ende && (*p == 'e' || *p == 'E'))
+        {
+            p++;
+            if (p < ende && (*p == '+' || *p == '-'))
+                p++;
+            if (!ziffern())
+                return false;
+        }
+        return true;
+    }
+
+    bool text()
+    {
+        if (p >= ende || *p != '"')
+            return false;
+        p++;
+        while (p < ende && *p != '"')
+        {
+            unsigned char c = (unsigned char)*p++;
+            if (c < 0x20)
+                return false; // Steuerzeichen müssen escaped sein
+            if (c != '\\')
+                continue;
+            if (p >= ende)
+                return false;
+            char e = *p++;
+            if (e == 'u')
+            {
+                for (int i = 0; i < 4; i++)
+                    if (p >= ende || !isxdigit((unsigned char)*p++))
+                        return false;
+            }
+            else if (!strchr("\"\\/bfnrt", e))
+                return false;
+        }
+        if (p >= ende)
+            return false;
+        p++;
+        return true;
+    }
+
+    bool wert()
+    {
+        leerraum();
+        if (p >= ende || ++tiefe > 64)
+            return false;
+        bool ok;
+        if (*p == '{')
+        {
+            p++;
+            leerraum();
+            ok = true;
+            if (p < ende && *p == '}')
+                p++;
+            else
+            {
+                for (;;)
+                {
+                    leerraum();
+                    if (!text())
+                        return false;
+                    leerraum();
+                    if (p >= ende || *p++ != ':' || !wert())
+                        return false;
+                    leerraum();
+                    if (p < ende && *p == ',')
+                    {
+                        p++;
+                        continue;
+                    }
+                    if (p >= ende || *p++ != '}')
+                        return false;
+                    break;
+                }
+            }
+        }
+        else if (*p == '[')
+        {
+            p++;
+            leerraum();
+            ok = true;
+            if (p < ende && *p == ']')
+                p++;
+            else
+            {
+                for (;;)
+                {
+                    if (!wert())
+                        return false;
+                    leerraum();
+                    if (p < ende && *p == ',')
+                    {
+                        p++;
+                        continue;
+                    }
+                    if (p >= ende || *p++ != ']')
+                        return false;
+                    break;
+                }
+            }
+        }
+        else if (*p == '"')
+            ok = text();
+        else if (*p == 't')
+            ok = wort("true");
+        else if (*p == 'f')
+            ok = wort("false");
+        else if (*p == 'n')
+            ok = wort("null");
+        else
+            ok = zahl();
+        tiefe--;
+        return ok;
+    }
+}; // Ende der Struktur MYDBG_JsonPruefer
+
+inline bool MYDBG_jsonGueltig(const std::string &text)
+{
+    MYDBG_JsonPruefer j{text.data(), text.data() + text.size()};
+    if (!j.wert())
+        return false;
+    j.leerraum();
+    return j.p == j.ende;
+} // Ende der Funktion MYDBG_jsonGueltig
@@ -0,0 +1,161 @@
+/*
+  MYDBG_ASYNC mit dem echten Ausgabe-Task: MYDBG_erfassen legt Einträge nur in den Eintragspuffer, der Task
+  "MYDBG" (hier ein Thread) gibt sie aus. Der Test hält MYDBG_Sperre, damit der Task nicht leeren kann, lässt
+  den Puffer mit 100 Einträgen eines Erzeugers überlaufen und prüft je MYDBG_ueberlauf, welche Einträge im
+  Log ankommen und was MYDBG_verworfen zählt:
+  - MYDBG_VERWIRF_NEUESTE  → die ersten MYDBG_QUEUE_LAENGE, der Rest verworfen
+  - MYDBG_VERWIRF_AELTESTE → die letzten MYDBG_QUEUE_LAENGE, der Rest verworfen
+  - MYDBG_BLOCKIERE        → der Erzeuger wartet, bis der Task wieder leert; alle kommen an, nichts verworfen
+
+    pio test -e native -f test_native_async
+*/
+#define MYDBG_ASYNC
+#include <MYDBG.h>
+#include <unity.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static AsyncWebServer server(80);
+
+static const uint32_t ANZAHL = 100;
+static MYDBG_Site stellen[2] = {{"erzeuger", "Zähler", "i", 100, 0, 0, 0, nullptr, {}},
+                                {"erzeuger", "Zähler", "i", 101, 0, 0, 0, nullptr, {}}};
+static std::atomic<bool> fertig{false};
+
+// Je Thread eine eigene Stelle: die Drosselung einer Stelle ist mit MYDBG_ASYNC nicht für mehrere Tasks gedacht
+static void erzeugen(int nr)
+{
+    MYDBG_nativeKern = 0; // alle in denselben Ring
+    for (uint32_t i = 0; i < ANZAHL; i++)
+        MYDBG_erfassen(stellen[nr], MYDBG_FLAG_STOP, 1, MYDBG_wert((int)i));
+    fertig = true;
+}
+
+// Wartet, bis der Ausgabe-Task alles ausgegeben hat: Puffer leer, und unter der Sperre ist auch der letzte Eintrag fertig
+static void ausgegebenWarten()
+{
+    auto start = std::chrono::steady_clock::now();
+    while (MYDBG_pufferBelegt() > 0)
+    {
+        TEST_ASSERT_TRUE_MESSAGE(std::chrono::steady_clock::now() - start < std::chrono::seconds(5), "Ausgabe-Task leert nicht");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    MYDBG_Sperre sperre;
+}
+
+// Werte der Einträge im Log, älteste zuerst
+static std::vector<uint32_t> werteImLog()
+{
+    AsyncWebServerRequest request;
+    TEST_ASSERT_TRUE(server.aufrufen("/mydbg_query", request, {{"limit", "100000"}}));
+    TEST_ASSERT_NOT_NULL(request.antwort.get());
+    TEST_ASSERT_EQUAL(200, request.antwort->code);
+    const std::string &ndjson = request.antwort->inhalt;
+    std::vector<uint32_t> werte;
+    const std::string muster = "\"varValue\":\"";
+    for (size_t pos = ndjson.find(muster); pos != std::string::npos; pos = ndjson.find(muster, pos + 1))
+        werte.push_back(strtoul(ndjson.c_str() + pos + muster.size(), nullptr, 10));
+    return werte;
+}
+
+// Ein Durchlauf mit angehaltenem Ausgabe-Task; liefert die verworfenen Einträge
+static uint32_t durchlauf(MYDBG_Ueberlauf ueberlauf)
+{
+    ausgegebenWarten();
+    MYDBG_resetJsonFiles();
+    MYDBG_ueberlauf = ueberlauf;
+    const uint32_t verworfen = MYDBG_verworfen;
+    fertig = false;
+    std::thread erzeugend;
+    {
+        MYDBG_Sperre sperre; // der Ausgabe-Task leert nur unter der Sperre
+        erzeugend = std::thread(erzeugen, 0);
+        if (ueberlauf == MYDBG_BLOCKIERE)
+        {
+            auto start = std::chrono::steady_clock::now();
+            while (MYDBG_pufferBelegt() < MYDBG_QUEUE_LAENGE && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            TEST_ASSERT_EQUAL_UINT32(MYDBG_QUEUE_LAENGE, MYDBG_pufferBelegt());
+            TEST_ASSERT_FALSE_MESSAGE(fertig, "Erzeuger wartet nicht auf freien Platz");
+        }
+        else
+        {
+            erzeugend.join();
+            TEST_ASSERT_EQUAL_UINT32(MYDBG_QUEUE_LAENGE, MYDBG_pufferBelegt());
+        }
+    }
+    if (erzeugend.joinable())
+        erzeugend.join();
+    ausgegebenWarten();
+    return MYDBG_verworfen - verworfen;
+}
+
+static void werteVonBis(const std::vector<uint32_t> &werte, uint32_t von, uint32_t bis)
+{
+    TEST_ASSERT_EQUAL(bis - von, werte.size());
+    for (uint32_t i = 0; i < werte.size(); i++)
+        TEST_ASSERT_EQUAL_UINT32(von + i, werte[i]);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_verwirf_neueste()
+{
+    TEST_ASSERT_EQUAL_UINT32(ANZAHL - MYDBG_QUEUE_LAENGE, durchlauf(MYDBG_VERWIRF_NEUESTE));
+    werteVonBis(werteImLog(), 0, MYDBG_QUEUE_LAENGE);
+}
+
+void test_verwirf_aelteste()
+{
+    TEST_ASSERT_EQUAL_UINT32(ANZAHL - MYDBG_QUEUE_LAENGE, durchlauf(MYDBG_VERWIRF_AELTESTE));
+    werteVonBis(werteImLog(), ANZAHL - MYDBG_QUEUE_LAENGE, ANZAHL);
+}
+
+void test_blockiere()
+{
+    TEST_ASSERT_EQUAL_UINT32(0, durchlauf(MYDBG_BLOCKIERE));
+    werteVonBis(werteImLog(), 0, ANZAHL);
+}
+
+// Ohne Überlauf gibt der Task von sich aus aus, auch aus mehreren Tasks
+void test_task_gibt_aus()
+{
+    ausgegebenWarten();
+    MYDBG_resetJsonFiles();
+    MYDBG_ueberlauf = MYDBG_BLOCKIERE;
+    const uint32_t verworfen = MYDBG_verworfen;
+    std::thread a(erzeugen, 0), b(erzeugen, 1);
+    a.join();
+    b.join();
+    ausgegebenWarten();
+    TEST_ASSERT_EQUAL_UINT32(verworfen, MYDBG_verworfen.load());
+    std::vector<uint32_t> werte = werteImLog();
+    TEST_ASSERT_EQUAL(2 * ANZAHL, werte.size());
+    uint32_t summe = 0;
+    for (uint32_t w : werte)
+        summe += w;
+    TEST_ASSERT_EQUAL_UINT32(ANZAHL * (ANZAHL - 1), summe); // zweimal 0 … ANZAHL - 1
+}
+
+int main()
+{
+    MYDBG_rateProS = 0; // keine Drosselung
+    MYDBG_wiederholungMs = 0;
+    MYDBG_initFilesystem();
+    MYDBG_prepareJsonFiles();
+    MYDBG_addJsonRoutes(server);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_verwirf_neueste);
+    RUN_TEST(test_verwirf_aelteste);
+    RUN_TEST(test_blockiere);
+    RUN_TEST(test_task_gibt_aus);
+    int fehler = UNITY_END();
+    new MYDBG_Sperre; // Ausgabe-Task anhalten, bevor die Platzhalter abgebaut werden
+    LittleFS.aufraeumen();
+    return fehler;
+}
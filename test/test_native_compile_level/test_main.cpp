@@ -0,0 +1,67 @@
+/*
+  MYDBG_COMPILE_LEVEL: Aufrufe mit konstantem wait unter der Schwelle dürfen im fertigen Programm
+  weder Code noch Texte hinterlassen. Geprüft wird das eigene Programm (/proc/self/exe): Die Texte
+  der entfernten Aufrufe dürfen darin nicht vorkommen, die der übrigen müssen es.
+  Die gesuchten Texte stehen hier rückwärts, damit der Test sie nicht selbst ins Programm bringt.
+
+    pio test -e native -f test_native_compile_level
+*/
+#define MYDBG_COMPILE_LEVEL 5
+#include <MYDBG.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+static std::string programm;
+
+// Wird nie aufgerufen, muss aber übersetzt werden
+__attribute__((used, noinline)) void aufrufstellen(int wert, int stufe)
+{
+    MYDBG(0, "MYDBG_TEST_ENTFERNT_STUFE0");
+    MYDBG(4, "MYDBG_TEST_ENTFERNT_STUFE4", wert);
+    const int konstant = 3;
+    MYDBG(konstant, "MYDBG_TEST_ENTFERNT_KONSTANTE", wert);
+    MYDBG_L2("MYDBG_TEST_ENTFERNT_L2", wert);
+    MYDBG(5, "MYDBG_TEST_BLEIBT_STUFE5", wert);
+    MYDBG_L9("MYDBG_TEST_BLEIBT_L9");
+    MYDBG(stufe, "MYDBG_TEST_BLEIBT_VARIABEL", wert); // variables wait: Prüfung zur Laufzeit
+}
+
+static bool imProgramm(const char *rueckwaerts)
+{
+    std::string text(rueckwaerts);
+    std::reverse(text.begin(), text.end());
+    return programm.find(text) != std::string::npos;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_stufe_unter_schwelle_entfernt()
+{
+    TEST_ASSERT_FALSE_MESSAGE(imProgramm("0EFUTS_TNREFTNE_TSET_GBDYM"), "MYDBG(0, ...) im Programm");
+    TEST_ASSERT_FALSE_MESSAGE(imProgramm("4EFUTS_TNREFTNE_TSET_GBDYM"), "MYDBG(4, ...) im Programm");
+    TEST_ASSERT_FALSE_MESSAGE(imProgramm("ETNATSNOK_TNREFTNE_TSET_GBDYM"), "MYDBG(konstant, ...) im Programm");
+    TEST_ASSERT_FALSE_MESSAGE(imProgramm("2L_TNREFTNE_TSET_GBDYM"), "MYDBG_L2 im Programm");
+}
+
+void test_stufe_ab_schwelle_bleibt()
+{
+    TEST_ASSERT_TRUE_MESSAGE(imProgramm("5EFUTS_TBIELB_TSET_GBDYM"), "MYDBG(5, ...) fehlt");
+    TEST_ASSERT_TRUE_MESSAGE(imProgramm("9L_TBIELB_TSET_GBDYM"), "MYDBG_L9 fehlt");
+    TEST_ASSERT_TRUE_MESSAGE(imProgramm("LEBAIRAV_TBIELB_TSET_GBDYM"), "MYDBG(variabel, ...) fehlt");
+}
+
+int main()
+{
+    std::ifstream datei("/proc/self/exe", std::ios::binary);
+    programm.assign(std::istreambuf_iterator<char>(datei), std::istreambuf_iterator<char>());
+
+    UNITY_BEGIN();
+    RUN_TEST(test_stufe_unter_schwelle_entfernt);
+    RUN_TEST(test_stufe_ab_schwelle_bleibt);
+    return UNITY_END();
+}
@@ -0,0 +1,219 @@
+/*
+  Eintragspuffer ohne Sperre: Erzeuger-Threads auf beiden "Kernen" (MYDBG_nativeKern 0 und 1) schreiben
+  gleichzeitig über MYDBG_pufferSchreiben, MYDBG_queuePush oder MYDBG_isrErfassen, ein Leser-Thread nimmt
+  wie der Ausgabe-Task mit MYDBG_pufferNehmen heraus. Jeder Eintrag trägt Erzeuger und Zähler doppelt
+  (Kopfdaten, Wert und dessen Kehrwert in den oberen 8 Byte), ein zerrissener Eintrag fällt auf.
+  - ohne Überlauf kommt jedes Paar (Erzeuger, Zähler) genau einmal und je Erzeuger in Reihenfolge an
+  - mit Überlauf (MYDBG_VERWIRF_AELTESTE, aus einer ISR) fehlen genau so viele, wie MYDBG_verworfen zählt
+  Die Ausgabe zeigt den Durchsatz je Erzeugerzahl.
+
+    pio test -e native -f test_native_eintragspuffer
+*/
+#define MYDBG_ASYNC // für MYDBG_queuePush; den Ausgabe-Task spielt der Leser-Thread
+#include <MYDBG.h>
+#include <unity.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static const int MAX_ERZEUGER = 8;
+static const uint32_t JE_ERZEUGER = 20000;
+
+enum Weg
+{
+    SCHREIBEN, // MYDBG_pufferSchreiben, bei vollem Puffer erneut versuchen
+    PUSH,      // MYDBG_queuePush mit MYDBG_ueberlauf
+    ISR        // MYDBG_isrErfassen
+};
+
+static MYDBG_Site stellen[MAX_ERZEUGER];
+static char verbraucher; // Kennung des Leser-Threads als MYDBG_verbraucher: MYDBG_asyncStart startet keinen Task
+
+static std::atomic<bool> laeuft{false};
+
+// Was der Leser gesehen hat
+struct Empfang
+{
+    uint32_t naechster[MAX_ERZEUGER]; // je Erzeuger der nächste erwartete Zähler
+    uint32_t erhalten;
+    uint32_t zerrissen;
+    uint32_t verdreht; // doppelt oder gegen die Reihenfolge
+    uint32_t luecken;  // übersprungene Zähler
+};
+static Empfang empfang;
+
+static MYDBG_WertDaten wertFuer(int nr, uint32_t i)
+{
+    MYDBG_WertDaten d;
+    d.u = ((uint64_t)nr << 32) | i;
+    uint64_t kehrwert = ~d.u;
+    memcpy(d.text + 8, &kehrwert, sizeof(kehrwert));
+    return d;
+}
+
+static MYDBG_LogRecord eintragFuer(int nr, uint32_t i)
+{
+    MYDBG_LogRecord rec = {};
+    rec.seq = i;
+    rec.site = (uint32_t)nr;
+    rec.mikros = esp_timer_get_time();
+    rec.typ = MYDBG_TYP_UINT;
+    rec.flags = MYDBG_FLAG_STOP;
+    rec.wert = wertFuer(nr, i);
+    return rec;
+}
+
+// Erzeuger und Zähler eines Eintrags; false, wenn die Kopien nicht zusammenpassen
+static bool zerlegen(const MYDBG_LogRecord &rec, MYDBG_Site *site, int &nr, uint32_t &i)
+{
+    uint64_t kehrwert;
+    memcpy(&kehrwert, rec.wert.text + 8, sizeof(kehrwert));
+    nr = (int)(rec.wert.u >> 32);
+    i = (uint32_t)rec.wert.u;
+    if (kehrwert != ~rec.wert.u || nr < 0 || nr >= MAX_ERZEUGER || rec.typ != MYDBG_TYP_UINT)
+        return false;
+    if (rec.flags & MYDBG_FLAG_ISR)
+        return site == &stellen[nr];
+    return !site && rec.site == (uint32_t)nr && rec.seq == i;
+}
+
+static void erzeuger(int nr, Weg weg)
+{
+    MYDBG_nativeKern = nr % 2;
+    for (uint32_t i = 0; i < JE_ERZEUGER; i++)
+    {
+        if (weg == ISR)
+        {
+            MYDBG_Wert w;
+            w.typ = MYDBG_TYP_UINT;
+            w.daten = wertFuer(nr, i);
+            MYDBG_isrErfassen(stellen[nr], w);
+        }
+        else if (weg == PUSH)
+        {
+            MYDBG_queuePush(eintragFuer(nr, i));
+        }
+        else
+        {
+            MYDBG_LogRecord rec = eintragFuer(nr, i);
+            while (!MYDBG_pufferSchreiben(rec, nullptr))
+                std::this_thread::yield();
+        }
+    }
+}
+
+// Nimmt heraus, bis die Erzeuger fertig sind und der Puffer leer ist; bremsen lässt den Puffer überlaufen
+static void leser(bool bremsen)
+{
+    MYDBG_LogRecord rec;
+    MYDBG_Site *site;
+    for (;;)
+    {
+        bool fertig = !laeuft; // vor dem Nehmen: ist der Puffer danach leer, kommt nichts mehr
+        if (!MYDBG_pufferNehmen(rec, site))
+        {
+            if (fertig)
+                return;
+            std::this_thread::yield();
+            continue;
+        }
+        int nr;
+        uint32_t i;
+        empfang.erhalten++;
+        if (!zerlegen(rec, site, nr, i))
+        {
+            empfang.zerrissen++;
+            continue;
+        }
+        if (i < empfang.naechster[nr])
+            empfang.verdreht++;
+        else
+            empfang.luecken += i - empfang.naechster[nr];
+        empfang.naechster[nr] = i + 1;
+        if (bremsen && empfang.erhalten % 16 == 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+// anzahl Erzeuger auf weg gegen einen Leser; Sekunden bis alle Einträge heraus sind
+static double durchlauf(int anzahl, Weg weg, bool bremsen)
+{
+    memset(&empfang, 0, sizeof(empfang));
+    MYDBG_verworfen = 0;
+    laeuft = true;
+    auto start = std::chrono::steady_clock::now();
+    std::thread lesend(leser, bremsen);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < anzahl; t++)
+        threads.emplace_back(erzeuger, t, weg);
+    for (std::thread &t : threads)
+        t.join();
+    laeuft = false;
+    lesend.join();
+    TEST_ASSERT_EQUAL_UINT32(0, MYDBG_pufferBelegt());
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void setUp()
+{
+    MYDBG_ueberlauf = MYDBG_VERWIRF_AELTESTE;
+}
+void tearDown() {}
+
+// Ohne Überlauf: jedes Paar genau einmal, unversehrt und je Erzeuger in Reihenfolge
+void test_kein_eintrag_geht_verloren()
+{
+    for (int anzahl : {1, 2, 4, 8})
+    {
+        double sekunden = durchlauf(anzahl, SCHREIBEN, false);
+        char text[96];
+        snprintf(text, sizeof(text), "%d Erzeuger: %.0f Einträge/s gesamt, %.0f je Erzeuger", anzahl,
+                 anzahl * JE_ERZEUGER / sekunden, JE_ERZEUGER / sekunden);
+        TEST_MESSAGE(text);
+        TEST_ASSERT_EQUAL_UINT32(0, empfang.zerrissen);
+        TEST_ASSERT_EQUAL_UINT32(0, empfang.verdreht);
+        TEST_ASSERT_EQUAL_UINT32(0, empfang.luecken);
+        TEST_ASSERT_EQUAL_UINT32(anzahl * JE_ERZEUGER, empfang.erhalten);
+        for (int nr = 0; nr < anzahl; nr++)
+            TEST_ASSERT_EQUAL_UINT32(JE_ERZEUGER, empfang.naechster[nr]);
+        TEST_ASSERT_EQUAL_UINT32(0, MYDBG_verworfen.load());
+    }
+}
+
+// Überlauf: was fehlt, ist gezählt; was ankommt, ist unversehrt und in Reihenfolge
+static void verlustGezaehlt(Weg weg)
+{
+    for (int anzahl : {1, 2, 4, 8})
+    {
+        durchlauf(anzahl, weg, true);
+        TEST_ASSERT_EQUAL_UINT32(0, empfang.zerrissen);
+        TEST_ASSERT_EQUAL_UINT32(0, empfang.verdreht);
+        TEST_ASSERT_TRUE_MESSAGE(MYDBG_verworfen > 0, "Puffer ist nicht übergelaufen");
+        TEST_ASSERT_EQUAL_UINT32(anzahl * JE_ERZEUGER - empfang.erhalten, MYDBG_verworfen.load());
+    }
+}
+
+void test_verwirf_aelteste()
+{
+    MYDBG_ueberlauf = MYDBG_VERWIRF_AELTESTE;
+    verlustGezaehlt(PUSH);
+}
+
+void test_aus_isr()
+{
+    verlustGezaehlt(ISR);
+}
+
+int main()
+{
+    MYDBG_verbraucher = &verbraucher;
+    for (int t = 0; t < MAX_ERZEUGER; t++)
+        stellen[t] = {"erzeuger", "isr", "i", (uint16_t)(100 + t), MYDBG_TYP_UINT, 0, 0, nullptr, {}};
+
+    UNITY_BEGIN();
+    RUN_TEST(test_kein_eintrag_geht_verloren);
+    RUN_TEST(test_verwirf_aelteste);
+    RUN_TEST(test_aus_isr);
+    return UNITY_END();
+}
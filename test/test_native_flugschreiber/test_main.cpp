@@ -0,0 +1,226 @@
+/*
+  Flugschreiber gegen eine per mmap eingeblendete Datei (MYDBG_FLUG_EIGENE_REGION) statt RTC-RAM.
+  Jeder "Start" läuft in einem eigenen Prozess (fork), der ohne Aufräumen endet wie bei einem Absturz;
+  der nächste Prozess blendet die Datei neu ein und muss die Einträge des vorigen wiederfinden.
+
+    pio test -e native -f test_native_flugschreiber
+*/
+#define MYDBG_FLUG_EIGENE_REGION
+#include <MYDBG.h>
+#include <unity.h>
+
+#include <fcntl.h>
+#include <functional>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <vector>
+
+static char flugDatei[] = "/tmp/mydbg_flug_XXXXXX";
+static void *abbild = nullptr;
+
+// Blendet die Datei bei jedem Aufruf neu ein, wie der Speicher nach einem Neustart
+MYDBG_MemRegion MYDBG_flugRegion()
+{
+    if (abbild)
+        munmap(abbild, sizeof(MYDBG_FlugSpeicher));
+    int fd = open(flugDatei, O_RDWR);
+    if (fd < 0 || ftruncate(fd, sizeof(MYDBG_FlugSpeicher)) != 0)
+        return {nullptr, 0};
+    abbild = mmap(nullptr, sizeof(MYDBG_FlugSpeicher), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (abbild == MAP_FAILED)
+        abbild = nullptr;
+    return {abbild, abbild ? sizeof(MYDBG_FlugSpeicher) : 0};
+}
+
+// Ein Start des Programms: eigener Prozess, endet mit _exit() ohne Destruktoren oder msync().
+// Im Kindprozess keine TEST_ASSERT-Makros, er meldet nur über den Rückgabewert von ablauf.
+static void start(const std::function<bool(MYDBG_Flugschreiber &)> &ablauf)
+{
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        MYDBG_Flugschreiber flug;
+        _exit(ablauf(flug) ? 0 : 1);
+    }
+    int status = -1;
+    waitpid(pid, &status, 0);
+    TEST_ASSERT_TRUE_MESSAGE(WIFEXITED(status) && WEXITSTATUS(status) == 0, "Kindprozess fehlgeschlagen");
+}
+
+static MYDBG_LogRecord eintrag(uint32_t seq)
+{
+    MYDBG_LogRecord rec = {};
+    rec.seq = seq;
+    rec.site = 0x1234;
+    rec.mikros = seq * 1000ull;
+    rec.typ = MYDBG_TYP_INT;
+    rec.wert.i = (int32_t)seq * 7;
+    return rec;
+}
+
+// Liest im aktuellen Prozess wie ein frischer Start, was frühere Starts hinterlassen haben
+// (seq der Einträge, 0 für einen Eintrag mit falschem Wert)
+static std::vector<uint32_t> vorherige(bool vergessen = false)
+{
+    MYDBG_Flugschreiber flug;
+    std::vector<uint32_t> seqs;
+    flug.vorherige([&](const MYDBG_LogRecord &rec)
+                   { seqs.push_back(rec.wert.i == (int32_t)rec.seq * 7 ? rec.seq : 0); });
+    if (vergessen)
+        flug.vergessen();
+    return seqs;
+}
+
+void setUp()
+{
+    int fd = mkstemp(flugDatei);
+    if (fd >= 0)
+        close(fd);
+}
+
+void tearDown()
+{
+    if (abbild)
+        munmap(abbild, sizeof(MYDBG_FlugSpeicher));
+    abbild = nullptr;
+    unlink(flugDatei);
+    strcpy(flugDatei, "/tmp/mydbg_flug_XXXXXX");
+}
+
+void test_kaltstart_ist_leer()
+{
+    TEST_ASSERT_EQUAL(0, vorherige().size());
+    MYDBG_FlugSpeicher *s = (MYDBG_FlugSpeicher *)abbild;
+    TEST_ASSERT_EQUAL_UINT32(MYDBG_FLUG_MAGIC, s->magic);
+    TEST_ASSERT_EQUAL(MYDBG_FLUG_ANZAHL, s->plaetze);
+}
+
+void test_eintraege_ueberstehen_den_prozess()
+{
+    start([](MYDBG_Flugschreiber &flug)
+          {
+        for (uint32_t i = 1; i <= 5; i++)
+            flug.schreiben(eintrag(i));
+        return true; });
+    std::vector<uint32_t> seqs = vorherige();
+    TEST_ASSERT_EQUAL(5, seqs.size());
+    for (uint32_t i = 0; i < 5; i++)
+        TEST_ASSERT_EQUAL_UINT32(i + 1, seqs[i]);
+}
+
+void test_ring_behaelt_die_letzten()
+{
+    start([](MYDBG_Flugschreiber &flug)
+          {
+        for (uint32_t i = 1; i <= 3 * MYDBG_FLUG_ANZAHL + 5; i++)
+            flug.schreiben(eintrag(i));
+        return true; });
+    std::vector<uint32_t> seqs = vorherige();
+    TEST_ASSERT_EQUAL(MYDBG_FLUG_ANZAHL, seqs.size());
+    TEST_ASSERT_EQUAL_UINT32(2 * MYDBG_FLUG_ANZAHL + 6, seqs.front()); // älteste zuerst
+    TEST_ASSERT_EQUAL_UINT32(3 * MYDBG_FLUG_ANZAHL + 5, seqs.back());
+}
+
+void test_zerstoerter_platz_wird_verworfen()
+{
+    start([](MYDBG_Flugschreiber &flug)
+          {
+        for (uint32_t i = 1; i <= 4; i++)
+            flug.schreiben(eintrag(i));
+        return true; });
+    // Ein Byte von Eintrag 2 kippt, z. B. weil der Reset mitten ins Schreiben fiel
+    MYDBG_flugRegion();
+    ((MYDBG_FlugSpeicher *)abbild)->platz[1].rec.wert.i ^= 0x40;
+    std::vector<uint32_t> seqs = vorherige();
+    TEST_ASSERT_EQUAL(3, seqs.size());
+    TEST_ASSERT_EQUAL_UINT32(1, seqs[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, seqs[1]);
+    TEST_ASSERT_EQUAL_UINT32(4, seqs[2]);
+}
+
+void test_gemeldete_eintraege_kommen_nicht_wieder()
+{
+    start([](MYDBG_Flugschreiber &flug)
+          {
+        for (uint32_t i = 1; i <= 3; i++)
+            flug.schreiben(eintrag(i));
+        return true; });
+    start([](MYDBG_Flugschreiber &flug)
+          {
+        bool gemeldet = vorherige(true).size() == 3; // meldet und vergisst, wie nach einem Watchdog
+        flug.schreiben(eintrag(10));
+        flug.schreiben(eintrag(11));
+        return gemeldet; });
+    std::vector<uint32_t> seqs = vorherige();
+    TEST_ASSERT_EQUAL(2, seqs.size());
+    TEST_ASSERT_EQUAL_UINT32(10, seqs[0]);
+    TEST_ASSERT_EQUAL_UINT32(11, seqs[1]);
+}
+
+void test_andere_version_wird_neu_angelegt()
+{
+    start([](MYDBG_Flugschreiber &flug)
+          {
+        flug.schreiben(eintrag(1));
+        return true; });
+    MYDBG_flugRegion();
+    ((MYDBG_FlugSpeicher *)abbild)->version = MYDBG_FLUG_VERSION + 1; // Firmware mit anderem Format
+    TEST_ASSERT_EQUAL(0, vorherige().size());
+    TEST_ASSERT_EQUAL(MYDBG_FLUG_VERSION, ((MYDBG_FlugSpeicher *)abbild)->version);
+}
+
+void test_jeder_mydbg_aufruf_landet_im_flugschreiber()
+{
+    start([](MYDBG_Flugschreiber &)
+          {
+        MYDBG_nativePauseAus = true;
+        for (int i = 1; i <= 3; i++)
+            MYDBG(0, "Flugschreiber", i); // Stufe 0: keine Datei, nur Konsole
+        LittleFS.aufraeumen();
+        return true; });
+    MYDBG_Flugschreiber flug;
+    std::vector<MYDBG_LogRecord> recs;
+    flug.vorherige([&](const MYDBG_LogRecord &rec)
+                   { recs.push_back(rec); });
+    TEST_ASSERT_EQUAL(3, recs.size());
+    for (int i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_EQUAL(0, recs[i].stufe);
+        TEST_ASSERT_EQUAL(i + 1, recs[i].wert.i);
+    }
+}
+
+// Für "flug" in /mydbg_watchdog.json: alle außer dem neuesten, der dort schon oben steht
+void test_ohne_den_neuesten()
+{
+    start([](MYDBG_Flugschreiber &flug)
+          {
+        for (uint32_t i = 1; i <= 3; i++)
+            flug.schreiben(eintrag(i));
+        return true; });
+    MYDBG_Flugschreiber flug;
+    std::vector<uint32_t> seqs;
+    uint32_t anzahl = flug.vorherige([](const MYDBG_LogRecord &) {});
+    TEST_ASSERT_EQUAL_UINT32(3, anzahl);
+    TEST_ASSERT_EQUAL_UINT32(2, flug.vorherige([&](const MYDBG_LogRecord &rec)
+                                               { seqs.push_back(rec.seq); },
+                                               anzahl - 1));
+    TEST_ASSERT_EQUAL(2, seqs.size());
+    TEST_ASSERT_EQUAL_UINT32(1, seqs[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, seqs[1]);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_kaltstart_ist_leer);
+    RUN_TEST(test_eintraege_ueberstehen_den_prozess);
+    RUN_TEST(test_ring_behaelt_die_letzten);
+    RUN_TEST(test_zerstoerter_platz_wird_verworfen);
+    RUN_TEST(test_gemeldete_eintraege_kommen_nicht_wieder);
+    RUN_TEST(test_andere_version_wird_neu_angelegt);
+    RUN_TEST(test_jeder_mydbg_aufruf_landet_im_flugschreiber);
+    RUN_TEST(test_ohne_den_neuesten);
+    return UNITY_END();
+}
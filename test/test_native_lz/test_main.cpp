@@ -0,0 +1,174 @@
+/*
+  Segmentkompression: MYDBG_lzPacken/MYDBG_lzEntpacken auf Randfällen und MYDBG_segPacken auf echten
+  Segmenten – was der Ringleser aus gepackten Segmenten liefert, muss Byte für Byte dem Geschriebenen gleichen.
+
+    pio test -e native -f test_native_lz
+*/
+#include <MYDBG.h>
+#include <unity.h>
+
+#include <random>
+#include <vector>
+
+static std::vector<uint8_t> packen(const std::vector<uint8_t> &roh, uint16_t schritt)
+{
+    std::vector<uint16_t> hash(1 << MYDBG_LZ_HASH_BITS);
+    std::vector<uint8_t> aus;
+    size_t n = MYDBG_lzPacken(roh.data(), roh.size(), [&](const uint8_t *d, size_t l)
+                              { aus.insert(aus.end(), d, d + l); },
+                              hash.data(), schritt);
+    TEST_ASSERT_EQUAL(aus.size(), n);
+    return aus;
+}
+
+static size_t entpacken(const std::vector<uint8_t> &gepackt, std::vector<uint8_t> &ziel)
+{
+    size_t i = 0;
+    return MYDBG_lzEntpacken([&]() -> int
+                             { return i < gepackt.size() ? gepackt[i++] : -1; },
+                             ziel.data(), ziel.size());
+}
+
+static void rundreise(const std::vector<uint8_t> &roh, uint16_t schritt = sizeof(MYDBG_LogRecord))
+{
+    std::vector<uint8_t> gepackt = packen(roh, schritt);
+    TEST_ASSERT_LESS_OR_EQUAL(roh.size() + roh.size() / 8 + 1, gepackt.size()); // höchstens ein Steuerbyte je 8 Byte mehr
+    std::vector<uint8_t> zurueck(roh.size());
+    TEST_ASSERT_EQUAL(roh.size(), entpacken(gepackt, zurueck));
+    TEST_ASSERT_TRUE_MESSAGE(zurueck == roh, "entpackt != roh");
+}
+
+static MYDBG_LogRecord eintrag(uint32_t i)
+{
+    MYDBG_LogRecord rec = {};
+    rec.site = 0x1A2B0000 + i % 5;
+    rec.mikros = 5000000ull + i * 20013ull;
+    rec.boot = 3;
+    rec.typ = MYDBG_TYP_INT;
+    rec.resetReason = ESP_RST_POWERON;
+    rec.flags = MYDBG_FLAG_STOP;
+    rec.stufe = 1 + i % 9;
+    rec.wert.i = (int32_t)(i * 7919 % 1000) - 500;
+    return rec;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_randfaelle()
+{
+    rundreise({});
+    rundreise({42});
+    rundreise({1, 2});
+    rundreise({7, 7, 7});
+    rundreise(std::vector<uint8_t>(4000, 0x55)); // lange Wiederholung, überlappende Treffer
+    rundreise({1, 2, 3, 1, 2, 3, 1, 2, 3, 4}, 0);
+}
+
+void test_zufall_und_grosse_bloecke()
+{
+    std::mt19937 zufall(1234);
+    std::vector<uint8_t> roh(65535);
+    for (uint8_t &b : roh)
+        b = zufall();
+    rundreise(roh); // kein Treffer: nur Literale
+    for (size_t i = 0; i < roh.size(); i++)
+        roh[i] = i % 5000 < 2500 ? (uint8_t)(i % 251) : roh[i]; // Treffer weiter weg als das Fenster
+    rundreise(roh);
+}
+
+void test_eintraege_werden_kleiner()
+{
+    std::vector<uint8_t> roh(MYDBG_Z_BLOCK_EINTRAEGE * sizeof(MYDBG_LogRecord));
+    for (uint32_t i = 0; i < MYDBG_Z_BLOCK_EINTRAEGE; i++)
+    {
+        MYDBG_LogRecord rec = eintrag(i);
+        rec.seq = 1000 + i;
+        memcpy(&roh[i * sizeof(rec)], &rec, sizeof(rec));
+    }
+    rundreise(roh);
+    TEST_ASSERT_LESS_THAN(roh.size() / 2, packen(roh, sizeof(MYDBG_LogRecord)).size());
+}
+
+void test_beschaedigte_daten()
+{
+    std::vector<uint8_t> roh(2000);
+    for (size_t i = 0; i < roh.size(); i++)
+        roh[i] = i % 37;
+    std::vector<uint8_t> gepackt = packen(roh, 0);
+    std::vector<uint8_t> zurueck(roh.size());
+
+    std::vector<uint8_t> kurz(gepackt.begin(), gepackt.begin() + gepackt.size() / 2);
+    TEST_ASSERT_LESS_THAN(roh.size(), entpacken(kurz, zurueck)); // abgeschnitten: nie die volle Länge
+
+    std::vector<uint8_t> falsch = {0x01, 0xFF, 0x0F}; // Treffer vor dem Anfang
+    TEST_ASSERT_EQUAL(0, entpacken(falsch, zurueck));
+}
+
+void test_segmente_packen_und_lesen()
+{
+    MYDBG_initFilesystem();
+    MYDBG_ringInit();
+    TEST_ASSERT_TRUE(MYDBG_ring.bereit);
+
+    const uint32_t anzahl = 2 * MYDBG_SEGMENT_EINTRAEGE + MYDBG_SEGMENT_EINTRAEGE / 3 + 7; // letztes Segment halb voll
+    std::vector<MYDBG_LogRecord> geschrieben;
+    for (uint32_t i = 0; i < anzahl; i++)
+    {
+        MYDBG_LogRecord rec = eintrag(i);
+        MYDBG_ringAppend(rec); // setzt seq
+        geschrieben.push_back(rec);
+    }
+    TEST_ASSERT_EQUAL_UINT32(MYDBG_ring.ersteNr + 2, MYDBG_ring.letzteNr);
+
+    for (uint32_t nr = MYDBG_ring.ersteNr; nr < MYDBG_ring.letzteNr; nr++)
+    {
+        MYDBG_SegInfo vorher, nachher;
+        TEST_ASSERT_TRUE(MYDBG_segKopfLesen(nr, vorher));
+        TEST_ASSERT_TRUE(MYDBG_segPacken(nr));
+        TEST_ASSERT_TRUE(MYDBG_segKopfLesen(nr, nachher));
+        TEST_ASSERT_TRUE(nachher.komprimiert);
+        TEST_ASSERT_EQUAL_UINT32(vorher.anzahl, nachher.anzahl);
+        TEST_ASSERT_LESS_THAN(vorher.groesse / 2, nachher.groesse);
+        TEST_ASSERT_FALSE(MYDBG_segPacken(nr)); // schon gepackt
+    }
+    TEST_ASSERT_FALSE(MYDBG_segPacken(MYDBG_ring.letzteNr + 1)); // gibt es nicht
+
+    MYDBG_RingLeser leser;
+    leser.oeffnen(UINT32_MAX, true); // ältester zuerst, über gepackte und ungepackte Segmente
+    TEST_ASSERT_EQUAL_UINT32(anzahl, leser.anzahl);
+    MYDBG_LogRecord rec;
+    for (uint32_t i = 0; i < anzahl; i++)
+    {
+        TEST_ASSERT_TRUE(leser.naechster(rec));
+        TEST_ASSERT_EQUAL_MEMORY(&geschrieben[i], &rec, sizeof(rec));
+    }
+    TEST_ASSERT_FALSE(leser.naechster(rec));
+
+    leser.oeffnen(UINT32_MAX); // neuester zuerst, springt rückwärts durch die Blöcke
+    for (uint32_t i = anzahl; i-- > 0;)
+    {
+        TEST_ASSERT_TRUE(leser.naechster(rec));
+        TEST_ASSERT_EQUAL_MEMORY(&geschrieben[i], &rec, sizeof(rec));
+    }
+
+    leser.oeffnen(UINT32_MAX, true);
+    leser.abSeq(geschrieben[MYDBG_SEGMENT_EINTRAEGE + 150].seq); // mitten in einen gepackten Block
+    TEST_ASSERT_TRUE(leser.naechster(rec));
+    TEST_ASSERT_EQUAL_MEMORY(&geschrieben[MYDBG_SEGMENT_EINTRAEGE + 150], &rec, sizeof(rec));
+    leser.schliessen();
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_randfaelle);
+    RUN_TEST(test_zufall_und_grosse_bloecke);
+    RUN_TEST(test_eintraege_werden_kleiner);
+    RUN_TEST(test_beschaedigte_daten);
+    RUN_TEST(test_segmente_packen_und_lesen);
+    int fehler = UNITY_END();
+    MYDBG_ringSchliessen();
+    LittleFS.aufraeumen();
+    return fehler;
+}
@@ -0,0 +1,346 @@
+/*
+  /metrics über den Platzhalter-Webserver, gelesen wie von einem Prometheus-Scraper: Die Antwort muss dem
+  Textformat 0.0.4 genügen (Namen, Labels, Zahlen, eine # TYPE-Zeile je Familie vor ihren Werten, keine Serie
+  doppelt, Verteilungen mit aufsteigenden, kumulierten Klassen bis +Inf und passendem _count) und die Werte
+  von MYDBG_COUNTER, MYDBG_GAUGE und MYDBG_HISTOGRAM enthalten – auch während andere Threads zählen.
+
+    pio test -e native -f test_native_metriken
+*/
+#include <MYDBG.h>
+#include <unity.h>
+
+#include <cmath>
+#include <set>
+#include <thread>
+#include <vector>
+
+static AsyncWebServer server(80);
+
+// Eine Zeile mit Wert: name{labels} wert
+struct Probe
+{
+    std::string name;
+    std::string labels; // ohne Klammern, so wie übertragen
+    double wert;
+};
+
+struct Abzug
+{
+    std::map<std::string, std::string> typen; // Familie → counter/gauge/histogram
+    std::vector<Probe> proben;
+    std::string fehler; // leer = gültig
+};
+
+static bool nameGueltig(const std::string &n)
+{
+    if (n.empty() || isdigit((uint8_t)n[0]))
+        return false;
+    for (char c : n)
+        if (!isalnum((uint8_t)c) && c != '_' && c != ':')
+            return false;
+    return true;
+}
+
+static bool zahlLesen(const std::string &text, double &wert)
+{
+    if (text == "NaN" || text == "+Inf" || text == "-Inf")
+    {
+        wert = text == "NaN" ? NAN : text[0] == '+' ? INFINITY : -INFINITY;
+        return true;
+    }
+    char *ende = nullptr;
+    wert = strtod(text.c_str(), &ende);
+    return !text.empty() && *ende == '\0' && !isspace((uint8_t)text[0]);
+}
+
+// Familie einer Probe: bei Verteilungen ohne _bucket/_sum/_count
+static std::string familie(const Abzug &a, const std::string &name)
+{
+    for (const char *endung : {"_bucket", "_sum", "_count"})
+    {
+        size_t n = strlen(endung);
+        if (name.size() > n && name.compare(name.size() - n, n, endung) == 0)
+        {
+            std::string basis = name.substr(0, name.size() - n);
+            auto t = a.typen.find(basis);
+            if (t != a.typen.end() && t->second == "histogram")
+                return basis;
+        }
+    }
+    return name;
+}
+
+// Liest die Antwort wie ein Scraper und prüft das Format
+static Abzug zerlegen(const std::string &text)
+{
+    Abzug a;
+    std::set<std::string> serien;
+    std::string letzteFamilie;
+    if (text.empty() || text.back() != '\n')
+        a.fehler = "Antwort endet nicht mit Zeilenende";
+    size_t pos = 0;
+    while (a.fehler.empty() && pos < text.size())
+    {
+        size_t ende = text.find('\n', pos);
+        std::string zeile = text.substr(pos, ende - pos);
+        pos = ende + 1;
+        if (zeile.empty())
+            continue;
+        if (zeile[0] == '#')
+        {
+            char name[128], typ[32];
+            if (strncmp(zeile.c_str(), "# TYPE ", 7) != 0)
+                continue; // HELP und Kommentare
+            if (sscanf(zeile.c_str(), "# TYPE %127s %31s", name, typ) != 2 || !nameGueltig(name))
+                a.fehler = "ungültige TYPE-Zeile: " + zeile;
+            else if (strcmp(typ, "counter") && strcmp(typ, "gauge") && strcmp(typ, "histogram"))
+                a.fehler = "unbekannter Typ: " + zeile;
+            else if (a.typen.count(name))
+                a.fehler = "TYPE doppelt: " + zeile;
+            else
+                a.typen[name] = typ;
+            letzteFamilie = name;
+            continue;
+        }
+        size_t nameEnde = zeile.find_first_of("{ ");
+        if (nameEnde == std::string::npos)
+        {
+            a.fehler = "Zeile ohne Wert: " + zeile;
+            break;
+        }
+        Probe p;
+        p.name = zeile.substr(0, nameEnde);
+        size_t rest = nameEnde;
+        if (zeile[nameEnde] == '{')
+        {
+            size_t zu = zeile.find('}', nameEnde);
+            if (zu == std::string::npos)
+            {
+                a.fehler = "Label ohne }: " + zeile;
+                break;
+            }
+            p.labels = zeile.substr(nameEnde + 1, zu - nameEnde - 1);
+            // name="wert"[,name="wert"…]
+            size_t i = 0;
+            while (i < p.labels.size())
+            {
+                size_t gleich = p.labels.find('=', i);
+                if (gleich == std::string::npos || !nameGueltig(p.labels.substr(i, gleich - i)) || p.labels[gleich + 1] != '"')
+                    break;
+                size_t anf = p.labels.find('"', gleich + 2);
+                if (anf == std::string::npos)
+                    break;
+                i = anf + 1;
+                if (i < p.labels.size() && p.labels[i] == ',')
+                    i++;
+            }
+            if (i != p.labels.size())
+            {
+                a.fehler = "ungültige Labels: " + zeile;
+                break;
+            }
+            rest = zu + 1;
+        }
+        if (!nameGueltig(p.name) || rest >= zeile.size() || zeile[rest] != ' ' || !zahlLesen(zeile.substr(rest + 1), p.wert))
+        {
+            a.fehler = "ungültige Probe: " + zeile;
+            break;
+        }
+        std::string f = familie(a, p.name);
+        if (!a.typen.count(f) || f != letzteFamilie)
+        {
+            a.fehler = "Probe ohne vorangehende TYPE-Zeile: " + zeile;
+            break;
+        }
+        if (!serien.insert(p.name + "{" + p.labels + "}").second)
+        {
+            a.fehler = "Serie doppelt: " + zeile;
+            break;
+        }
+        a.proben.push_back(p);
+    }
+
+    // Verteilungen: le aufsteigend, kumuliert, zuletzt +Inf, _count = +Inf-Klasse, _sum vorhanden
+    for (const auto &t : a.typen)
+    {
+        if (!a.fehler.empty() || t.second != "histogram")
+            continue;
+        double le = -INFINITY, vorher = 0;
+        bool inf = false, summe = false, anzahl = false;
+        for (const Probe &p : a.proben)
+        {
+            if (p.name == t.first + "_bucket")
+            {
+                double grenze;
+                if (p.labels.compare(0, 4, "le=\"") != 0 || !zahlLesen(p.labels.substr(4, p.labels.size() - 5), grenze) ||
+                    grenze <= le || p.wert < vorher || inf)
+                    a.fehler = "Klassen von " + t.first + " nicht aufsteigend/kumuliert";
+                le = grenze;
+                vorher = p.wert;
+                inf = std::isinf(grenze);
+            }
+            else if (p.name == t.first + "_sum")
+                summe = true;
+            else if (p.name == t.first + "_count")
+            {
+                anzahl = true;
+                if (p.wert != vorher)
+                    a.fehler = t.first + "_count passt nicht zur +Inf-Klasse";
+            }
+        }
+        if (a.fehler.empty() && (!inf || !summe || !anzahl))
+            a.fehler = t.first + ": +Inf, _sum oder _count fehlt";
+    }
+    return a;
+}
+
+static Abzug abrufen(size_t stueck = 1460, std::string *roh = nullptr)
+{
+    AsyncWebServerRequest request;
+    request.stueck = stueck;
+    TEST_ASSERT_TRUE(server.aufrufen("/metrics", request, {}));
+    TEST_ASSERT_NOT_NULL(request.antwort.get());
+    TEST_ASSERT_EQUAL(200, request.antwort->code);
+    TEST_ASSERT_EQUAL_STRING("text/plain; version=0.0.4", request.antwort->typ.c_str());
+    if (roh)
+        *roh = request.antwort->inhalt;
+    Abzug a = zerlegen(request.antwort->inhalt);
+    TEST_ASSERT_TRUE_MESSAGE(a.fehler.empty(), a.fehler.c_str());
+    return a;
+}
+
+static const Probe *finden(const Abzug &a, const std::string &name, const std::string &labels = "")
+{
+    for (const Probe &p : a.proben)
+        if (p.name == name && p.labels == labels)
+            return &p;
+    return nullptr;
+}
+
+static double wertVon(const Abzug &a, const std::string &name, const std::string &labels = "")
+{
+    const Probe *p = finden(a, name, labels);
+    TEST_ASSERT_NOT_NULL_MESSAGE(p, name.c_str());
+    return p->wert;
+}
+
+static void andereStelle()
+{
+    MYDBG_COUNTER(neustarts, 2); // gleicher Name: derselbe Zähler
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_werte_und_typen()
+{
+    for (int i = 0; i < 3; i++)
+        MYDBG_COUNTER(neustarts);
+    andereStelle();
+    MYDBG_COUNTER(bytes_gesendet, 1500);
+    MYDBG_GAUGE(temperatur, 21.5f);
+    MYDBG_GAUGE(temperatur, -3.25f); // letzter Wert zählt
+    MYDBG_GAUGE(ohne_sensor, NAN);
+    MYDBG_GAUGE(ueberlauf, INFINITY);
+    for (float w : {0.5f, 1.0f, 3.0f, 1000.0f, 1e9f})
+        MYDBG_HISTOGRAM(antwort_ms, w);
+
+    Abzug a = abrufen();
+    TEST_ASSERT_EQUAL_STRING("counter", a.typen["neustarts"].c_str());
+    TEST_ASSERT_EQUAL_STRING("gauge", a.typen["temperatur"].c_str());
+    TEST_ASSERT_EQUAL_STRING("histogram", a.typen["antwort_ms"].c_str());
+    TEST_ASSERT_TRUE(wertVon(a, "neustarts") == 5);
+    TEST_ASSERT_TRUE(wertVon(a, "bytes_gesendet") == 1500);
+    TEST_ASSERT_TRUE(wertVon(a, "temperatur") == -3.25);
+    TEST_ASSERT_TRUE(std::isnan(wertVon(a, "ohne_sensor")));
+    TEST_ASSERT_TRUE(std::isinf(wertVon(a, "ueberlauf")) && wertVon(a, "ueberlauf") > 0);
+
+    TEST_ASSERT_TRUE(wertVon(a, "antwort_ms_bucket", "le=\"1\"") == 2);
+    TEST_ASSERT_TRUE(wertVon(a, "antwort_ms_bucket", "le=\"4\"") == 3);
+    TEST_ASSERT_TRUE(wertVon(a, "antwort_ms_bucket", "le=\"1024\"") == 4);
+    TEST_ASSERT_TRUE(wertVon(a, "antwort_ms_bucket", "le=\"+Inf\"") == 5);
+    TEST_ASSERT_TRUE(wertVon(a, "antwort_ms_count") == 5);
+    TEST_ASSERT_TRUE(fabs(wertVon(a, "antwort_ms_sum") - (0.5 + 1 + 3 + 1000 + 1e9)) < 1);
+
+    for (const char *eigene : {"mydbg_uptime_seconds", "mydbg_heap_free_bytes", "mydbg_heap_min_free_bytes", "mydbg_dropped_total"})
+        TEST_ASSERT_NOT_NULL_MESSAGE(finden(a, eigene), eigene);
+}
+
+void test_gleicher_name_anderer_typ_fehlt()
+{
+    MYDBG_GAUGE(neustarts, 99); // Zähler gleichen Namens gibt es schon
+    Abzug a = abrufen();
+    TEST_ASSERT_EQUAL_STRING("counter", a.typen["neustarts"].c_str());
+    TEST_ASSERT_TRUE(wertVon(a, "neustarts") == 5);
+}
+
+void test_stueckgroesse_aendert_nichts()
+{
+    std::string normal, klein, gross;
+    abrufen(1460, &normal);
+    abrufen(1, &klein);
+    abrufen(65536, &gross);
+    // uptime kann zwischen den Abrufen weiterspringen, alles andere muss gleich sein
+    auto ohneUptime = [](std::string s)
+    {
+        size_t p = s.find("\nmydbg_uptime_seconds ");
+        return s.erase(p, s.find('\n', p + 1) - p);
+    };
+    TEST_ASSERT_TRUE(ohneUptime(klein) == ohneUptime(normal));
+    TEST_ASSERT_TRUE(ohneUptime(gross) == ohneUptime(normal));
+}
+
+// Abrufe während andere Threads zählen: immer gültig, Zähler fallen nie, am Ende stimmt die Summe
+void test_abruf_waehrend_gezaehlt_wird()
+{
+    const int threads = 4;
+    const uint32_t jeThread = 200000;
+    std::atomic<bool> laeuft{true};
+    std::vector<std::thread> zaehlend;
+    for (int t = 0; t < threads; t++)
+        zaehlend.emplace_back([&]
+                              {
+            for (uint32_t i = 0; i < jeThread; i++)
+            {
+                MYDBG_COUNTER(schleifen);
+                MYDBG_HISTOGRAM(dauer_us, i % 5000);
+            } });
+    double vorher = 0;
+    uint32_t abrufe = 0;
+    std::thread fertig([&]
+                       {
+        for (std::thread &t : zaehlend)
+            t.join();
+        laeuft = false; });
+    while (laeuft)
+    {
+        Abzug a = abrufen();
+        const Probe *p = finden(a, "schleifen");
+        if (p)
+        {
+            TEST_ASSERT_TRUE(p->wert >= vorher);
+            vorher = p->wert;
+        }
+        abrufe++;
+    }
+    fertig.join();
+    Abzug a = abrufen();
+    TEST_ASSERT_TRUE(wertVon(a, "schleifen") == threads * jeThread);
+    TEST_ASSERT_TRUE(wertVon(a, "dauer_us_count") == threads * jeThread);
+    TEST_ASSERT_GREATER_THAN(0, abrufe);
+}
+
+int main()
+{
+    MYDBG_nativePauseAus = true;
+    MYDBG_addJsonRoutes(server);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_werte_und_typen);
+    RUN_TEST(test_gleicher_name_anderer_typ_fehlt);
+    RUN_TEST(test_stueckgroesse_aendert_nichts);
+    RUN_TEST(test_abruf_waehrend_gezaehlt_wird);
+    int fehler = UNITY_END();
+    LittleFS.aufraeumen();
+    return fehler;
+}
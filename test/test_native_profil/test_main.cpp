@@ -0,0 +1,247 @@
+/*
+  Profiler am PC: Kosten je MYDBG_SCOPE und MYDBG_TIC/MYDBG_TOC, die gesammelten Werte einer Messstelle,
+  auch aus mehreren Threads zugleich, und /mydbg_profile.json über den Platzhalter-Webserver.
+
+    pio test -e native -f test_native_profil
+
+  Der Taktzähler des Platzhalters kommt von steady_clock und ist teurer als auf dem ESP32 (ein Register
+  lesen). Liegt eine Messung hier
+  deutlich unter einer Mikrosekunde, tut sie es auf dem Gerät erst recht.
+*/
+#include <MYDBG.h>
+#include <unity.h>
+
+#include "../mydbg_json_pruefen.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static AsyncWebServer server(80);
+
+static const uint32_t DURCHLAEUFE = 1000000;
+static const double GRENZE_NS = 500; // je Messung, halbe Mikrosekunde
+
+static std::string profilAbrufen(bool leeren = false)
+{
+    AsyncWebServerRequest request;
+    std::map<std::string, std::string> parameter;
+    if (leeren)
+        parameter["reset"] = "1";
+    TEST_ASSERT_TRUE(server.aufrufen("/mydbg_profile.json", request, parameter));
+    TEST_ASSERT_NOT_NULL(request.antwort.get());
+    TEST_ASSERT_EQUAL(200, request.antwort->code);
+    TEST_ASSERT_TRUE_MESSAGE(MYDBG_jsonGueltig(request.antwort->inhalt), request.antwort->inhalt.c_str());
+    return request.antwort->inhalt;
+}
+
+// Objekt der Stelle name aus /mydbg_profile.json, leer wenn es fehlt
+static std::string stelleImJson(const std::string &json, const char *name)
+{
+    size_t pos = json.find(std::string("{\"name\":\"") + name + "\"");
+    if (pos == std::string::npos)
+        return "";
+    return json.substr(pos, json.find("]}", pos) + 2 - pos);
+}
+
+static double zahlFeld(const std::string &stelle, const char *schluessel)
+{
+    std::string muster = std::string("\"") + schluessel + "\":";
+    size_t pos = stelle.find(muster);
+    TEST_ASSERT_TRUE_MESSAGE(pos != std::string::npos, schluessel);
+    return strtod(stelle.c_str() + pos + muster.size(), nullptr);
+}
+
+// Eingetragene Messstelle mit diesem Namen
+static MYDBG_ProfilStelle *stelleSuchen(const char *name)
+{
+    for (MYDBG_ProfilStelle *s = MYDBG_profilListe; s; s = s->naechste)
+        if (strcmp(s->name, name) == 0)
+            return s;
+    return nullptr;
+}
+
+static double nsSeit(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+__attribute__((noinline)) static void leererScope()
+{
+    MYDBG_SCOPE("leer");
+}
+
+__attribute__((noinline)) static void leeresTicToc()
+{
+    MYDBG_TIC(strecke);
+    MYDBG_TOC(strecke);
+}
+
+__attribute__((noinline)) static void ohneMessung()
+{
+    asm volatile("" ::: "memory");
+}
+
+// ns je Aufruf von f, abzüglich des leeren Aufrufs
+static double kostenJeAufruf(void (*f)())
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < DURCHLAEUFE; i++)
+        ohneMessung();
+    double leer = nsSeit(start);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < DURCHLAEUFE; i++)
+        f();
+    return (nsSeit(start) - leer) / DURCHLAEUFE;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_kosten_je_scope()
+{
+    leererScope(); // Stelle eintragen
+    double ns = kostenJeAufruf(leererScope);
+    char text[64];
+    snprintf(text, sizeof(text), "MYDBG_SCOPE: %.1f ns je Messung", ns);
+    TEST_MESSAGE(text);
+    TEST_ASSERT_TRUE_MESSAGE(ns < GRENZE_NS, text);
+}
+
+void test_kosten_je_tic_toc()
+{
+    leeresTicToc();
+    double ns = kostenJeAufruf(leeresTicToc);
+    char text[64];
+    snprintf(text, sizeof(text), "MYDBG_TIC/TOC: %.1f ns je Messung", ns);
+    TEST_MESSAGE(text);
+    TEST_ASSERT_TRUE_MESSAGE(ns < GRENZE_NS, text);
+}
+
+void test_messstelle_sammelt()
+{
+    // delay() rückt mit MYDBG_nativePauseAus nur die Uhr vor: 3 × 1 ms und 1 × 40 ms
+    for (unsigned long ms : {1ul, 1ul, 1ul, 40ul})
+    {
+        MYDBG_TIC(warten);
+        delay(ms);
+        MYDBG_TOC(warten);
+    }
+    MYDBG_ProfilStelle *stelle = stelleSuchen("warten");
+    TEST_ASSERT_NOT_NULL(stelle);
+    MYDBG_ProfilWerte s;
+    MYDBG_profilLesen(*stelle, s);
+    TEST_ASSERT_EQUAL_UINT32(4, s.anzahl);
+    const uint32_t jeMs = 1000 * MYDBG_profilJeUs();
+    TEST_ASSERT_UINT32_WITHIN(jeMs / 10, jeMs, s.min);
+    TEST_ASSERT_UINT32_WITHIN(jeMs / 10, 40 * jeMs, s.max);
+    TEST_ASSERT_TRUE(s.summe > 43ull * jeMs - jeMs / 5 && s.summe < 43ull * jeMs + jeMs / 5);
+
+    uint32_t belegt = 0;
+    for (uint8_t k = 0; k < MYDBG_PROFIL_KLASSEN; k++)
+        belegt += s.klassen[k];
+    TEST_ASSERT_EQUAL_UINT32(4, belegt);
+    TEST_ASSERT_EQUAL_UINT32(3, s.klassen[MYDBG_profilPerzentil(s, 0.5f)]);       // p50: die drei kurzen
+    TEST_ASSERT_TRUE(MYDBG_profilGrenzeUs(MYDBG_profilPerzentil(s, 0.5f)) > 1000); // Obergrenze über 1 ms
+    TEST_ASSERT_TRUE(MYDBG_profilGrenzeUs(MYDBG_profilPerzentil(s, 1.0f)) > 40000);
+}
+
+// Mehrere Tasks auf einer Stelle, während ein weiterer liest: keine Messung geht verloren
+void test_mehrere_tasks()
+{
+    static MYDBG_ProfilStelle stelle = MYDBG_PROFIL_STELLE("parallel");
+    const uint32_t jeTask = 100000;
+    std::atomic<bool> laeuft{true};
+    uint32_t rueckwaerts = 0;
+    std::thread lesend([&]
+                       {
+        MYDBG_ProfilWerte w;
+        uint32_t vorher = 0;
+        while (laeuft)
+        {
+            MYDBG_profilLesen(stelle, w);
+            rueckwaerts += w.anzahl < vorher;
+            vorher = w.anzahl;
+        } });
+    std::vector<std::thread> threads;
+    for (uint32_t t = 1; t <= 4; t++)
+        threads.emplace_back([t]
+                             {
+            for (uint32_t i = 0; i < jeTask; i++)
+                MYDBG_profilErfassen(stelle, t * 1000); });
+    for (std::thread &t : threads)
+        t.join();
+    laeuft = false;
+    lesend.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, rueckwaerts);
+    TEST_ASSERT_TRUE(stelleSuchen("parallel") == &stelle);
+    MYDBG_ProfilWerte s;
+    MYDBG_profilLesen(stelle, s);
+    TEST_ASSERT_EQUAL_UINT32(4 * jeTask, s.anzahl);
+    TEST_ASSERT_EQUAL_UINT32(1000, s.min);
+    TEST_ASSERT_EQUAL_UINT32(4000, s.max);
+    TEST_ASSERT_TRUE(s.summe == 10000ull * jeTask);
+    uint32_t belegt = 0;
+    for (uint8_t k = 0; k < MYDBG_PROFIL_KLASSEN; k++)
+        belegt += s.klassen[k];
+    TEST_ASSERT_EQUAL_UINT32(4 * jeTask, belegt);
+}
+
+void test_profile_json()
+{
+    std::string json = profilAbrufen();
+    TEST_ASSERT_EQUAL(0, json.find("{\"mhz\":"));
+    for (const char *name : {"leer", "strecke", "warten"})
+    {
+        std::string stelle = stelleImJson(json, name);
+        TEST_ASSERT_FALSE_MESSAGE(stelle.empty(), name);
+        TEST_ASSERT_TRUE(zahlFeld(stelle, "count") > 0);
+        TEST_ASSERT_TRUE(zahlFeld(stelle, "min_us") <= zahlFeld(stelle, "avg_us"));
+        TEST_ASSERT_TRUE(zahlFeld(stelle, "avg_us") <= zahlFeld(stelle, "max_us"));
+    }
+    std::string warten = stelleImJson(json, "warten");
+    TEST_ASSERT_EQUAL(4, zahlFeld(warten, "count"));
+    TEST_ASSERT_TRUE(fabs(zahlFeld(warten, "total_us") - 43000) < 500);
+    TEST_ASSERT_TRUE(warten.find("\"func\":\"test_messstelle_sammelt\"") != std::string::npos);
+
+    // ?reset=1 liefert die Werte noch einmal und leert die Stellen danach
+    TEST_ASSERT_EQUAL(4, zahlFeld(stelleImJson(profilAbrufen(true), "warten"), "count"));
+    json = profilAbrufen();
+    for (const char *name : {"leer", "strecke", "warten"})
+    {
+        std::string stelle = stelleImJson(json, name);
+        TEST_ASSERT_FALSE_MESSAGE(stelle.empty(), name); // bleibt eingetragen
+        TEST_ASSERT_EQUAL(0, zahlFeld(stelle, "count"));
+        TEST_ASSERT_TRUE(stelle.find("\"hist\":[]") != std::string::npos);
+    }
+}
+
+void test_zuruecksetzen()
+{
+    leererScope();
+    MYDBG_profilZuruecksetzen();
+    for (MYDBG_ProfilStelle *s = MYDBG_profilListe; s; s = s->naechste)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0, s->anzahl);
+        TEST_ASSERT_TRUE(s->summe == 0);
+    }
+}
+
+int main()
+{
+    MYDBG_nativePauseAus = true;
+    MYDBG_initFilesystem();
+    MYDBG_addJsonRoutes(server);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_kosten_je_scope);
+    RUN_TEST(test_kosten_je_tic_toc);
+    RUN_TEST(test_messstelle_sammelt);
+    RUN_TEST(test_mehrere_tasks);
+    RUN_TEST(test_profile_json);
+    RUN_TEST(test_zuruecksetzen);
+    int fehler = UNITY_END();
+    LittleFS.aufraeumen();
+    return fehler;
+}
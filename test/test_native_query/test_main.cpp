@@ -0,0 +1,178 @@
+/*
+  /mydbg_query und /mydbg_data.json über den Platzhalter-Webserver: jede NDJSON-Zeile und das ganze
+  Dokument müssen gültiges JSON sein, auch mit Einträgen der größtmöglichen Länge und unabhängig davon,
+  in wie großen Stücken der Server die Chunked-Antwort abholt.
+
+    pio test -e native -f test_native_query
+*/
+#include <MYDBG.h>
+#include <unity.h>
+
+#include "../mydbg_json_pruefen.h"
+
+#include <vector>
+
+static AsyncWebServer server(80);
+
+static MYDBG_Site schleife = {"loop", "Schleife", "i", 10, 0, 0, 0, nullptr, {}};
+static MYDBG_Site start = {"setup", "Start", "i", 20, 0, 0, 0, nullptr, {}};
+static char langeFunc[MYDBG_SITE_TEXT_MAX + 1], langeMsg[MYDBG_SITE_TEXT_MAX + 1], langerName[MYDBG_SITE_TEXT_MAX + 1];
+static MYDBG_Site lang = {langeFunc, langeMsg, langerName, 65535, 0, 0, 0, nullptr, {}};
+
+static const uint32_t ANZAHL = 300; // Einträge von schleife und start im Wechsel
+static uint32_t erstesSeq = 0;
+
+struct Antwort
+{
+    int code;
+    std::string typ;
+    std::string inhalt;
+};
+
+static Antwort abrufen(const char *pfad, std::map<std::string, std::string> parameter = {}, size_t stueck = 1460)
+{
+    AsyncWebServerRequest request;
+    request.stueck = stueck;
+    TEST_ASSERT_TRUE(server.aufrufen(pfad, request, parameter));
+    TEST_ASSERT_NOT_NULL(request.antwort.get());
+    return {request.antwort->code, request.antwort->typ, request.antwort->inhalt};
+}
+
+// Zerlegt NDJSON in Zeilen; jede muss mit '\n' enden und ein gültiges JSON-Objekt sein
+static std::vector<std::string> zeilen(const std::string &ndjson)
+{
+    std::vector<std::string> ergebnis;
+    size_t pos = 0;
+    while (pos < ndjson.size())
+    {
+        size_t ende = ndjson.find('\n', pos);
+        TEST_ASSERT_TRUE_MESSAGE(ende != std::string::npos, "letzte Zeile ohne Zeilenende");
+        std::string zeile = ndjson.substr(pos, ende - pos);
+        TEST_ASSERT_TRUE_MESSAGE(MYDBG_jsonGueltig(zeile) && zeile[0] == '{', zeile.c_str());
+        ergebnis.push_back(zeile);
+        pos = ende + 1;
+    }
+    return ergebnis;
+}
+
+static uint32_t zahlFeld(const std::string &zeile, const char *schluessel)
+{
+    std::string muster = std::string("\"") + schluessel + "\":";
+    size_t pos = zeile.find(muster);
+    TEST_ASSERT_TRUE_MESSAGE(pos != std::string::npos, schluessel);
+    return strtoul(zeile.c_str() + pos + muster.size(), nullptr, 10);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_ndjson_zeilen_sind_gueltig()
+{
+    Antwort a = abrufen("/mydbg_query");
+    TEST_ASSERT_EQUAL(200, a.code);
+    TEST_ASSERT_EQUAL_STRING("application/x-ndjson", a.typ.c_str());
+    std::vector<std::string> z = zeilen(a.inhalt);
+    TEST_ASSERT_EQUAL(MYDBG_QUERY_LIMIT, z.size());
+    for (size_t i = 1; i < z.size(); i++)
+        TEST_ASSERT_EQUAL_UINT32(zahlFeld(z[i - 1], "seq") + 1, zahlFeld(z[i], "seq")); // älteste zuerst, lückenlos
+}
+
+void test_stueckgroesse_aendert_nichts()
+{
+    std::map<std::string, std::string> alle = {{"limit", "1000"}};
+    std::string normal = abrufen("/mydbg_query", alle).inhalt;
+    TEST_ASSERT_EQUAL(ANZAHL + 3, zeilen(normal).size());
+    for (size_t stueck : {1, 7, 100, 65536})
+        TEST_ASSERT_TRUE_MESSAGE(abrufen("/mydbg_query", alle, stueck).inhalt == normal, "Antwort hängt von der Stückgröße ab");
+}
+
+void test_filter()
+{
+    std::vector<std::string> z = zeilen(abrufen("/mydbg_query", {{"since_seq", std::to_string(erstesSeq + ANZAHL - 11)}}).inhalt);
+    TEST_ASSERT_EQUAL(13, z.size()); // die letzten zehn plus drei lange
+    TEST_ASSERT_EQUAL_UINT32(erstesSeq + ANZAHL - 10, zahlFeld(z[0], "seq"));
+
+    z = zeilen(abrufen("/mydbg_query", {{"func", "setup"}, {"limit", "1000"}}).inhalt);
+    TEST_ASSERT_EQUAL(ANZAHL / 2, z.size());
+    for (const std::string &zeile : z)
+        TEST_ASSERT_TRUE(zeile.find("\"pgmFunc\":\"setup\"") != std::string::npos);
+
+    z = zeilen(abrufen("/mydbg_query", {{"line", "10"}, {"level", "5"}, {"limit", "1000"}}).inhalt);
+    TEST_ASSERT_GREATER_THAN(0, z.size());
+    for (const std::string &zeile : z)
+    {
+        TEST_ASSERT_EQUAL_UINT32(10, zahlFeld(zeile, "pgmZeile"));
+        TEST_ASSERT_GREATER_OR_EQUAL(5, zahlFeld(zeile, "level"));
+    }
+
+    TEST_ASSERT_EQUAL(5, zeilen(abrufen("/mydbg_query", {{"limit", "5"}}).inhalt).size());
+    TEST_ASSERT_EQUAL(0, zeilen(abrufen("/mydbg_query", {{"since_seq", "4000000000"}}).inhalt).size());
+}
+
+void test_ungueltiger_parameter()
+{
+    for (const char *name : {"limit", "since_seq", "level", "line"})
+    {
+        Antwort a = abrufen("/mydbg_query", {{name, "x"}});
+        TEST_ASSERT_EQUAL(400, a.code);
+        TEST_ASSERT_TRUE_MESSAGE(MYDBG_jsonGueltig(a.inhalt), a.inhalt.c_str());
+    }
+}
+
+void test_laengste_eintraege_bleiben_gueltig()
+{
+    std::vector<std::string> z = zeilen(abrufen("/mydbg_query", {{"line", "65535"}}).inhalt);
+    TEST_ASSERT_EQUAL(3, z.size());
+    for (const std::string &zeile : z)
+    {
+        TEST_ASSERT_TRUE(zeile.find("\"heap_free\":") != std::string::npos); // Gesundheit angehängt
+        TEST_ASSERT_LESS_THAN(MYDBG_CHUNK_ZEILE, zeile.size() + 1);
+    }
+}
+
+void test_data_json_ist_gueltig()
+{
+    for (size_t stueck : {1460, 3})
+    {
+        Antwort a = abrufen("/mydbg_data.json", {}, stueck);
+        TEST_ASSERT_EQUAL(200, a.code);
+        TEST_ASSERT_TRUE_MESSAGE(MYDBG_jsonGueltig(a.inhalt), "/mydbg_data.json ist kein gültiges JSON");
+        TEST_ASSERT_EQUAL(0, a.inhalt.find("{\"log\":[{"));
+    }
+}
+
+int main()
+{
+    MYDBG_nativePauseAus = true;
+    MYDBG_rateProS = 0; // keine Drosselung
+    MYDBG_wiederholungMs = 0;
+    MYDBG_initFilesystem();
+    MYDBG_prepareJsonFiles();
+    MYDBG_addJsonRoutes(server);
+    MYDBG_zeitSynchronisiert(nullptr);
+
+    for (uint32_t i = 0; i < ANZAHL; i++)
+    {
+        MYDBG_erfassen(i % 2 ? start : schleife, MYDBG_FLAG_STOP, 1 + i % 9, MYDBG_wert((int)i));
+        if (i == 0)
+            erstesSeq = MYDBG_status.rec.seq;
+    }
+
+    // Texte, die beim Escapen am stärksten wachsen; ein Wert mit 7 Steuerzeichen lässt noch Platz für Heap/Stack
+    memset(langeFunc, '"', MYDBG_SITE_TEXT_MAX);
+    memset(langeMsg, '\x01', MYDBG_SITE_TEXT_MAX);
+    memset(langerName, '\\', MYDBG_SITE_TEXT_MAX);
+    for (int i = 0; i < 3; i++)
+        MYDBG_erfassen(lang, MYDBG_FLAG_STOP, 9, MYDBG_wert("\x02\x02\x02\x02\x02\x02\x02"));
+
+    UNITY_BEGIN();
+    RUN_TEST(test_ndjson_zeilen_sind_gueltig);
+    RUN_TEST(test_stueckgroesse_aendert_nichts);
+    RUN_TEST(test_filter);
+    RUN_TEST(test_ungueltiger_parameter);
+    RUN_TEST(test_laengste_eintraege_bleiben_gueltig);
+    RUN_TEST(test_data_json_ist_gueltig);
+    int fehler = UNITY_END();
+    LittleFS.aufraeumen();
+    return fehler;
+}
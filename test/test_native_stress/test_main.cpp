@@ -0,0 +1,204 @@
+/*
+  Mehrere Tasks gleichzeitig: Erzeuger-Threads schreiben über MYDBG_erfassen in den Log-Speicher, während
+  andere Threads wie der Webserver-Task /mydbg_query abrufen, /mydbg_delete_logs auslösen, das Budget ändern
+  und das Log auf der Konsole ausgeben. Kein Eintrag darf verloren gehen oder zerrissen ankommen, jede Antwort
+  muss gültiges NDJSON mit lückenlosen Sequenznummern sein. Die Ausgabe zeigt den Durchsatz je Erzeugerzahl.
+
+    pio test -e native -f test_native_stress
+*/
+#include <MYDBG.h>
+#include <unity.h>
+
+#include "../mydbg_json_pruefen.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static AsyncWebServer server(80);
+
+static const int MAX_ERZEUGER = 8;
+static const uint32_t JE_ERZEUGER = 400;
+
+static char namen[MAX_ERZEUGER][8];
+static MYDBG_Site stellen[MAX_ERZEUGER];
+
+static std::atomic<bool> laeuft{false};
+static std::atomic<uint32_t> fehlerZaehler{0};
+static std::atomic<uint32_t> loeschungen{0};
+
+struct Eintrag
+{
+    uint32_t seq, zeile, wert;
+};
+
+static uint32_t zahlFeld(const std::string &zeile, const char *schluessel, bool text = false)
+{
+    std::string muster = std::string("\"") + schluessel + (text ? "\":\"" : "\":");
+    size_t pos = zeile.find(muster);
+    return pos == std::string::npos ? UINT32_MAX : strtoul(zeile.c_str() + pos + muster.size(), nullptr, 10);
+}
+
+// Ruft /mydbg_query ab und zerlegt die Antwort; false, wenn eine Zeile kein gültiges JSON ist oder Nummern springen
+static bool abfragen(std::vector<Eintrag> &eintraege, std::map<std::string, std::string> parameter)
+{
+    AsyncWebServerRequest request;
+    if (!server.aufrufen("/mydbg_query", request, parameter) || !request.antwort || request.antwort->code != 200)
+        return false;
+    const std::string &ndjson = request.antwort->inhalt;
+    eintraege.clear();
+    size_t pos = 0;
+    while (pos < ndjson.size())
+    {
+        size_t ende = ndjson.find('\n', pos);
+        if (ende == std::string::npos)
+            return false;
+        std::string zeile = ndjson.substr(pos, ende - pos);
+        if (!MYDBG_jsonGueltig(zeile))
+            return false;
+        Eintrag e = {zahlFeld(zeile, "seq"), zahlFeld(zeile, "pgmZeile"), zahlFeld(zeile, "varValue", true)};
+        if (!eintraege.empty() && e.seq != eintraege.back().seq + 1)
+            return false;
+        eintraege.push_back(e);
+        pos = ende + 1;
+    }
+    return true;
+}
+
+static void erzeuger(int nr, uint32_t anzahl)
+{
+    for (uint32_t i = 0; i < anzahl; i++)
+        MYDBG_erfassen(stellen[nr], MYDBG_FLAG_STOP, 1, MYDBG_wert((int)i));
+}
+
+// Liest, solange die Erzeuger laufen; jede Antwort muss für sich stimmig sein
+static void leser()
+{
+    std::vector<Eintrag> e;
+    while (laeuft)
+    {
+        if (!abfragen(e, {{"limit", "200"}}))
+            fehlerZaehler++;
+        std::this_thread::yield();
+    }
+}
+
+void setUp()
+{
+    fehlerZaehler = 0;
+}
+void tearDown() {}
+
+// Ohne Löschen: alle Einträge aller Erzeuger kommen vollständig, in Reihenfolge und unversehrt an
+void test_kein_eintrag_geht_verloren()
+{
+    for (int anzahl : {1, 2, 4, 8})
+    {
+        MYDBG_resetJsonFiles();
+        std::vector<Eintrag> e;
+        TEST_ASSERT_TRUE(abfragen(e, {}));
+        TEST_ASSERT_EQUAL(0, e.size());
+        const uint32_t ersteSeq = MYDBG_ring.nextSeq;
+
+        laeuft = true;
+        std::thread lesend(leser);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < anzahl; t++)
+            threads.emplace_back(erzeuger, t, JE_ERZEUGER);
+        for (std::thread &t : threads)
+            t.join();
+        double sekunden = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        laeuft = false;
+        lesend.join();
+
+        char text[96];
+        snprintf(text, sizeof(text), "%d Erzeuger: %.0f Einträge/s gesamt, %.0f je Erzeuger", anzahl,
+                 anzahl * JE_ERZEUGER / sekunden, JE_ERZEUGER / sekunden);
+        TEST_MESSAGE(text);
+        TEST_ASSERT_EQUAL_MESSAGE(0, fehlerZaehler.load(), "Antwort während des Schreibens ungültig");
+
+        TEST_ASSERT_TRUE(abfragen(e, {{"limit", "100000"}}));
+        TEST_ASSERT_EQUAL(anzahl * JE_ERZEUGER, e.size());
+        TEST_ASSERT_EQUAL_UINT32(ersteSeq, e[0].seq);
+        uint32_t naechster[MAX_ERZEUGER] = {};
+        for (const Eintrag &x : e)
+        {
+            int nr = (int)x.zeile - 100;
+            TEST_ASSERT_TRUE_MESSAGE(nr >= 0 && nr < anzahl, "fremde Zeile");
+            TEST_ASSERT_EQUAL_UINT32(naechster[nr], x.wert); // je Erzeuger lückenlos und in Reihenfolge
+            naechster[nr]++;
+        }
+    }
+}
+
+// Löschen, Budget und Konsolenausgabe mitten im Schreiben: nichts hängt oder stürzt ab, jede Antwort bleibt stimmig
+void test_loeschen_waehrend_des_schreibens()
+{
+    const int anzahl = 4;
+    laeuft = true;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < anzahl; t++)
+        threads.emplace_back(erzeuger, t, JE_ERZEUGER * 50); // einige hundert Millisekunden
+    std::thread lesend(leser);
+    std::thread loeschend([]
+                          {
+        while (laeuft)
+        {
+            AsyncWebServerRequest request;
+            if (!server.aufrufen("/mydbg_delete_logs", request, {}) || !request.antwort || request.antwort->code != 200)
+                fehlerZaehler++;
+            loeschungen++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        } });
+    std::thread verwaltend([]
+                           {
+        uint8_t prozent = 5;
+        while (laeuft)
+        {
+            MYDBG_setzeLogBudget(prozent);
+            prozent = prozent == 5 ? 30 : 5;
+            MYDBG_displayJsonLogs();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } });
+    for (std::thread &t : threads)
+        t.join();
+    laeuft = false;
+    lesend.join();
+    loeschend.join();
+    verwaltend.join();
+    TEST_ASSERT_EQUAL_MESSAGE(0, fehlerZaehler.load(), "Antwort während Löschen/Budget ungültig");
+    TEST_ASSERT_GREATER_THAN(10, loeschungen.load()); // Löschen lief wirklich mitten im Schreiben
+
+    // Danach ist der Speicher in sich stimmig, auch frisch eingelesen
+    MYDBG_ringInit();
+    std::vector<Eintrag> e;
+    TEST_ASSERT_TRUE(abfragen(e, {{"limit", "100000"}}));
+    TEST_ASSERT_EQUAL(MYDBG_ring.nextSeq - MYDBG_ring.ersteSeq, e.size());
+    erzeuger(0, 1);
+    TEST_ASSERT_TRUE(abfragen(e, {{"limit", "100000"}}));
+    TEST_ASSERT_TRUE(e.size() > 0);
+    TEST_ASSERT_EQUAL_UINT32(MYDBG_ring.nextSeq - 1, e.back().seq);
+}
+
+int main()
+{
+    MYDBG_nativePauseAus = true;
+    MYDBG_rateProS = 0; // keine Drosselung
+    MYDBG_wiederholungMs = 0;
+    MYDBG_initFilesystem();
+    MYDBG_prepareJsonFiles();
+    MYDBG_addJsonRoutes(server);
+    for (int t = 0; t < MAX_ERZEUGER; t++)
+    {
+        snprintf(namen[t], sizeof(namen[t]), "t%d", t);
+        stellen[t] = {"erzeuger", namen[t], "i", (uint16_t)(100 + t), 0, 0, 0, nullptr, {}};
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_kein_eintrag_geht_verloren);
+    RUN_TEST(test_loeschen_waehrend_des_schreibens);
+    int fehler = UNITY_END();
+    LittleFS.aufraeumen();
+    return fehler;
+}
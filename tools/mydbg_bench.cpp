@@ -0,0 +1,270 @@
+/*
+  MYDBG Benchmark: misst die heißen Pfade von include/MYDBG.h am PC (Host-Build, platformio.ini: [env:native]).
+
+  Je Messung: Nanosekunden, Heap-Anforderungen und Heap-Bytes je Aufruf sowie die dabei ins Dateisystem,
+  auf die Konsole und über den WebSocket geschriebenen Bytes und WebSocket-Frames. Heap-Anforderungen der
+  Platzhalter selbst (Pfade im LittleFS-Ersatz, Mitschnitt der WebSocket-Clients) stehen getrennt in
+  stub_allocs_per_call und nicht in allocs_per_call. Gemessen werden
+    - Formatierung               eine Stop-Zeile bauen: param 0 = String-Verkettung wie vor MYDBG_Zeile,
+                                 param 1 = MYDBG_Zeile<> auf dem Stack (heutiger Weg)
+    - MYDBG_SCOPE                eine leere Messstelle des Profilers: param 0 = MYDBG_SCOPE, 1 = MYDBG_TIC/MYDBG_TOC
+    - MYDBG(0, ...)              nur Konsole
+    - MYDBG(1, ...)              volle Ausgabe, die Pause wird übersprungen (die simulierte Uhr läuft trotzdem weiter)
+    - MYDBG_ASYNC                nur im Build mit MYDBG_ASYNC ([env:native_async]) und dort statt MYDBG(0)/MYDBG(1):
+                                 was der Aufrufer bezahlt, param 0 = MYDBG(0, ...), 1 = MYDBG(1, ...). Gemessen wird in
+                                 Schüben, die in den Eintragspuffer passen; geleert wird er zwischen den Schüben außerhalb
+                                 der Zeitmessung. Heap und geschriebene Bytes enthalten die Ausgabe, die Zeit nicht.
+    - MYDBG_logToJson            Anhängen an den Ringpuffer, während das Log auf 100/1000/10000 Einträge wächst
+    - MYDBG_streamWebLineJSON    WebSocket-Eintrag an einen verbundenen Client, param 0 = JSON, 1 = MessagePack
+                                 (FORMAT_MSGPACK); Bytes und Frames je Eintrag zeigen den Unterschied auf der Leitung
+    - MYDBG_displayJsonLogs      Ausgabe des Logs mit 100/1000/10000 Einträgen (angezeigt werden höchstens MYDBG_MAX_LOGFILES)
+  Arduino, LittleFS, WLAN, Webserver und ESP-IDF ersetzen die Platzhalter in tools/native/; LittleFS liegt
+  in einem frischen Verzeichnis unter /tmp, das am Ende gelöscht wird.
+
+  Die Ergebnisse gehen als JSON auf stdout, zum Vergleich zweier Stände:
+    pio run -e native -t exec > vorher.json      (oder den Build direkt übersetzen, s. u.)
+    ... Änderung ...
+    pio run -e native -t exec > nachher.json
+    python3 tools/mydbg_bench_vergleich.py vorher.json nachher.json
+  Mit MYDBG_ASYNC (Ausgabe-Task statt Ausgabe im Aufrufer):
+    pio run -e native_async -t exec > async.json
+
+  Ohne PlatformIO übersetzen und starten (ArduinoJson 7 liegt z. B. unter .pio/libdeps/native/ArduinoJson/src):
+    g++ -O2 -std=gnu++17 -I tools/native -I include -I <ArduinoJson>/src tools/mydbg_bench.cpp -o mydbg_bench -lpthread
+    ./mydbg_bench [Mindestdauer je Messung in ms, Vorgabe 300]
+  (für den Build mit Ausgabe-Task zusätzlich -D MYDBG_ASYNC)
+
+  Die Werte gelten für den PC; auf dem ESP32 (240 MHz, Flash statt SSD) liegen die Zeiten deutlich höher,
+  Heap-Anforderungen und geschriebene Bytes sind dagegen dieselben.
+*/
+#include <MYDBG.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+// === Heap-Zähler ===
+static std::atomic<uint64_t> heapAnforderungen{0};
+static std::atomic<uint64_t> heapBytes{0};
+static std::atomic<uint64_t> platzhalterAnforderungen{0}; // aus tools/native/ (MYDBG_NativeIntern)
+
+static void zaehlen(size_t groesse)
+{
+    if (MYDBG_nativeIntern > 0)
+    {
+        platzhalterAnforderungen.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    heapAnforderungen.fetch_add(1, std::memory_order_relaxed);
+    heapBytes.fetch_add(groesse, std::memory_order_relaxed);
+} // Ende der Funktion zaehlen
+
+// Alle new-Varianten fordern über anfordern() an, alle delete-Varianten (auch sized und nothrow) geben mit free()
+// frei. Alle noinline: Setzt GCC eine Seite an der Aufrufstelle ein, sieht es z. B. malloc() neben operator delete[]
+// oder operator new neben free() und warnt (-Wmismatched-new-delete).
+static void *anfordern(size_t groesse)
+{
+    zaehlen(groesse);
+    return malloc(groesse ? groesse : 1);
+} // Ende der Funktion anfordern
+
+__attribute__((noinline)) void *operator new(size_t groesse)
+{
+    if (void *p = anfordern(groesse))
+        return p;
+    throw std::bad_alloc();
+} // Ende der Funktion operator new
+
+__attribute__((noinline)) void *operator new[](size_t groesse)
+{
+    if (void *p = anfordern(groesse))
+        return p;
+    throw std::bad_alloc();
+} // Ende der Funktion operator new[]
+
+__attribute__((noinline)) void *operator new(size_t groesse, const std::nothrow_t &) noexcept { return anfordern(groesse); }
+__attribute__((noinline)) void *operator new[](size_t groesse, const std::nothrow_t &) noexcept { return anfordern(groesse); }
+__attribute__((noinline)) void operator delete(void *p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete[](void *p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void *p, size_t) noexcept { free(p); }
+__attribute__((noinline)) void operator delete[](void *p, size_t) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void *p, const std::nothrow_t &) noexcept { free(p); }
+__attribute__((noinline)) void operator delete[](void *p, const std::nothrow_t &) noexcept { free(p); }
+
+// === Messen ===
+struct Stand
+{
+    uint64_t anforderungen, bytes, platzhalter, fs, serial, ws, wsFrames;
+}; // Ende der Struktur Stand
+
+static AsyncWebSocketClient *wsClient = nullptr;
+
+static Stand standJetzt()
+{
+    return {heapAnforderungen.load(), heapBytes.load(), platzhalterAnforderungen.load(), LittleFS.geschrieben.load(), Serial.geschrieben.load(),
+            wsClient ? wsClient->bytes : 0, wsClient ? wsClient->frames : 0};
+} // Ende der Funktion standJetzt
+
+static double sekundenSeit(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+} // Ende der Funktion sekundenSeit
+
+static bool ersteZeile = true;
+
+// Eine Zeile des JSON-Ergebnisses
+static void ausgeben(const char *name, long param, uint64_t aufrufe, double sekunden, const Stand &vor, const Stand &nach)
+{
+    double n = aufrufe ? (double)aufrufe : 1.0;
+    printf("%s\n    {\"name\": \"%s\", \"param\": %ld, \"calls\": %llu, \"ns_per_call\": %.1f, \"allocs_per_call\": %.3f, "
+           "\"alloc_bytes_per_call\": %.1f, \"stub_allocs_per_call\": %.3f, \"fs_bytes_per_call\": %.1f, \"serial_bytes_per_call\": %.1f, "
+           "\"ws_bytes_per_call\": %.1f, \"ws_frames_per_call\": %.4f}",
+           ersteZeile ? "" : ",", name, param, (unsigned long long)aufrufe, sekunden * 1e9 / n, (nach.anforderungen - vor.anforderungen) / n,
+           (nach.bytes - vor.bytes) / n, (nach.platzhalter - vor.platzhalter) / n, (nach.fs - vor.fs) / n, (nach.serial - vor.serial) / n, (nach.ws - vor.ws) / n,
+           (nach.wsFrames - vor.wsFrames) / n);
+    ersteZeile = false;
+    fflush(stdout);
+} // Ende der Funktion ausgeben
+
+// Ruft schritt() so oft auf, bis mindestens mindestS Sekunden vergangen sind (Zeit nur alle 64 Aufrufe abfragen)
+static void messenDauer(const char *name, long param, double mindestS, const std::function<void()> &schritt)
+{
+    schritt(); // Aufwärmen: Aufrufstelle registrieren, Dateien öffnen
+    uint64_t aufrufe = 0;
+    Stand vor = standJetzt();
+    auto start = std::chrono::steady_clock::now();
+    do
+    {
+        for (int i = 0; i < 64; i++)
+            schritt();
+        aufrufe += 64;
+    } while (sekundenSeit(start) < mindestS);
+    double sekunden = sekundenSeit(start);
+    ausgeben(name, param, aufrufe, sekunden, vor, standJetzt());
+} // Ende der Funktion messenDauer
+
+// Ruft schritt() genau anzahl-mal auf
+static void messenAnzahl(const char *name, long param, uint64_t anzahl, const std::function<void()> &schritt)
+{
+    Stand vor = standJetzt();
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < anzahl; i++)
+        schritt();
+    double sekunden = sekundenSeit(start);
+    ausgeben(name, param, anzahl, sekunden, vor, standJetzt());
+} // Ende der Funktion messenAnzahl
+
+#ifdef MYDBG_ASYNC
+// Nur der Aufrufer: je Schub so viele Aufrufe, wie der Eintragspuffer eines Kerns fasst, danach leert der Benchmark
+// den Puffer selbst, außerhalb der Zeitmessung. Sonst liefe er über – der Ausgabe-Task wacht am PC erst nach bis zu
+// 50 ms auf – und gemessen würde das Verwerfen des ältesten Eintrags. Der Benchmark hält dabei MYDBG_Sperre, damit
+// der Ausgabe-Task nicht mitten in einem Schub auf demselben Rechenkern ausgibt.
+static void messenSchuebe(const char *name, long param, double mindestS, const std::function<void()> &schritt)
+{
+    MYDBG_Sperre sperre;
+    schritt(); // Aufwärmen: Aufrufstelle registrieren, Ausgabe-Task starten
+    MYDBG_pufferLeeren();
+    const uint32_t verworfen = MYDBG_verworfen;
+    uint64_t aufrufe = 0;
+    double sekunden = 0;
+    Stand vor = standJetzt();
+    auto beginn = std::chrono::steady_clock::now();
+    do
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < MYDBG_QUEUE_LAENGE; i++)
+            schritt();
+        sekunden += sekundenSeit(start);
+        aufrufe += MYDBG_QUEUE_LAENGE;
+        MYDBG_pufferLeeren();
+    } while (sekundenSeit(beginn) < mindestS);
+    ausgeben(name, param, aufrufe, sekunden, vor, standJetzt());
+    if (MYDBG_verworfen != verworfen)
+        fprintf(stderr, "%s %ld: %u Einträge verworfen, die Zeit enthält das Verwerfen\n", name, param,
+                (unsigned)(MYDBG_verworfen - verworfen));
+} // Ende der Funktion messenSchuebe
+#endif
+
+int main(int argc, char **argv)
+{
+    long mindestMs = argc > 1 ? strtol(argv[1], nullptr, 10) : 300;
+    if (mindestMs <= 0)
+        mindestMs = 300;
+    const double mindestS = mindestMs / 1000.0;
+
+    MYDBG_nativePauseAus = true; // MYDBG(n, ...) ohne Pause
+    MYDBG_rateProS = 0;          // keine Drosselung, jeder Aufruf wird ausgegeben
+    MYDBG_wiederholungMs = 0;    // gleiche Werte nicht zusammenfassen
+
+    int zaehler = 0;
+    MYDBG(0, "Start", zaehler); // Dateisystem, Ringpuffer und Web-Debug einrichten
+    wsClient = MYDBG_ws.verbinden(1);
+
+    printf("{\n  \"compiler\": \"%s\",\n  \"min_ms\": %ld,\n  \"results\": [", __VERSION__, mindestMs);
+
+    // Die Stop-Zeile aus MYDBG_stopAusgabe, einmal wie früher mit String und einmal mit MYDBG_Zeile<>
+    MYDBG_Klartext k;
+    MYDBG_klartext(MYDBG_status.rec, k);
+    char zeit[30];
+    MYDBG_formatZeit(MYDBG_unixZeit(MYDBG_status.rec), zeit, sizeof(zeit));
+    uint32_t ms = millis();
+    volatile size_t laenge = 0;
+    messenDauer("Formatierung", 0, mindestS, [&]
+                {
+        String ausgabe = "[MYDBG] > " + String(k.zeile) + " | " + k.func + "() | " + zeit + " | " + String(ms) + " | " + k.msg +
+                         " | " + k.varName + " = " + k.varValue;
+        laenge = laenge + ausgabe.length(); });
+    messenDauer("Formatierung", 1, mindestS, [&]
+                {
+        MYDBG_Zeile<> ausgabe;
+        ausgabe << "[MYDBG] > " << k.zeile << " | " << k.func << "() | " << zeit << " | " << ms << " | " << k.msg << " | "
+                << k.varName << " = " << k.varValue;
+        laenge = laenge + ausgabe.laenge; });
+
+    messenDauer("MYDBG_SCOPE", 0, mindestS, []
+                { MYDBG_SCOPE("bench"); });
+    messenDauer("MYDBG_SCOPE", 1, mindestS, []
+                {
+        MYDBG_TIC(bench);
+        MYDBG_TOC(bench); });
+
+#ifdef MYDBG_ASYNC
+    messenSchuebe("MYDBG_ASYNC", 0, mindestS, [&]
+                  { MYDBG(0, "Zähler", zaehler); zaehler++; });
+    messenSchuebe("MYDBG_ASYNC", 1, mindestS, [&]
+                  { MYDBG(1, "Zähler", zaehler); zaehler++; });
+    MYDBG_pufferLeeren();
+#else
+    messenDauer("MYDBG(0)", 0, mindestS, [&]
+                { MYDBG(0, "Zähler", zaehler); zaehler++; });
+    messenDauer("MYDBG(1)", 1, mindestS, [&]
+                { MYDBG(1, "Zähler", zaehler); zaehler++; });
+#endif
+
+    MYDBG_LogRecord rec = MYDBG_status.rec; // zuletzt von MYDBG(1, ...) ausgegebener Eintrag
+    messenDauer("MYDBG_streamWebLineJSON", 0, mindestS, [&]
+                { MYDBG_streamWebLineJSON(rec); });
+    MYDBG_wsSenden();
+    MYDBG_ws.trennen(1);
+    wsClient = MYDBG_ws.verbinden(2);
+    MYDBG_ws.empfangen(2, "FORMAT_MSGPACK"); // wie die Webseite
+    messenDauer("MYDBG_streamWebLineJSON", 1, mindestS, [&]
+                { MYDBG_streamWebLineJSON(rec); });
+    MYDBG_wsSenden();
+
+    for (long groesse : {100L, 1000L, 10000L})
+    {
+        MYDBG_deleteJsonLogs();
+        MYDBG_ringInit();
+        messenAnzahl("MYDBG_logToJson", groesse, groesse, [&]
+                     { rec.wert.i = zaehler++; MYDBG_logToJson(rec); });
+        messenDauer("MYDBG_displayJsonLogs", groesse, mindestS, []
+                    { MYDBG_displayJsonLogs(); });
+    }
+
+    printf("\n  ]\n}\n");
+    LittleFS.aufraeumen();
+    return 0;
+} // Ende der Funktion main
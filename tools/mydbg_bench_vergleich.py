@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""MYDBG Benchmark-Vergleich: stellt zwei Ergebnisse von tools/mydbg_bench.cpp gegenüber.
+
+Zeilen werden über name und param zugeordnet. Zeiten schwanken auf dem PC um einige
+Prozent; Heap-Anforderungen und geschriebene Bytes sind reproduzierbar und zeigen
+Änderungen am Verhalten sofort.
+
+Beispiel:
+  python3 tools/mydbg_bench_vergleich.py vorher.json nachher.json
+  python3 tools/mydbg_bench_vergleich.py vorher.json nachher.json --schwelle 10
+"""
+
+import argparse
+import json
+
+SPALTEN = [
+    ("ns_per_call", "ns"),
+    ("allocs_per_call", "allocs"),
+    ("alloc_bytes_per_call", "heap B"),
+    ("stub_allocs_per_call", "stub allocs"),
+    ("fs_bytes_per_call", "fs B"),
+    ("serial_bytes_per_call", "serial B"),
+    ("ws_bytes_per_call", "ws B"),
+    ("ws_frames_per_call", "ws Frames"),
+]
+
+
+def laden(pfad):
+    with open(pfad, encoding="utf-8") as f:
+        ergebnisse = json.load(f)["results"]
+    for e in ergebnisse:
+        for spalte, _ in SPALTEN:
+            e.setdefault(spalte, 0)  # ältere Ergebnisse ohne diese Spalte
+    return {(e["name"], e["param"]): e for e in ergebnisse}
+
+
+def aenderung(alt, neu):
+    if alt == neu:
+        return "="
+    if alt == 0:
+        return "neu"
+    return "%+.0f%%" % ((neu - alt) * 100.0 / alt)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Vergleicht zwei Ergebnisse von mydbg_bench")
+    parser.add_argument("vorher")
+    parser.add_argument("nachher")
+    parser.add_argument("--schwelle", type=float, default=0,
+                        help="nur Zeilen zeigen, in denen sich ein Wert um mehr als so viele Prozent ändert")
+    args = parser.parse_args()
+
+    vorher = laden(args.vorher)
+    nachher = laden(args.nachher)
+
+    print("%-26s %6s" % ("Messung", "param") + "".join(" %23s" % titel for _, titel in SPALTEN))
+    for schluessel in list(vorher) + [s for s in nachher if s not in vorher]:
+        a, b = vorher.get(schluessel), nachher.get(schluessel)
+        if a is None or b is None:
+            print("%-26s %6s  %s" % (schluessel[0], schluessel[1], "nur nachher" if a is None else "nur vorher"))
+            continue
+        groesste = max(abs(b[s] - a[s]) * 100.0 / a[s] if a[s] else (100.0 if b[s] else 0.0) for s, _ in SPALTEN)
+        if groesste <= args.schwelle and args.schwelle > 0:
+            continue
+        zellen = "".join(" %9.1f → %-6.1f %4s" % (a[s], b[s], aenderung(a[s], b[s])) for s, _ in SPALTEN)
+        print("%-26s %6s%s" % (schluessel[0], schluessel[1], zellen))
+
+
+if __name__ == "__main__":
+    main()
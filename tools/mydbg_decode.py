@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""MYDBG Dekoder: macht binäre Logeinträge wieder lesbar.
+
+Eingaben:
+  - Abzug des Ringpuffers von http://<ip>/mydbg_log.bin
+  - oder Mitschnitt der seriellen Schnittstelle mit MYDBG_SERIAL_BINAER
+Texte der Aufrufstellen kommen aus /mydbg_sites.json (Option --sites) und,
+beim seriellen Mitschnitt, aus den darin enthaltenen Stellen-Rahmen.
+
+Beispiele:
+  curl -o log.bin http://192.168.4.1/mydbg_log.bin
+  curl -o sites.json http://192.168.4.1/mydbg_sites.json
+  python3 tools/mydbg_decode.py log.bin --sites sites.json
+  python3 tools/mydbg_decode.py --serial capture.bin --json
+"""
+
+import argparse
+import json
+import struct
+import sys
+from datetime import datetime, timezone
+
+RING_MAGIC = 0x4742444D
+RING_VERSION = 3
+
+# Muss zu MYDBG_LogRecord in include/MYDBG.h passen (40 Byte, little endian)
+RECORD = struct.Struct("<IIQHBBBBH16s")
+SITE_KOPF = struct.Struct("<IHBBBB")
+ANKER = struct.Struct("<HHIq")  # MYDBG_ZeitAnker: Start, Unix-Zeit in µs minus monotone Zeit
+ZEIT_GUELTIG_AB = 1700000000
+
+TYP_KEIN, TYP_INT, TYP_UINT, TYP_FLOAT, TYP_BOOL, TYP_TEXT = range(6)
+FLAG_GESUNDHEIT = 0x10  # Heap und Stack in den oberen 8 Byte des Werts (4 x uint16, Heap in 8-Byte-Schritten)
+
+
+def wert_text(typ, daten):
+    if typ == TYP_INT:
+        return str(struct.unpack_from("<q", daten)[0])
+    if typ == TYP_UINT:
+        return str(struct.unpack_from("<Q", daten)[0])
+    if typ == TYP_FLOAT:
+        return "%.2f" % struct.unpack_from("<d", daten)[0]
+    if typ == TYP_BOOL:
+        return "1" if struct.unpack_from("<Q", daten)[0] else "0"
+    if typ == TYP_TEXT:
+        return daten.split(b"\0", 1)[0].decode("utf-8", "replace")
+    return ""
+
+
+def site_dekodieren(daten):
+    sid, zeile, typ, lf, lm, lv = SITE_KOPF.unpack_from(daten)
+    pos = SITE_KOPF.size
+    texte = []
+    for laenge in (lf, lm, lv):
+        texte.append(daten[pos:pos + laenge].decode("utf-8", "replace"))
+        pos += laenge
+    return sid, {"pgmFunc": texte[0], "pgmZeile": zeile, "msg": texte[1], "varName": texte[2]}
+
+
+def record_dekodieren(daten, sites, anker):
+    seq, site, mikros, boot, typ, reset, flags, stufe, gedrosselt, wert = RECORD.unpack(daten)
+    s = sites.get(site, {"pgmFunc": "?", "pgmZeile": 0, "msg": "?", "varName": ""})
+    offset = anker.get(boot, 0)
+    zeit = (mikros + offset) // 1000000 if offset else 0
+    eintrag = {
+        "seq": seq,
+        "site": site,
+        "boot": boot,
+        "timestamp": datetime.fromtimestamp(zeit, timezone.utc).strftime("%Y-%m-%d %H:%M:%S")
+        if zeit >= ZEIT_GUELTIG_AB else "[keine Zeit]",
+        "millis": mikros // 1000,
+        "pgmFunc": s["pgmFunc"],
+        "pgmZeile": s["pgmZeile"],
+        "level": stufe,
+        "suppressed": gedrosselt,
+        "msg": s["msg"],
+        "varName": s["varName"],
+        "varValue": wert_text(typ, wert),
+        "resetReason": reset,
+    }
+    if flags & FLAG_GESUNDHEIT:
+        frei, block, minimum, stack = struct.unpack_from("<4H", wert, 8)
+        eintrag.update(heap_free=frei * 8, heap_block=block * 8, heap_min=minimum * 8, stack_free=stack)
+    return eintrag
+
+
+def dump_lesen(daten, sites):
+    magic, version, groesse, anzahl, anker_anzahl = struct.unpack_from("<IHHII", daten)
+    if magic != RING_MAGIC or version != RING_VERSION or groesse != RECORD.size:
+        sys.exit("Kein MYDBG-Ringpuffer (Kennung, Version oder Satzgröße passt nicht)")
+    pos = 16
+    anker = {}
+    for _ in range(anker_anzahl):
+        boot, _, _, offset = ANKER.unpack_from(daten, pos)
+        anker[boot] = offset
+        pos += ANKER.size
+    for _ in range(anzahl):
+        if pos + RECORD.size > len(daten):
+            break
+        yield record_dekodieren(daten[pos:pos + RECORD.size], sites, anker)
+        pos += RECORD.size
+
+
+def serial_lesen(daten, sites):
+    # Rahmen: A5 5A Länge Eintrag | A5 5B LängeLo LängeHi Stelle | A5 5C Länge Zeitanker,
+    # dazwischen beliebiger Text. Ein Zeitanker gilt auch für Einträge davor – dekodiert wird am Ende.
+    anker = {}
+    roh = []
+    pos = 0
+    while True:
+        pos = daten.find(b"\xA5", pos)
+        if pos < 0 or pos + 3 > len(daten):
+            break
+        art = daten[pos + 1]
+        if art == 0x5A and daten[pos + 2] == RECORD.size and pos + 3 + RECORD.size <= len(daten):
+            roh.append(daten[pos + 3:pos + 3 + RECORD.size])
+            pos += 3 + RECORD.size
+        elif art == 0x5C and daten[pos + 2] == ANKER.size and pos + 3 + ANKER.size <= len(daten):
+            boot, _, _, offset = ANKER.unpack_from(daten, pos + 3)
+            anker[boot] = offset
+            pos += 3 + ANKER.size
+        elif art == 0x5B and pos + 4 <= len(daten):
+            laenge = daten[pos + 2] | (daten[pos + 3] << 8)
+            if pos + 4 + laenge > len(daten):
+                break
+            sid, site = site_dekodieren(daten[pos + 4:pos + 4 + laenge])
+            sites[sid] = site
+            pos += 4 + laenge
+        else:
+            pos += 1
+    return [record_dekodieren(r, sites, anker) for r in roh]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="MYDBG Binärlog dekodieren")
+    parser.add_argument("datei", help="Abzug von /mydbg_log.bin oder serieller Mitschnitt")
+    parser.add_argument("--sites", help="Tabelle der Aufrufstellen von /mydbg_sites.json")
+    parser.add_argument("--serial", action="store_true", help="Datei ist ein serieller Mitschnitt")
+    parser.add_argument("--json", action="store_true", help="Ausgabe als JSON wie /mydbg_data.json")
+    args = parser.parse_args()
+
+    sites = {}
+    if args.sites:
+        with open(args.sites, encoding="utf-8") as f:
+            for s in json.load(f):
+                sites[s["id"]] = s
+    with open(args.datei, "rb") as f:
+        daten = f.read()
+
+    eintraege = serial_lesen(daten, sites) if args.serial else dump_lesen(daten, sites)
+    if args.json:
+        json.dump({"log": list(eintraege)}, sys.stdout, ensure_ascii=False, indent=1)
+        print()
+        return
+    for e in eintraege:
+        print("#%d %s | %s | %s() | Zeile %d | %s | %s = %s" % (
+            e["seq"], e["timestamp"], e["millis"], e["pgmFunc"], e["pgmZeile"], e["msg"], e["varName"], e["varValue"]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,238 @@
+/*
+  MYDBG LZ-Benchmark: misst Packfaktor und Durchsatz der Segmentkompression (include/MYDBG_lz.h) am PC.
+
+  Die Korpora bestehen aus MYDBG_LogRecord-Einträgen, wie sie typische Sketches erzeugen,
+  und werden wie auf dem Gerät in Blöcken zu MYDBG_Z_BLOCK_EINTRAEGE Einträgen gepackt.
+  Jeder Block wird zurück entpackt und verglichen.
+
+  Übersetzen und starten (platformio.ini: [env:native_lz]):
+    pio run -e native_lz -t exec
+  oder ohne PlatformIO:
+    g++ -O2 -std=c++17 -I include tools/mydbg_lz_bench.cpp -o mydbg_lz_bench
+    ./mydbg_lz_bench [Einträge je Korpus, Vorgabe 20000]
+  Der Rückgabewert ist 1, wenn ein Block nicht unverändert zurückkommt. test/test_native_lz prüft
+  dasselbe mit Randfällen und mit echten Segmenten aus MYDBG_segPacken.
+
+  Die Werte gelten für den PC; auf dem ESP32 (240 MHz) liegt der Durchsatz etwa eine Größenordnung darunter.
+*/
+#include "MYDBG_lz.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Muss zu MYDBG_LogRecord in include/MYDBG.h passen (40 Byte, little endian)
+struct LogRecord
+{
+    uint32_t seq;
+    uint32_t site;
+    uint64_t mikros;
+    uint16_t boot;
+    uint8_t typ;
+    uint8_t resetReason;
+    uint8_t flags;
+    uint8_t stufe;
+    uint16_t unterdrueckt;
+    uint8_t wert[16];
+}; // Ende der Struktur LogRecord
+static_assert(sizeof(LogRecord) == 40, "LogRecord muss 40 Byte groß sein");
+
+enum
+{
+    TYP_KEIN,
+    TYP_INT,
+    TYP_UINT,
+    TYP_FLOAT,
+    TYP_BOOL,
+    TYP_TEXT
+};
+
+#define BLOCK_EINTRAEGE 100 // wie MYDBG_Z_BLOCK_EINTRAEGE
+
+struct Korpus
+{
+    const char *name;
+    std::vector<LogRecord> eintraege;
+}; // Ende der Struktur Korpus
+
+static LogRecord neuerEintrag(uint32_t seq, uint32_t site, uint64_t mikros, uint8_t typ)
+{
+    LogRecord r = {};
+    r.seq = seq;
+    r.site = site;
+    r.mikros = mikros;
+    r.boot = 17;
+    r.typ = typ;
+    r.resetReason = 1; // ESP_RST_POWERON
+    r.flags = 0x02;    // MYDBG_FLAG_STOP
+    r.stufe = 1;
+    return r;
+} // Ende der Funktion neuerEintrag
+
+// Hauptschleife mit einigen Aufrufstellen, Zählern und Ganzzahlen
+static Korpus schleife(size_t n, std::mt19937 &zufall)
+{
+    Korpus k{"schleife (int)", {}};
+    uint64_t t = 5000000;
+    int64_t zaehler = 0;
+    const uint32_t sites[] = {0x1A2B3C4D, 0x5E6F7081, 0x92A3B4C5, 0xD6E7F809, 0x11223344, 0x55667788};
+    for (size_t i = 0; i < n; i++)
+    {
+        t += 20000 + zufall() % 500;
+        LogRecord r = neuerEintrag(1000 + i, sites[i % 6], t, TYP_INT);
+        int64_t v = i % 6 == 0 ? ++zaehler : (int64_t)(zufall() % 100) - 50;
+        memcpy(r.wert, &v, sizeof(v));
+        k.eintraege.push_back(r);
+    }
+    return k;
+} // Ende der Funktion schleife
+
+// Messwerte als float mit Rauschen, drei Sensoren
+static Korpus sensor(size_t n, std::mt19937 &zufall)
+{
+    Korpus k{"sensor (float)", {}};
+    uint64_t t = 5000000;
+    std::normal_distribution<double> rauschen(0.0, 0.05);
+    const uint32_t sites[] = {0xC0FFEE01, 0xC0FFEE02, 0xC0FFEE03};
+    const double basis[] = {21.5, 48.0, 1013.2};
+    for (size_t i = 0; i < n; i++)
+    {
+        t += 1000000 + zufall() % 2000;
+        LogRecord r = neuerEintrag(1000 + i, sites[i % 3], t, TYP_FLOAT);
+        double v = basis[i % 3] + rauschen(zufall);
+        memcpy(r.wert, &v, sizeof(v));
+        k.eintraege.push_back(r);
+    }
+    return k;
+} // Ende der Funktion sensor
+
+// Kurze Meldungstexte, die sich oft wiederholen
+static Korpus text(size_t n, std::mt19937 &zufall)
+{
+    Korpus k{"text", {}};
+    uint64_t t = 5000000;
+    const char *meldungen[] = {"WLAN verbunden", "MQTT reconnect", "Pumpe AN", "Pumpe AUS", "OTA bereit", "Sensor Timeout", "NTP ok"};
+    for (size_t i = 0; i < n; i++)
+    {
+        t += 50000 + zufall() % 200000;
+        uint32_t m = zufall() % 7;
+        LogRecord r = neuerEintrag(1000 + i, 0xABCD0000 + m, t, TYP_TEXT);
+        memcpy(r.wert, meldungen[m], strlen(meldungen[m])); // alle Meldungen kürzer als 16 Byte
+        k.eintraege.push_back(r);
+    }
+    return k;
+} // Ende der Funktion text
+
+// Mischung aus allen Arten, Stellen in zufälliger Reihenfolge
+static Korpus gemischt(size_t n, std::mt19937 &zufall)
+{
+    Korpus a = schleife(n, zufall), b = sensor(n, zufall), c = text(n, zufall);
+    Korpus k{"gemischt", {}};
+    uint64_t t = 5000000;
+    for (size_t i = 0; i < n; i++)
+    {
+        uint32_t quelle = zufall() % 3;
+        LogRecord r = quelle == 0 ? a.eintraege[i] : quelle == 1 ? b.eintraege[i] : c.eintraege[i];
+        t += zufall() % 100000;
+        r.seq = 1000 + i;
+        r.mikros = t;
+        r.stufe = zufall() % 4;
+        k.eintraege.push_back(r);
+    }
+    return k;
+} // Ende der Funktion gemischt
+
+// Zufallsbytes als ungünstigster Fall
+static Korpus zufallsdaten(size_t n, std::mt19937 &zufall)
+{
+    Korpus k{"zufall (worst case)", {}};
+    k.eintraege.resize(n);
+    uint8_t *p = (uint8_t *)k.eintraege.data();
+    for (size_t i = 0; i < n * sizeof(LogRecord); i++)
+        p[i] = zufall();
+    return k;
+} // Ende der Funktion zufallsdaten
+
+static double sekundenSeit(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+} // Ende der Funktion sekundenSeit
+
+// Packt alle Blöcke, entpackt sie wieder und prüft den Inhalt; false bei Abweichung
+static bool messen(const Korpus &k)
+{
+    const uint8_t *roh = (const uint8_t *)k.eintraege.data();
+    const size_t rohBytes = k.eintraege.size() * sizeof(LogRecord);
+    const size_t blockBytes = BLOCK_EINTRAEGE * sizeof(LogRecord);
+    std::vector<uint16_t> hash(1 << MYDBG_LZ_HASH_BITS);
+    std::vector<std::vector<uint8_t>> gepackt;
+    std::vector<uint8_t> zurueck(blockBytes);
+
+    // Packen, so oft wiederholt, dass die Messung mindestens 0,3 s dauert
+    size_t runden = 0, packBytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    do
+    {
+        gepackt.clear();
+        packBytes = 0;
+        for (size_t o = 0; o < rohBytes; o += blockBytes)
+        {
+            size_t n = rohBytes - o < blockBytes ? rohBytes - o : blockBytes;
+            std::vector<uint8_t> aus;
+            aus.reserve(n + n / 8 + 1);
+            packBytes += MYDBG_lzPacken(roh + o, n, [&](const uint8_t *d, size_t l)
+                                        { aus.insert(aus.end(), d, d + l); },
+                                        hash.data(), sizeof(LogRecord));
+            gepackt.push_back(std::move(aus));
+        }
+        runden++;
+    } while (sekundenSeit(start) < 0.3);
+    double packMBs = rohBytes * runden / sekundenSeit(start) / 1e6;
+
+    bool ok = true;
+    runden = 0;
+    start = std::chrono::steady_clock::now();
+    do
+    {
+        for (size_t b = 0; b < gepackt.size(); b++)
+        {
+            size_t o = b * blockBytes;
+            size_t n = rohBytes - o < blockBytes ? rohBytes - o : blockBytes;
+            size_t i = 0;
+            const std::vector<uint8_t> &ein = gepackt[b];
+            size_t ist = MYDBG_lzEntpacken([&]() -> int
+                                           { return i < ein.size() ? ein[i++] : -1; },
+                                           zurueck.data(), n);
+            if (runden == 0 && (ist != n || memcmp(zurueck.data(), roh + o, n) != 0))
+                ok = false;
+        }
+        runden++;
+    } while (sekundenSeit(start) < 0.3);
+    double entpackMBs = rohBytes * runden / sekundenSeit(start) / 1e6;
+
+    printf("%-22s %8zu %9.1f %9.1f %7.2fx %10.1f %10.1f  %s\n", k.name, k.eintraege.size(), rohBytes / 1024.0,
+           packBytes / 1024.0, (double)rohBytes / packBytes, packMBs, entpackMBs, ok ? "ok" : "FEHLER");
+    return ok;
+} // Ende der Funktion messen
+
+int main(int argc, char **argv)
+{
+    size_t n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 20000;
+    if (n == 0)
+        n = 20000;
+    std::mt19937 zufall(42);
+
+    printf("Blöcke zu %d Einträgen (%zu Byte), Fenster %d Byte, Hashtabelle %d Einträge\n\n", BLOCK_EINTRAEGE,
+           BLOCK_EINTRAEGE * sizeof(LogRecord), MYDBG_LZ_FENSTER, 1 << MYDBG_LZ_HASH_BITS);
+    printf("%-22s %8s %9s %9s %8s %10s %10s\n", "Korpus", "Einträge", "roh kB", "gepackt", "Faktor", "Packen MB/s", "Entp. MB/s");
+
+    bool ok = true;
+    ok &= messen(schleife(n, zufall));
+    ok &= messen(sensor(n, zufall));
+    ok &= messen(text(n, zufall));
+    ok &= messen(gemischt(n, zufall));
+    ok &= messen(zufallsdaten(n, zufall));
+    return ok ? 0 : 1;
+} // Ende der Funktion main
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""MYDBG Web-Debug-Seite: packt tools/MYDBG_status.html mit gzip in include/MYDBG_seite.h.
+
+Die Seite liegt danach als Byte-Array im Flash und wird unverändert mit Content-Encoding: gzip
+gesendet. Das ETag ist ein Hash über die gepackten Bytes und ändert sich nur mit dem Inhalt.
+gzip ohne Zeitstempel und Dateinamen: gleiche Seite ergibt dieselbe Datei, include/MYDBG_seite.h
+wird nur neu geschrieben, wenn sich etwas geändert hat (kein unnötiges Neuübersetzen).
+
+Läuft vor jedem Build als extra_script (platformio.ini: extra_scripts = pre:tools/mydbg_seite.py)
+oder von Hand:
+  python3 tools/mydbg_seite.py
+"""
+
+import gzip
+import hashlib
+import os
+
+QUELLE = os.path.join("tools", "MYDBG_status.html")
+ZIEL = os.path.join("include", "MYDBG_seite.h")
+
+KOPF = """#pragma once
+/*
+  MYDBG_seite.h – Web-Debug-Seite /MYDBG_status.html, gzip-gepackt (wird von MYDBG.h eingebunden)
+
+  Erzeugt von tools/mydbg_seite.py aus tools/MYDBG_status.html – nicht von Hand ändern, sondern die
+  HTML-Datei bearbeiten und den Build (oder das Skript) laufen lassen.
+  Seite {roh} Byte, gepackt {gepackt} Byte.
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#define MYDBG_SEITE_ETAG "\\"{etag}\\"" // starkes ETag: Hash über die gepackten Bytes
+#define MYDBG_SEITE_ROH {roh} // Byte entpackt
+
+inline constexpr uint8_t MYDBG_SEITE_GZ[] = {{
+{daten}
+}}; // Ende von MYDBG_SEITE_GZ
+"""
+
+
+def header_erzeugen(html):
+    gepackt = gzip.compress(html, compresslevel=9, mtime=0)
+    gepackt = gepackt[:9] + b"\xff" + gepackt[10:]  # Betriebssystem "unbekannt": gleiche Bytes unter Windows und Linux
+    zeilen = []
+    for i in range(0, len(gepackt), 16):
+        zeilen.append("    " + ", ".join("0x%02x" % b for b in gepackt[i:i + 16]) + ",")
+    return KOPF.format(roh=len(html), gepackt=len(gepackt), etag=hashlib.sha256(gepackt).hexdigest()[:16],
+                       daten="\n".join(zeilen))
+
+
+def erzeugen(projekt):
+    with open(os.path.join(projekt, QUELLE), "rb") as f:
+        inhalt = header_erzeugen(f.read())
+    ziel = os.path.join(projekt, ZIEL)
+    if os.path.exists(ziel):
+        with open(ziel, encoding="utf-8") as f:
+            if f.read() == inhalt:
+                return False
+    with open(ziel, "w", encoding="utf-8", newline="\n") as f:
+        f.write(inhalt)
+    print("MYDBG: %s aus %s erzeugt" % (ZIEL, QUELLE))
+    return True
+
+
+try:
+    Import("env")  # noqa: F821 – nur unter PlatformIO (SCons) vorhanden
+    erzeugen(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        erzeugen(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
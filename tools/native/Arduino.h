@@ -0,0 +1,393 @@
+#pragma once
+/*
+  Platzhalter für den Host-Build (platformio.ini: [env:native]) – nur so viel Arduino, ESP-IDF und FreeRTOS,
+  wie include/MYDBG.h braucht, damit tools/mydbg_bench.cpp die heißen Pfade am PC messen kann.
+
+  - Tasks laufen als std::thread, portMUX und Semaphoren sind rekursive Mutexe, portNUM_PROCESSORS = 2
+  - Zeit kommt von std::chrono::steady_clock; mit MYDBG_nativePauseAus = true kehrt delay() sofort zurück
+    und rückt stattdessen die Uhr vor (MYDBG(n, ...) ohne die Pause von n Sekunden)
+  - Serial schreibt nichts, sondern zählt nur (Serial.geschrieben); MYDBG_NATIVE_SERIAL=1 gibt auf stderr aus
+  - Heap und WLAN-Pegel sind feste Werte
+  - Heap-Anforderungen, die nur die Platzhalter selbst stellen (Pfade, Verzeichnislisten), laufen in einem
+    MYDBG_NativeIntern-Abschnitt; der Benchmark zählt sie getrennt von denen aus MYDBG.h
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// ArduinoJson: Dateien als Stream lesen und über Print schreiben, wie auf dem ESP32
+#define ARDUINOJSON_ENABLE_ARDUINO_STREAM 1
+#define ARDUINOJSON_ENABLE_ARDUINO_PRINT 1
+#define ARDUINOJSON_ENABLE_ARDUINO_STRING 0
+#define ARDUINOJSON_ENABLE_PROGMEM 0
+
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define PROGMEM
+#define F(text) text
+
+using std::isfinite;
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+
+template <typename T, typename U, typename V>
+inline T constrain(T wert, U unten, V oben)
+{
+    return wert < unten ? unten : wert > oben ? oben : wert;
+} // Ende der Funktion constrain
+
+// === Zeit ===
+inline bool MYDBG_nativePauseAus = false;        // true: delay()/vTaskDelay() rücken nur die Uhr vor
+inline std::atomic<int64_t> MYDBG_nativeSprungUs{0}; // so weit ist die Uhr durch übersprungene Pausen vorgerückt
+
+inline int64_t MYDBG_nativeMikros()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() +
+           MYDBG_nativeSprungUs.load(std::memory_order_relaxed);
+} // Ende der Funktion MYDBG_nativeMikros
+
+inline unsigned long millis() { return (unsigned long)(MYDBG_nativeMikros() / 1000); }
+inline unsigned long micros() { return (unsigned long)MYDBG_nativeMikros(); }
+
+inline void delay(unsigned long ms)
+{
+    if (MYDBG_nativePauseAus)
+        MYDBG_nativeSprungUs.fetch_add((int64_t)ms * 1000, std::memory_order_relaxed);
+    else
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+} // Ende der Funktion delay
+
+inline void yield() { std::this_thread::yield(); }
+
+// === Eigener Heap der Platzhalter ===
+inline thread_local int MYDBG_nativeIntern = 0; // > 0: der Thread steckt in einem Platzhalter
+
+struct MYDBG_NativeIntern
+{
+    MYDBG_NativeIntern() { MYDBG_nativeIntern++; }
+    ~MYDBG_NativeIntern() { MYDBG_nativeIntern--; }
+    MYDBG_NativeIntern(const MYDBG_NativeIntern &) = delete;
+}; // Ende der Struktur MYDBG_NativeIntern
+
+// === FreeRTOS ===
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+typedef std::recursive_timed_mutex *SemaphoreHandle_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portTICK_PERIOD_MS 1
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define portNUM_PROCESSORS 2
+
+struct portMUX_TYPE
+{
+    std::recursive_mutex mutex;
+}; // Ende der Struktur portMUX_TYPE
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(mux) (mux)->mutex.lock()
+#define portEXIT_CRITICAL(mux) (mux)->mutex.unlock()
+#define portENTER_CRITICAL_ISR(mux) (mux)->mutex.lock()
+#define portEXIT_CRITICAL_ISR(mux) (mux)->mutex.unlock()
+#define portYIELD_FROM_ISR(...) ((void)0)
+
+inline thread_local int MYDBG_nativeKern = 0; // xPortGetCoreID(): ein Benchmark-Thread kann sich einem "Kern" zuordnen
+
+inline int xPortGetCoreID() { return MYDBG_nativeKern; }
+inline bool xPortInIsrContext() { return false; }
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t funktion, const char *, uint32_t, void *parameter, UBaseType_t,
+                                          TaskHandle_t *handle, BaseType_t)
+{
+    std::thread(funktion, parameter).detach();
+    if (handle)
+        *handle = (TaskHandle_t)1;
+    return pdPASS;
+} // Ende der Funktion xTaskCreatePinnedToCore
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    static thread_local char kennung;
+    return &kennung;
+} // Ende der Funktion xTaskGetCurrentTaskHandle
+
+inline char *pcTaskGetName(TaskHandle_t)
+{
+    static char name[] = "loopTask";
+    return name;
+} // Ende der Funktion pcTaskGetName
+
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
+
+inline UBaseType_t MYDBG_nativeStackFrei = 2048; // uxTaskGetStackHighWaterMark() für jeden Task
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return MYDBG_nativeStackFrei; }
+
+// Benachrichtigungen gehen verloren; wartende Tasks schlafen höchstens 50 ms und sehen dann selbst nach
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(min<TickType_t>(ticks, 50)));
+    return 0;
+} // Ende der Funktion ulTaskNotifyTake
+
+inline void xTaskNotifyGive(TaskHandle_t) {}
+inline void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t *) {}
+
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new std::recursive_timed_mutex; }
+
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sperre, TickType_t ticks)
+{
+    if (ticks == portMAX_DELAY)
+    {
+        sperre->lock();
+        return pdTRUE;
+    }
+    return sperre->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+} // Ende der Funktion xSemaphoreTakeRecursive
+
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sperre)
+{
+    sperre->unlock();
+    return pdTRUE;
+} // Ende der Funktion xSemaphoreGiveRecursive
+
+// === ESP-IDF: System ===
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef enum
+{
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO
+} esp_reset_reason_t;
+
+inline esp_reset_reason_t MYDBG_nativeResetGrund = ESP_RST_POWERON;
+inline esp_reset_reason_t esp_reset_reason() { return MYDBG_nativeResetGrund; }
+
+typedef void (*shutdown_handler_t)(void);
+inline esp_err_t esp_register_shutdown_handler(shutdown_handler_t) { return ESP_OK; }
+
+// Heap-Werte sind fest, lassen sich aber setzen (z. B. ein Leck nachstellen: ESP.heapFrei -= 100)
+struct EspClass
+{
+    uint32_t heapFrei = 200000;
+    uint32_t heapBlock = 110000;
+    uint32_t heapMin = 150000;
+
+    uint32_t getFreeHeap() { return heapFrei; }
+    uint32_t getMaxAllocHeap() { return heapBlock; }
+    uint32_t getMinFreeHeap() { return min(heapMin, heapFrei); }
+    uint32_t getCycleCount() { return (uint32_t)(MYDBG_nativeMikros() * 240); } // 240 MHz wie der ESP32
+    void restart() { exit(0); }
+}; // Ende der Struktur EspClass
+inline EspClass ESP;
+
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+
+// === String ===
+// Nur die Methoden, die MYDBG und das Beispiel benutzen; Speicher kommt wie auf dem ESP32 vom Heap
+class String
+{
+public:
+    String() {}
+    String(const char *text) : s(text ? text : "") {}
+    String(const std::string &text) : s(text) {}
+    explicit String(char zeichen) : s(1, zeichen) {}
+    String(int wert) : s(std::to_string(wert)) {}
+    String(unsigned wert) : s(std::to_string(wert)) {}
+    String(long wert) : s(std::to_string(wert)) {}
+    String(unsigned long wert) : s(std::to_string(wert)) {}
+    String(long long wert) : s(std::to_string(wert)) {}
+    String(unsigned long long wert) : s(std::to_string(wert)) {}
+    String(double wert, unsigned stellen = 2)
+    {
+        char puffer[40];
+        snprintf(puffer, sizeof(puffer), "%.*f", (int)stellen, wert);
+        s = puffer;
+    }
+
+    const char *c_str() const { return s.c_str(); }
+    unsigned length() const { return (unsigned)s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned n)
+    {
+        s.reserve(n);
+        return true;
+    }
+    String substring(unsigned von) const { return von < s.size() ? String(s.substr(von)) : String(); }
+    String substring(unsigned von, unsigned bis) const { return von < s.size() && bis > von ? String(s.substr(von, bis - von)) : String(); }
+    int indexOf(const char *teil) const
+    {
+        size_t pos = s.find(teil);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    bool startsWith(const char *anfang) const { return s.compare(0, strlen(anfang), anfang) == 0; }
+    long toInt() const { return atol(s.c_str()); }
+    float toFloat() const { return (float)atof(s.c_str()); }
+    void trim()
+    {
+        size_t a = s.find_first_not_of(" \t\r\n");
+        size_t b = s.find_last_not_of(" \t\r\n");
+        s = a == std::string::npos ? std::string() : s.substr(a, b - a + 1);
+    }
+    char operator[](unsigned i) const { return i < s.size() ? s[i] : '\0'; }
+
+    String &operator+=(const String &rest)
+    {
+        s += rest.s;
+        return *this;
+    }
+    String &operator+=(const char *rest)
+    {
+        s += rest ? rest : "";
+        return *this;
+    }
+    String &operator+=(char zeichen)
+    {
+        s += zeichen;
+        return *this;
+    }
+
+    bool operator==(const String &andere) const { return s == andere.s; }
+    bool operator==(const char *andere) const { return s == (andere ? andere : ""); }
+    bool operator!=(const String &andere) const { return !(*this == andere); }
+    bool operator!=(const char *andere) const { return !(*this == andere); }
+
+private:
+    std::string s;
+}; // Ende der Klasse String
+
+inline String operator+(const String &a, const String &b)
+{
+    String summe(a);
+    summe += b;
+    return summe;
+} // Ende der Funktion operator+
+
+inline String operator+(const String &a, const char *b)
+{
+    String summe(a);
+    summe += b;
+    return summe;
+} // Ende der Funktion operator+
+
+inline String operator+(const char *a, const String &b)
+{
+    String summe(a);
+    summe += b;
+    return summe;
+} // Ende der Funktion operator+
+
+// === Print, Stream und Serial ===
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t zeichen) { return write(&zeichen, 1); }
+    virtual size_t write(const uint8_t *daten, size_t laenge) = 0;
+    size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+    size_t write(const char *text, size_t laenge) { return write((const uint8_t *)text, laenge); }
+
+    size_t print(const char *text) { return write(text); }
+    size_t print(const String &text) { return write(text.c_str()); }
+    size_t print(char zeichen) { return write((uint8_t)zeichen); }
+    size_t print(int wert) { return print(String(wert)); }
+    size_t print(unsigned wert) { return print(String(wert)); }
+    size_t print(long wert) { return print(String(wert)); }
+    size_t print(unsigned long wert) { return print(String(wert)); }
+    size_t print(double wert, int stellen = 2) { return print(String(wert, stellen)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T &wert)
+    {
+        size_t n = print(wert);
+        return n + println();
+    }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char puffer[256];
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(puffer, sizeof(puffer), format, args);
+        va_end(args);
+        if (n < 0)
+            return 0;
+        if ((size_t)n < sizeof(puffer))
+            return write((const uint8_t *)puffer, n);
+        std::string lang(n + 1, '\0'); // wie auf dem ESP32: lange Ausgaben über den Heap
+        va_start(args, format);
+        vsnprintf(&lang[0], lang.size(), format, args);
+        va_end(args);
+        return write((const uint8_t *)lang.data(), n);
+    }
+}; // Ende der Klasse Print
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+
+    size_t readBytes(char *ziel, size_t laenge)
+    {
+        size_t n = 0;
+        int zeichen;
+        while (n < laenge && (zeichen = read()) >= 0)
+            ziel[n++] = (char)zeichen;
+        return n;
+    }
+}; // Ende der Klasse Stream
+
+// Konsole: zählt die Bytes, Eingaben gibt es keine
+class HardwareSerial : public Stream
+{
+public:
+    std::atomic<uint64_t> geschrieben{0};
+
+    void begin(unsigned long) {}
+    int available() override { return 0; }
+    int read() override { return -1; }
+    void flush() {}
+    explicit operator bool() const { return true; }
+
+    using Print::write;
+    size_t write(const uint8_t *daten, size_t laenge) override
+    {
+        geschrieben.fetch_add(laenge, std::memory_order_relaxed);
+        static const bool ausgeben = getenv("MYDBG_NATIVE_SERIAL") != nullptr;
+        if (ausgeben)
+            fwrite(daten, 1, laenge, stderr);
+        return laenge;
+    }
+}; // Ende der Klasse HardwareSerial
+inline HardwareSerial Serial;
@@ -0,0 +1,333 @@
+#pragma once
+/*
+  Platzhalter für den Host-Build: AsyncWebServer merkt sich nur die Routen, AsyncWebSocket
+  verwaltet simulierte Clients.
+
+  - server.aufrufen("/pfad", {{"name", "wert"}}) ruft den Handler einer Route auf und liest eine
+    Chunked-Antwort bis zum Ende; die Antwort liegt danach in request.antwort (mit Kopfzeilen in antwort->kopf),
+    Kopfzeilen der Anfrage stehen vorher in request.kopf; request.stueck legt fest, wie viele Byte der Server
+    je Aufruf des Füllers abholt (Vorgabe 1460 wie ein TCP-Segment)
+  - MYDBG_ws.verbinden(id) und MYDBG_ws.empfangen(id, "TEXT") lösen die Ereignisse
+    WS_EVT_CONNECT und WS_EVT_DATA aus; Clients zählen gesendete Frames und Bytes
+*/
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include <functional>
+#include <map>
+#include <vector>
+
+typedef enum
+{
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_ANY = 0b01111111
+} WebRequestMethod;
+typedef int WebRequestMethodComposite;
+
+typedef std::function<size_t(uint8_t *, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebParameter
+{
+public:
+    explicit AsyncWebParameter(const String &wert) : inhalt(wert) {}
+    const String &value() const { return inhalt; }
+
+private:
+    String inhalt;
+}; // Ende der Klasse AsyncWebParameter
+
+class AsyncWebHeader
+{
+public:
+    explicit AsyncWebHeader(const String &wert) : inhalt(wert) {}
+    const String &value() const { return inhalt; }
+
+private:
+    String inhalt;
+}; // Ende der Klasse AsyncWebHeader
+
+class AsyncWebServerResponse
+{
+public:
+    int code = 200;
+    std::string typ;
+    std::string inhalt;
+    AwsResponseFiller fueller; // nur bei Chunked-Antworten
+    std::map<std::string, std::string> kopf;
+
+    void addHeader(const String &name, const String &wert) { kopf[name.c_str()] = wert.c_str(); }
+}; // Ende der Klasse AsyncWebServerResponse
+
+class AsyncWebServerRequest
+{
+public:
+    std::map<std::string, AsyncWebParameter> parameter;
+    std::map<std::string, AsyncWebHeader> kopf;
+    std::unique_ptr<AsyncWebServerResponse> antwort;
+    size_t stueck = 1460; // Byte je Aufruf des Füllers einer Chunked-Antwort
+
+    bool hasHeader(const char *name) const { return kopf.count(name) > 0; }
+    AsyncWebHeader *getHeader(const char *name)
+    {
+        auto it = kopf.find(name);
+        return it == kopf.end() ? nullptr : &it->second;
+    }
+
+    bool hasParam(const String &name, bool = false, bool = false) const { return parameter.count(name.c_str()) > 0; }
+    AsyncWebParameter *getParam(const String &name, bool = false, bool = false)
+    {
+        auto it = parameter.find(name.c_str());
+        return it == parameter.end() ? nullptr : &it->second;
+    }
+
+    void send(int code, const String &typ = String(), const String &inhalt = String())
+    {
+        antwort.reset(new AsyncWebServerResponse);
+        antwort->code = code;
+        antwort->typ = typ.c_str();
+        antwort->inhalt = inhalt.c_str();
+    }
+
+    void send(LittleFSFS &fs, const String &pfad, const String &typ = String(), bool = false)
+    {
+        antwort.reset(new AsyncWebServerResponse);
+        antwort->typ = typ.c_str();
+        File f = fs.open(pfad, "r");
+        if (!f)
+        {
+            antwort->code = 404;
+            return;
+        }
+        antwort->inhalt.resize(f.size());
+        antwort->inhalt.resize(f.read((uint8_t *)&antwort->inhalt[0], antwort->inhalt.size()));
+    }
+
+    void send(AsyncWebServerResponse *neu)
+    {
+        antwort.reset(neu);
+        if (!antwort->fueller)
+            return;
+        // Wie der Server: so lange stückweise abholen, bis der Füller 0 liefert
+        std::vector<uint8_t> puffer(stueck ? stueck : 1);
+        size_t n;
+        while ((n = antwort->fueller(puffer.data(), puffer.size(), antwort->inhalt.size())) > 0)
+            antwort->inhalt.append((const char *)puffer.data(), n);
+        antwort->fueller = nullptr;
+    }
+
+    AsyncWebServerResponse *beginResponse(int code, const String &typ = String(), const String &inhalt = String())
+    {
+        AsyncWebServerResponse *neu = new AsyncWebServerResponse;
+        neu->code = code;
+        neu->typ = typ.c_str();
+        neu->inhalt = inhalt.c_str();
+        return neu;
+    }
+
+    AsyncWebServerResponse *beginResponse_P(int code, const String &typ, const uint8_t *inhalt, size_t laenge)
+    {
+        AsyncWebServerResponse *neu = beginResponse(code, typ);
+        neu->inhalt.assign((const char *)inhalt, laenge);
+        return neu;
+    }
+
+    AsyncWebServerResponse *beginChunkedResponse(const String &typ, AwsResponseFiller fueller)
+    {
+        AsyncWebServerResponse *neu = new AsyncWebServerResponse;
+        neu->typ = typ.c_str();
+        neu->fueller = fueller;
+        return neu;
+    }
+}; // Ende der Klasse AsyncWebServerRequest
+
+typedef std::function<void(AsyncWebServerRequest *)> ArRequestHandlerFunction;
+
+class AsyncWebHandler
+{
+public:
+    virtual ~AsyncWebHandler() {}
+}; // Ende der Klasse AsyncWebHandler
+
+class AsyncCallbackWebHandler : public AsyncWebHandler
+{
+}; // Ende der Klasse AsyncCallbackWebHandler
+
+class AsyncWebServer
+{
+public:
+    explicit AsyncWebServer(uint16_t) {}
+
+    AsyncCallbackWebHandler &on(const char *pfad, WebRequestMethodComposite, ArRequestHandlerFunction handler)
+    {
+        routen[pfad] = handler;
+        return rueckgabe;
+    }
+    AsyncWebHandler &addHandler(AsyncWebHandler *handler) { return *handler; }
+    void begin() {}
+    void onNotFound(ArRequestHandlerFunction) {}
+
+    // Ruft die Route auf; false, wenn es sie nicht gibt
+    bool aufrufen(const char *pfad, AsyncWebServerRequest &request, std::map<std::string, std::string> parameter = {})
+    {
+        auto it = routen.find(pfad);
+        if (it == routen.end())
+            return false;
+        for (auto &p : parameter)
+            request.parameter.emplace(p.first, AsyncWebParameter(p.second.c_str()));
+        it->second(&request);
+        return true;
+    }
+
+private:
+    std::map<std::string, ArRequestHandlerFunction> routen;
+    AsyncCallbackWebHandler rueckgabe;
+}; // Ende der Klasse AsyncWebServer
+
+typedef enum
+{
+    WS_EVT_CONNECT,
+    WS_EVT_DISCONNECT,
+    WS_EVT_PONG,
+    WS_EVT_ERROR,
+    WS_EVT_DATA
+} AwsEventType;
+
+typedef enum
+{
+    WS_DISCONNECTED,
+    WS_CONNECTED,
+    WS_DISCONNECTING
+} AwsClientStatus;
+
+#define WS_TEXT 0x01
+#define WS_BINARY 0x02
+#define WS_MAX_QUEUED_MESSAGES 32
+
+typedef struct
+{
+    uint8_t message_opcode;
+    uint32_t num;
+    uint8_t final;
+    uint8_t masked;
+    uint8_t opcode;
+    uint64_t len;
+    uint8_t mask[4];
+    uint64_t index;
+} AwsFrameInfo;
+
+// Puffer für einen Frame, den der Aufrufer selbst füllt (AsyncWebSocket::makeBuffer)
+class AsyncWebSocketMessageBuffer
+{
+public:
+    explicit AsyncWebSocketMessageBuffer(size_t laenge) : daten(laenge, '\0') {}
+    uint8_t *get() { return (uint8_t *)&daten[0]; }
+    size_t length() const { return daten.size(); }
+
+    std::string daten;
+}; // Ende der Klasse AsyncWebSocketMessageBuffer
+
+// Simulierter Client: die Warteschlange leert sich sofort, queueIsFull() lässt sich für Tests setzen
+class AsyncWebSocketClient
+{
+public:
+    uint64_t frames = 0;
+    uint64_t bytes = 0;
+    bool voll = false;
+    std::string letzter;  // Inhalt des letzten Frames
+    bool letzterBinaer = false;
+    std::vector<std::pair<bool, std::string>> *mitschnitt = nullptr; // falls gesetzt: alle Frames (binär?, Inhalt)
+    uint16_t schliessCode = 0; // von close(), 0 = offen
+
+    explicit AsyncWebSocketClient(uint32_t nummer) : nummer(nummer) {}
+
+    uint32_t id() const { return nummer; }
+    AwsClientStatus status() const { return WS_CONNECTED; }
+    bool queueIsFull() const { return voll; }
+    bool canSend() const { return !voll; }
+    // Die Bibliothek trennt danach und meldet WS_EVT_DISCONNECT; hier nur vermerkt
+    void close(uint16_t code = 0, const char * = nullptr) { schliessCode = code ? code : 1000; }
+
+    void text(const char *daten, size_t laenge) { senden(false, daten, laenge); }
+    void text(const char *daten) { text(daten, strlen(daten)); }
+    void text(const String &daten) { text(daten.c_str(), daten.length()); }
+    void binary(const uint8_t *daten, size_t laenge) { senden(true, (const char *)daten, laenge); }
+    // Wie die Bibliothek: der Puffer gehört danach dem WebSocket
+    void text(AsyncWebSocketMessageBuffer *puffer) { senden(false, puffer->daten.data(), puffer->length()), delete puffer; }
+    void binary(AsyncWebSocketMessageBuffer *puffer) { senden(true, puffer->daten.data(), puffer->length()), delete puffer; }
+
+private:
+    uint32_t nummer;
+
+    void senden(bool binaer, const char *daten, size_t laenge)
+    {
+        MYDBG_NativeIntern intern; // nur der Mitschnitt, die Bibliothek hält den Frame in ihrem Puffer
+        frames++;
+        bytes += laenge;
+        letzter.assign(daten, laenge);
+        letzterBinaer = binaer;
+        if (mitschnitt)
+            mitschnitt->emplace_back(binaer, letzter);
+    }
+}; // Ende der Klasse AsyncWebSocketClient
+
+class AsyncWebSocket : public AsyncWebHandler
+{
+public:
+    typedef std::function<void(AsyncWebSocket *, AsyncWebSocketClient *, AwsEventType, void *, uint8_t *, size_t)> AwsEventHandler;
+
+    explicit AsyncWebSocket(const String &) {}
+
+    void onEvent(AwsEventHandler neu) { handler = neu; }
+
+    AsyncWebSocketClient *client(uint32_t id)
+    {
+        auto it = clients.find(id);
+        return it == clients.end() ? nullptr : it->second.get();
+    }
+    size_t count() const { return clients.size(); }
+    AsyncWebSocketMessageBuffer *makeBuffer(size_t laenge = 0) { return new AsyncWebSocketMessageBuffer(laenge); }
+    void cleanupClients() {}
+
+    void textAll(const char *daten, size_t laenge)
+    {
+        for (auto &c : clients)
+            c.second->text(daten, laenge);
+    }
+    void textAll(const char *daten) { textAll(daten, strlen(daten)); }
+    void textAll(const String &daten) { textAll(daten.c_str(), daten.length()); }
+
+    // Simulation: Client verbinden, trennen, Text empfangen
+    AsyncWebSocketClient *verbinden(uint32_t id)
+    {
+        AsyncWebSocketClient *c = (clients[id] = std::make_unique<AsyncWebSocketClient>(id)).get();
+        if (handler)
+            handler(this, c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+        return c;
+    }
+    void trennen(uint32_t id)
+    {
+        if (AsyncWebSocketClient *c = client(id))
+        {
+            if (handler)
+                handler(this, c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+            clients.erase(id);
+        }
+    }
+    void empfangen(uint32_t id, const char *text)
+    {
+        AsyncWebSocketClient *c = client(id);
+        if (!c || !handler)
+            return;
+        std::string kopie(text);
+        AwsFrameInfo info = {};
+        info.final = 1;
+        info.opcode = WS_TEXT;
+        info.len = kopie.size();
+        handler(this, c, WS_EVT_DATA, &info, (uint8_t *)&kopie[0], kopie.size());
+    }
+
+private:
+    AwsEventHandler handler;
+    std::map<uint32_t, std::unique_ptr<AsyncWebSocketClient>> clients;
+}; // Ende der Klasse AsyncWebSocket
@@ -0,0 +1,231 @@
+#pragma once
+/*
+  Platzhalter für den Host-Build: LittleFS auf einem Verzeichnis des PCs.
+
+  Wurzel ist $MYDBG_NATIVE_FS oder sonst ein frisches Verzeichnis unter /tmp (mkdtemp), das
+  LittleFS.aufraeumen() am Ende wieder löscht. Geschriebene Bytes zählt LittleFS.geschrieben mit.
+  Pfade und Verzeichnislisten liegen hier als std::string im Heap (MYDBG_NativeIntern), das echte
+  LittleFS braucht dafür keinen.
+*/
+#include <Arduino.h>
+
+#include <dirent.h>
+#include <memory>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+enum SeekMode
+{
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+class LittleFSFS;
+
+// Wie auf dem ESP32 ein Handle: Kopien teilen sich dieselbe geöffnete Datei
+class File : public Stream
+{
+public:
+    File() {}
+
+    explicit operator bool() const { return datei != nullptr || verzeichnis; }
+
+    using Print::write;
+    size_t write(const uint8_t *daten, size_t laenge) override;
+
+    size_t read(uint8_t *ziel, size_t laenge) { return datei ? fread(ziel, 1, laenge, datei.get()) : 0; }
+    int read() override
+    {
+        int zeichen = datei ? fgetc(datei.get()) : EOF;
+        return zeichen == EOF ? -1 : zeichen;
+    }
+    int available() override { return datei ? (int)(size() - position()) : 0; }
+
+    bool seek(uint32_t pos, SeekMode modus = SeekSet)
+    {
+        return datei && fseek(datei.get(), pos, modus == SeekSet ? SEEK_SET : modus == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+    }
+    size_t position() const { return datei ? ftell(datei.get()) : 0; }
+    size_t size() const
+    {
+        struct stat st;
+        return datei && fflush(datei.get()) == 0 && fstat(fileno(datei.get()), &st) == 0 ? st.st_size : 0;
+    }
+    void flush()
+    {
+        if (datei)
+            fflush(datei.get());
+    }
+    void close()
+    {
+        datei.reset();
+        verzeichnis = false;
+    }
+
+    const char *path() const { return pfad.c_str(); }
+    const char *name() const
+    {
+        size_t pos = pfad.rfind('/');
+        return pfad.c_str() + (pos == std::string::npos ? 0 : pos + 1);
+    }
+    bool isDirectory() const { return verzeichnis; }
+    File openNextFile();
+
+private:
+    friend class LittleFSFS;
+
+    std::shared_ptr<FILE> datei;
+    std::string pfad;
+    bool verzeichnis = false;
+    std::vector<std::string> eintraege; // Verzeichnisinhalt, sortiert
+    size_t naechster = 0;
+}; // Ende der Klasse File
+
+class LittleFSFS
+{
+public:
+    std::atomic<uint64_t> geschrieben{0};
+
+    bool begin(bool = false, const char * = "/littlefs", uint8_t = 10, const char * = "spiffs")
+    {
+        return !wurzel().empty();
+    }
+
+    // Host-Pfad zu einem Pfad im Dateisystem
+    std::string host(const char *pfad)
+    {
+        MYDBG_NativeIntern intern;
+        return wurzel() + (pfad[0] == '/' ? "" : "/") + pfad;
+    }
+
+    bool exists(const char *pfad)
+    {
+        struct stat st;
+        return stat(host(pfad).c_str(), &st) == 0;
+    }
+    bool exists(const String &pfad) { return exists(pfad.c_str()); }
+
+    File open(const char *pfad, const char *modus = "r", bool = false)
+    {
+        MYDBG_NativeIntern intern;
+        File f;
+        f.pfad = pfad;
+        std::string voll = host(pfad);
+        struct stat st;
+        if (stat(voll.c_str(), &st) == 0 && S_ISDIR(st.st_mode))
+        {
+            f.verzeichnis = true;
+            if (DIR *d = opendir(voll.c_str()))
+            {
+                while (dirent *e = readdir(d))
+                    if (e->d_name[0] != '.')
+                        f.eintraege.push_back(e->d_name);
+                closedir(d);
+            }
+            std::sort(f.eintraege.begin(), f.eintraege.end());
+            return f;
+        }
+        // LittleFS legt beim Schreiben fehlende Verzeichnisse nicht an, fopen() auch nicht
+        std::string m = strcmp(modus, "w") == 0 ? "wb" : strcmp(modus, "a") == 0 ? "ab" : strcmp(modus, "r+") == 0 ? "r+b" : "rb";
+        if (FILE *datei = fopen(voll.c_str(), m.c_str()))
+            f.datei.reset(datei, fclose);
+        return f;
+    } // Ende der Funktion open
+    File open(const String &pfad, const char *modus = "r", bool erzeugen = false) { return open(pfad.c_str(), modus, erzeugen); }
+
+    bool remove(const char *pfad) { return ::remove(host(pfad).c_str()) == 0; }
+    bool remove(const String &pfad) { return remove(pfad.c_str()); }
+    bool rename(const char *von, const char *nach) { return ::rename(host(von).c_str(), host(nach).c_str()) == 0; }
+    bool rename(const String &von, const String &nach) { return rename(von.c_str(), nach.c_str()); }
+    bool mkdir(const char *pfad) { return ::mkdir(host(pfad).c_str(), 0755) == 0; }
+    bool mkdir(const String &pfad) { return mkdir(pfad.c_str()); }
+    bool rmdir(const char *pfad) { return ::rmdir(host(pfad).c_str()) == 0; }
+
+    size_t totalBytes() { return 1536 * 1024; } // Partition "spiffs" der Vorgabe-Tabelle (1,5 MB)
+    size_t usedBytes()
+    {
+        MYDBG_NativeIntern intern;
+        return belegt(wurzel());
+    }
+
+    // Löscht ein selbst angelegtes Verzeichnis samt Inhalt; $MYDBG_NATIVE_FS bleibt stehen
+    void aufraeumen()
+    {
+        if (!getenv("MYDBG_NATIVE_FS") && !wurzel().empty())
+            loeschen(wurzel());
+    }
+
+private:
+    const std::string &wurzel()
+    {
+        static const std::string pfad = []
+        {
+            if (const char *vorgabe = getenv("MYDBG_NATIVE_FS"))
+            {
+                ::mkdir(vorgabe, 0755);
+                return std::string(vorgabe);
+            }
+            char muster[] = "/tmp/mydbg_fs_XXXXXX";
+            return std::string(mkdtemp(muster) ? muster : "");
+        }();
+        return pfad;
+    }
+
+    static size_t belegt(const std::string &verzeichnis)
+    {
+        size_t summe = 0;
+        if (DIR *d = opendir(verzeichnis.c_str()))
+        {
+            while (dirent *e = readdir(d))
+            {
+                if (e->d_name[0] == '.')
+                    continue;
+                std::string voll = verzeichnis + "/" + e->d_name;
+                struct stat st;
+                if (stat(voll.c_str(), &st) == 0)
+                    summe += S_ISDIR(st.st_mode) ? belegt(voll) : (st.st_size + 4095) / 4096 * 4096; // 4-kB-Blöcke
+            }
+            closedir(d);
+        }
+        return summe;
+    }
+
+    static void loeschen(const std::string &verzeichnis)
+    {
+        if (DIR *d = opendir(verzeichnis.c_str()))
+        {
+            while (dirent *e = readdir(d))
+            {
+                if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0)
+                    continue;
+                std::string voll = verzeichnis + "/" + e->d_name;
+                struct stat st;
+                if (stat(voll.c_str(), &st) == 0 && S_ISDIR(st.st_mode))
+                    loeschen(voll);
+                else
+                    ::remove(voll.c_str());
+            }
+            closedir(d);
+        }
+        ::rmdir(verzeichnis.c_str());
+    }
+}; // Ende der Klasse LittleFSFS
+inline LittleFSFS LittleFS;
+
+inline size_t File::write(const uint8_t *daten, size_t laenge)
+{
+    size_t n = datei ? fwrite(daten, 1, laenge, datei.get()) : 0;
+    LittleFS.geschrieben.fetch_add(n, std::memory_order_relaxed);
+    return n;
+} // Ende der Funktion File::write
+
+inline File File::openNextFile()
+{
+    if (!verzeichnis || naechster >= eintraege.size())
+        return File();
+    MYDBG_NativeIntern intern;
+    std::string kind = (pfad == "/" ? "" : pfad) + "/" + eintraege[naechster++];
+    return LittleFS.open(kind.c_str(), "r");
+} // Ende der Funktion File::openNextFile
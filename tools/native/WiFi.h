@@ -0,0 +1,27 @@
+#pragma once
+// Platzhalter für den Host-Build: WLAN gilt als verbunden (MYDBG startet dann den Web-Debug),
+// mit WiFi.verbunden = false lässt sich der Fall ohne WLAN messen
+#include <Arduino.h>
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+
+struct IPAddress
+{
+    String toString() const { return "127.0.0.1"; }
+}; // Ende der Struktur IPAddress
+
+struct WiFiClass
+{
+    bool verbunden = true;
+
+    void begin(const char *, const char *) {}
+    int status() const { return verbunden ? WL_CONNECTED : WL_DISCONNECTED; }
+    IPAddress localIP() const { return {}; }
+    String SSID() const { return "native"; }
+    int8_t RSSI() const { return -60; }
+}; // Ende der Struktur WiFiClass
+inline WiFiClass WiFi;
+
+inline void configTime(long, int, const char *, const char * = nullptr, const char * = nullptr) {}
@@ -0,0 +1,15 @@
+#pragma once
+// Platzhalter für den Host-Build: CRC-32 (IEEE 802.3) wie die Funktion im ROM des ESP32
+#include <stdint.h>
+
+inline uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *daten, uint32_t laenge)
+{
+    crc = ~crc;
+    while (laenge--)
+    {
+        crc ^= *daten++;
+        for (int bit = 0; bit < 8; bit++)
+            crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    }
+    return ~crc;
+} // Ende der Funktion esp_rom_crc32_le
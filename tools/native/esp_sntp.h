@@ -0,0 +1,6 @@
+#pragma once
+// Platzhalter für den Host-Build: SNTP synchronisiert nie, die Uhr gilt als nicht gestellt
+#include <sys/time.h>
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+inline void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t) {}
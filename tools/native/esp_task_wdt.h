@@ -0,0 +1,7 @@
+#pragma once
+// Platzhalter für den Host-Build: der Task-Watchdog tut nichts
+#include <Arduino.h>
+
+inline esp_err_t esp_task_wdt_init(uint32_t, bool) { return ESP_OK; }
+inline esp_err_t esp_task_wdt_add(TaskHandle_t) { return ESP_OK; }
+inline esp_err_t esp_task_wdt_reset() { return ESP_OK; }
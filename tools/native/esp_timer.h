@@ -0,0 +1,32 @@
+#pragma once
+// Platzhalter für den Host-Build: Zeit seit Start wie millis(), Timer werden angelegt, feuern aber nie
+// (tools/mydbg_bench.cpp ruft Callbacks wie MYDBG_watchAbtasten() bei Bedarf selbst auf)
+#include <Arduino.h>
+
+typedef struct esp_timer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+
+typedef enum
+{
+    ESP_TIMER_TASK
+} esp_timer_dispatch_t;
+
+typedef struct
+{
+    esp_timer_cb_t callback;
+    void *arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char *name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+inline int64_t esp_timer_get_time() { return MYDBG_nativeMikros(); }
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t *, esp_timer_handle_t *handle)
+{
+    *handle = (esp_timer_handle_t)1;
+    return ESP_OK;
+} // Ende der Funktion esp_timer_create
+
+inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t, uint64_t) { return ESP_OK; }
+inline esp_err_t esp_timer_stop(esp_timer_handle_t) { return ESP_OK; }